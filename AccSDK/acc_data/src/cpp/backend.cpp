@@ -83,6 +83,8 @@ TensorDataType ParseDataType(const std::string& format)
                 return TensorDataType::FP32;
             }
             break;
+        case 'e':
+            return TensorDataType::FP16;
         default:
             break;
     }
@@ -96,6 +98,8 @@ std::string EncodeDataType(TensorDataType type)
             return "=b";
         case TensorDataType::FP32:
             return "=f";
+        case TensorDataType::FP16:
+            return "=e";
         default:
             break;
     }
@@ -268,6 +272,8 @@ static void ExposeTypes(py::module& m)
         .value("UINT8", TensorDataType::UINT8)
         .value("FP32", TensorDataType::FP32)
         .value("CHAR", TensorDataType::CHAR)
+        .value("FP16", TensorDataType::FP16)
+        .value("BF16", TensorDataType::BF16)
         .export_values();
 
     // TensorLayout
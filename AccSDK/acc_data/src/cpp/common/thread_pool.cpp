@@ -26,6 +26,7 @@
 #include <stdexcept>
 
 #include "check.h"
+#include "accdata_scratch_arena.h"
 
 namespace acclib {
 namespace accdata {
@@ -117,6 +118,8 @@ void ThreadPool::Work(int id, const std::string &name)
             std::unique_lock<std::mutex> lock(mMutex);
             mErrors[id] = H_THREADPOOL_ERROR;
         }
+        /* Scratch memory of a task does not outlive it. */
+        ScratchArena::ThreadLocal().Reset();
         /* Check wether all task are done and all threads are idle. */
         {
             std::unique_lock<std::mutex> lock(mMutex);
@@ -83,6 +83,26 @@ public:
      */
     virtual AccDataErrorCode Run(std::unordered_map<std::string, std::shared_ptr<AccDataTensorList>> inputs,
         std::vector<std::shared_ptr<AccDataTensorList>> &outputs, bool copy) = 0;
+
+    /**
+     * @brief 运行Pipeline，输出直接写入调用方提供的内存
+     *
+     * @note 运行前outputBuffers中的内存被共享给对应的Pipeline输出，算子结果不超过该内存大小时原地写入，
+     * 否则仍由算子自行申请。调用方在内存释放前需对输出张量调用Reset，避免后续运行继续写入该内存。
+     *
+     * @param inputs 输入名称和数据
+     * @param outputs Pipeline输出结果
+     * @param copy 是否拷贝
+     * @param outputBuffers 与Pipeline输出一一对应的内存，为空指针的输出仍由算子申请
+     *
+     * @return AccData错误码：
+     * - H_OK 成功运行
+     * - H_PIPELINE_STATE_ERROR Pipeline状态不符合预期
+     * - H_PIPELINE_ERROR Pipeline系统错误
+     */
+    virtual AccDataErrorCode RunInto(std::unordered_map<std::string, std::shared_ptr<AccDataTensorList>> inputs,
+        std::vector<std::shared_ptr<AccDataTensorList>> &outputs, bool copy,
+        const std::vector<std::shared_ptr<AccDataTensorList>> &outputBuffers) = 0;
 };
 
 }
@@ -0,0 +1,224 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * @Description: Per thread bump allocator for kernel temporaries, shared by AccData and the SDK core.
+ * @Version: 1.0
+ * @Date: 2025-10-20 10:00:00
+ * @LastEditors: dev
+ * @LastEditTime: 2025-10-20 10:00:00
+ */
+
+#ifndef ACCDATA_SRC_CPP_INTERFACE_ACCDATA_SCRATCH_ARENA_H_
+#define ACCDATA_SRC_CPP_INTERFACE_ACCDATA_SCRATCH_ARENA_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace acclib {
+namespace accdata {
+
+/**
+ * @brief Bump allocator for the temporary buffers of a kernel.
+ *
+ * Every thread owns one arena. Allocation moves a pointer forward, memory is only given back by rewinding to a
+ * mark, which the thread pools do after each task. The chunks are kept, so once an arena has grown to the working
+ * set of its kernels it serves them without touching the heap. Not thread safe, use it from the owning thread only.
+ */
+class ScratchArena {
+public:
+    static constexpr size_t ALIGNMENT = 64;
+    static constexpr size_t MIN_CHUNK_SIZE = 256 * 1024;
+
+    struct Mark {
+        size_t chunk = 0;
+        size_t offset = 0;
+    };
+
+    /**
+     * @brief Arena of the calling thread.
+     */
+    static ScratchArena &ThreadLocal()
+    {
+        thread_local ScratchArena arena;
+        return arena;
+    }
+
+    ScratchArena() = default;
+
+    ScratchArena(const ScratchArena &) = delete;
+
+    ScratchArena &operator=(const ScratchArena &) = delete;
+
+    /**
+     * @brief Allocate bytes aligned to ALIGNMENT, the content is uninitialized.
+     *
+     * @return nullptr when out of memory.
+     */
+    void *AllocateBytes(size_t bytes)
+    {
+        if (bytes > SIZE_MAX - ALIGNMENT) {
+            return nullptr;
+        }
+        bytes = (std::max<size_t>(bytes, 1) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        if (mChunk < mChunks.size() && mChunks[mChunk].size - mOffset >= bytes) {
+            void *ptr = mChunks[mChunk].data.get() + mOffset;
+            mOffset += bytes;
+            return ptr;
+        }
+        // move on to a later chunk which was kept by a rewind, or grow
+        size_t next = mChunks.empty() ? 0 : mChunk + 1;
+        while (next < mChunks.size() && mChunks[next].size < bytes) {
+            ++next;
+        }
+        if (next == mChunks.size() && !AddChunk(std::max({bytes, mCapacity, MIN_CHUNK_SIZE}))) {
+            return nullptr;
+        }
+        mChunk = next;
+        mOffset = bytes;
+        return mChunks[mChunk].data.get();
+    }
+
+    /**
+     * @brief Allocate count elements of T, the count may be signed or unsigned.
+     *
+     * @return nullptr for a negative count, on overflow or when out of memory.
+     */
+    template <typename T, typename N>
+    T *Allocate(N count)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Scratch memory is released without destructors.");
+        static_assert(std::is_integral_v<N>, "Count must be an integer.");
+        if constexpr (std::is_signed_v<N>) {
+            if (count < 0) {
+                return nullptr;
+            }
+        }
+        if (static_cast<std::make_unsigned_t<N>>(count) > SIZE_MAX / sizeof(T)) {
+            return nullptr;
+        }
+        return static_cast<T *>(AllocateBytes(static_cast<size_t>(count) * sizeof(T)));
+    }
+
+    Mark GetMark() const
+    {
+        return {mChunk, mOffset};
+    }
+
+    /**
+     * @brief Release everything allocated after the mark.
+     */
+    void Rewind(const Mark &mark)
+    {
+        if (mark.chunk == 0 && mark.offset == 0) {
+            Reset();
+            return;
+        }
+        mChunk = mark.chunk;
+        mOffset = mark.offset;
+    }
+
+    /**
+     * @brief Release everything. Chunks are merged into one, so the next round fits without growing.
+     */
+    void Reset()
+    {
+        mChunk = 0;
+        mOffset = 0;
+        if (mChunks.size() <= 1) {
+            return;
+        }
+        size_t capacity = mCapacity;
+        mChunks.clear();
+        mCapacity = 0;
+        // on failure the arena simply starts empty and grows again
+        AddChunk(capacity);
+    }
+
+    size_t Capacity() const
+    {
+        return mCapacity;
+    }
+
+private:
+    struct AlignedDelete {
+        void operator()(uint8_t *ptr) const
+        {
+            ::operator delete(ptr, std::align_val_t(ALIGNMENT));
+        }
+    };
+
+    struct Chunk {
+        std::unique_ptr<uint8_t, AlignedDelete> data;
+        size_t size = 0;
+    };
+
+    bool AddChunk(size_t bytes)
+    {
+        auto *data = static_cast<uint8_t *>(::operator new(bytes, std::align_val_t(ALIGNMENT), std::nothrow));
+        if (data == nullptr) {
+            return false;
+        }
+        Chunk chunk;
+        chunk.data.reset(data);
+        chunk.size = bytes;
+        mChunks.push_back(std::move(chunk));
+        mCapacity += bytes;
+        return true;
+    }
+
+    std::vector<Chunk> mChunks;
+    size_t mChunk = 0;
+    size_t mOffset = 0;
+    size_t mCapacity = 0;
+};
+
+/**
+ * @brief Rewind the arena of the calling thread to where it was on construction.
+ *
+ * For temporaries that live longer than one task, e.g. tables built before the tasks are added and read by them.
+ */
+class ScratchScope {
+public:
+    ScratchScope() : mArena(ScratchArena::ThreadLocal()), mMark(mArena.GetMark()) {}
+
+    ~ScratchScope()
+    {
+        mArena.Rewind(mMark);
+    }
+
+    ScratchScope(const ScratchScope &) = delete;
+
+    ScratchScope &operator=(const ScratchScope &) = delete;
+
+    ScratchArena &Arena()
+    {
+        return mArena;
+    }
+
+private:
+    ScratchArena &mArena;
+    ScratchArena::Mark mMark;
+};
+
+} // namespace accdata
+} // namespace acclib
+
+#endif // ACCDATA_SRC_CPP_INTERFACE_ACCDATA_SCRATCH_ARENA_H_
@@ -52,8 +52,10 @@ std::ostream &operator << (std::ostream &os, TensorLayout layout);
  */
 enum class TensorDataType {
     FP32 = 0,
+    FP16 = 1,
     UINT8 = 4,
     CHAR = 13,
+    BF16 = 27,
     LAST = -1, // Invalid
 };
 
@@ -66,6 +68,18 @@ using TensorShape = std::vector<size_t>;
 
 std::ostream &operator << (std::ostream &os, TensorDataType layout);
 
+/**
+ * @brief Tensor内存分配函数，返回至少numBytes字节、64字节对齐的内存，共享指针释放时归还内存，申请失败返回空指针
+ */
+using TensorAllocator = std::shared_ptr<void> (*)(size_t numBytes);
+
+/**
+ * @brief 设置Tensor申请数据内存时使用的分配函数，应在流水线运行前设置
+ *
+ * @param allocator 分配函数，为空时恢复默认的对齐new[]分配
+ */
+void SetTensorAllocator(TensorAllocator allocator);
+
 /**
  * @class AccDataTensor
  * @brief AccData数据格式
@@ -104,6 +118,11 @@ public:
      */
     virtual std::shared_ptr<void> RawDataPtr() const = 0;
 
+    /**
+     * @brief 释放当前Tensor的数据，已通过RawDataPtr取走的数据不受影响，下次Resize会申请新的内存
+     */
+    virtual void Reset() = 0;
+
     /**
      * @brief 获取当前Tensor的数据布局
      *
@@ -120,6 +139,8 @@ public:
      * @return TensorDataType：
      * - UINT8 1字节无符号整数
      * - FP32 单精度浮点数
+     * - FP16 半精度浮点数
+     * - BF16 bfloat16浮点数
      * - CHAR 字符
      * - LAST 不支持的数据类型
      */
@@ -72,17 +72,60 @@ AccDataErrorCode QwenArgs::Setup(const OpSpec &spec, Workspace &ws)
         return AccDataErrorCode::H_COMMON_OPERATOR_ERROR;
     }
 
+    errCode = SetupExplicitResize(spec, ws);
+    ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to get resize argument.", errCode);
+
     auto &input = ws.GetInput(0, errCode);
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to get input.", errCode);
     if (input.NumTensors() < 1 || input[0].DataType() != TensorDataType::UINT8) {
         ACCDATA_ERROR("Input for Qwen2-VL should not be empty and the datatype should be uint8 and not empty.");
         return AccDataErrorCode::H_COMMON_OPERATOR_ERROR;
     }
-    mNeedRepeat = (input[0].Shape()[0] == 1);
+    mMergeFrames = false;
+    if (spec.HasArg("merge_frames")) {
+        errCode = spec.GetArg<bool>("merge_frames", ws, mMergeFrames);
+        ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to get argument.", errCode);
+    }
+    uint64_t numSamples = input[0].Shape()[0];
+    if (mMergeFrames) {
+        for (uint64_t i = 1; i < input.NumTensors(); ++i) {
+            numSamples += input[i].Shape()[0];
+        }
+    }
+    mNeedRepeat = (numSamples % mTemporalPatchSize != 0);
 
     ACCDATA_DEBUG("Qwen args: Min pixels = " << mMinPixels << ", Max pixels = " << mMaxPixels << ", Patch size = " <<
         mPatchSize << ", Temporal patch size = " << mTemporalPatchSize << ", Merge size = " << mMergeSize <<
-        " Need repeat = " << (mNeedRepeat ? "yes" : "no") << ".");
+        " Need repeat = " << (mNeedRepeat ? "yes" : "no") << ", Merge frames = " << (mMergeFrames ? "yes" : "no") <<
+        ", Resize = " << mResizeH << "x" << mResizeW << ".");
+    return errCode;
+}
+
+AccDataErrorCode QwenArgs::SetupExplicitResize(const OpSpec &spec, Workspace &ws)
+{
+    AccDataErrorCode errCode = AccDataErrorCode::H_OK;
+    mResizeH = 0;
+    mResizeW = 0;
+    if (spec.HasArg("resize_h")) {
+        errCode = spec.GetArg<int64_t>("resize_h", ws, mResizeH);
+        ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to get argument.", errCode);
+    }
+    if (spec.HasArg("resize_w")) {
+        errCode = spec.GetArg<int64_t>("resize_w", ws, mResizeW);
+        ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to get argument.", errCode);
+    }
+    if (mResizeH == 0 && mResizeW == 0) {
+        return errCode;
+    }
+
+    auto factor = mPatchSize * mMergeSize;
+    if (mResizeH < RESIZE_HEIGHT_MIN || mResizeH > RESIZE_HEIGHT_MAX || mResizeW < RESIZE_WIDTH_MIN ||
+        mResizeW > RESIZE_WIDTH_MAX || mResizeH % factor != 0 || mResizeW % factor != 0) {
+        ACCDATA_ERROR("Resize height and width should be in [" << RESIZE_HEIGHT_MIN << ", " << RESIZE_HEIGHT_MAX <<
+            "] and be multiples of patch size * merge size (" << factor << "), but get " << mResizeH << "x" <<
+            mResizeW << ".");
+        return AccDataErrorCode::H_COMMON_OPERATOR_ERROR;
+    }
     return errCode;
 }
 
@@ -37,6 +37,11 @@
  * - patch_size: The spacial patch size of the vision encoder, defaults to 14
  * - temporal_patch_size: The temporal patch size of the vision encoder, defaults to 2
  * - merge_size: The merge size of the vision encoder to llm encoder, defaults to 2
+ * Optional arguments:
+ * - resize_h/resize_w: Explicit resized height and width, both must be multiples of `patch_size * merge_size`.
+ *   When not set (or 0), the size is computed by smart resize from min_pixels and max_pixels.
+ * - merge_frames: When true, the tensors of the input list are consecutive frames of one video with the same
+ *   shape, they are written into a single output instead of one output per tensor. Defaults to false.
  */
 namespace acclib {
 namespace accdata {
@@ -83,13 +88,43 @@ public:
         return mNeedRepeat;
     }
 
+    inline int64_t ResizeH() const
+    {
+        return mResizeH;
+    }
+
+    inline int64_t ResizeW() const
+    {
+        return mResizeW;
+    }
+
+    /** Whether the input tensors are the frames of one video */
+    inline bool MergeFrames() const
+    {
+        return mMergeFrames;
+    }
+
+    /** Whether resize_h/resize_w were given, in which case smart resize is skipped */
+    inline bool HasExplicitResize() const
+    {
+        return mResizeH > 0 && mResizeW > 0;
+    }
+
 private:
+    /**
+     * @brief Read the optional resize_h/resize_w arguments.
+     */
+    AccDataErrorCode SetupExplicitResize(const OpSpec &spec, Workspace &ws);
+
     int64_t mMinPixels = 56 * 56;
     int64_t mMaxPixels = 28 * 28 * 1280;
     int64_t mPatchSize = 14;
     int64_t mTemporalPatchSize = 2;
     int64_t mMergeSize = 2;
     bool mNeedRepeat = false;
+    int64_t mResizeH = 0;
+    int64_t mResizeW = 0;
+    bool mMergeFrames = false;
 };
 
 }  // namespace accdata
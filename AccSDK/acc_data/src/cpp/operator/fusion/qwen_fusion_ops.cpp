@@ -54,15 +54,38 @@ AccDataErrorCode QwenFusionOp::Run(Workspace &ws)
     errCode = GetOutputShape(input, outputShape);
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK,
         "Failed to get output shape.", errCode);
-    errCode = output.Resize<ResultType>(outputShape);
+    errCode = output.Resize(outputShape, mNormalizeArgs.OutputDataType());
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to resize.", errCode);
     auto &pool = ws.GetThreadPool();
-
-    int numTensors = input.NumTensors();
-    for (int i = 0; i < numTensors; ++i) {
-        auto &in = input[i];
+    /* The resize coefficients of every tensor stay in the scratch arena until the tasks have run. */
+    ScratchScope scratch;
+
+    /* Merged frames are the samples of a single output, otherwise every input tensor has its own output. */
+    std::vector<std::vector<const Tensor *>> groups;
+    for (uint64_t i = 0; i < input.NumTensors(); ++i) {
+        if (!mQwenArgs.MergeFrames() || groups.empty()) {
+            groups.emplace_back();
+        }
+        groups.back().push_back(&input[i]);
+    }
+    for (size_t i = 0; i < groups.size(); ++i) {
+        auto &in = groups[i];
         auto &out = output[i];
-        errCode = ClassifyTask<uint8_t, ResultType>(pool, in, out);
+        switch (mNormalizeArgs.OutputDataType()) {
+            case TensorDataType::FP16:
+                errCode = ClassifyTask<uint8_t, Float16>(pool, in, out);
+                break;
+            case TensorDataType::BF16:
+                errCode = ClassifyTask<uint8_t, BFloat16>(pool, in, out);
+                break;
+            default:
+                errCode = ClassifyTask<uint8_t, ResultType>(pool, in, out);
+                break;
+        }
+        if (errCode != AccDataErrorCode::H_OK) {
+            /* Tasks already added read the scratch coefficients, they must not outlive this scope. */
+            pool.RunAll();
+        }
         ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK,
                                        "Failed to run Qwen2 Vl fusion task.", errCode);
     }
@@ -101,6 +124,17 @@ AccDataErrorCode QwenFusionOp::Setup(Workspace &ws)
 AccDataErrorCode QwenFusionOp::GetOutputShape(const TensorList &input, TensorListShape& outputShape)
 {
     auto numSamples = mInputMeta.NumSamples();
+    uint64_t numOutputs = input.NumTensors();
+    if (mQwenArgs.MergeFrames()) {
+        for (uint64_t i = 1; i < input.NumTensors(); ++i) {
+            if (input[i].Shape() != input[0].Shape()) {
+                ACCDATA_ERROR("Merged frames should all have the shape of the first frame.");
+                return AccDataErrorCode::H_COMMON_OPERATOR_ERROR;
+            }
+        }
+        numSamples *= static_cast<int64_t>(input.NumTensors());
+        numOutputs = 1;
+    }
     auto temporalPatchSize = mQwenArgs.TemporalPatchSize();
     auto patchSize = mQwenArgs.PatchSize();
     auto mergeSize = mQwenArgs.MergeSize();
@@ -112,24 +146,20 @@ AccDataErrorCode QwenFusionOp::GetOutputShape(const TensorList &input, TensorLis
     auto resizeInfo = SmartResize(patchSize * mergeSize);
     auto height = resizeInfo[0];
     auto width = resizeInfo[1];
-    // if numSamples don't eq 1, precision is not right.
-    if (height <= 0 || width <= 0 || numSamples != 1) {
-        ACCDATA_ERROR("Resize height and width should be greater than 0, and numSamples should be 1.");
+    if (height <= 0 || width <= 0 || numSamples < 1) {
+        ACCDATA_ERROR("Resize height and width should be greater than 0, and numSamples should be at least 1.");
         return AccDataErrorCode::H_COMMON_OPERATOR_ERROR;
     }
     ACCDATA_DEBUG("resize height " << height << " resize width " << width);
 
     auto numChannels = mInputMeta.NumChannels();
 
-    // if input has only 1 image, then need to duplicate the processed image twice
-    if (numSamples == 1) {
-        numSamples = 2; // 2 is Qwen tile
-    }
-    auto gridT = numSamples / temporalPatchSize;
+    // the last frame is repeated to fill an incomplete temporal group
+    auto gridT = (numSamples + temporalPatchSize - 1) / temporalPatchSize;
     auto gridH = height / patchSize;
     auto gridW = width / patchSize;
     ACCDATA_DEBUG("Qwen grid_t = " << gridT << ", grid_h = " << gridH << ", grid_w = " << gridW);
-    outputShape = TensorListShape(input.NumTensors(),
+    outputShape = TensorListShape(numOutputs,
                                   {static_cast<size_t>(gridT * gridH * gridW),
                                    static_cast<size_t>(numChannels * temporalPatchSize * patchSize * patchSize)});
     return AccDataErrorCode::H_OK;
@@ -154,6 +184,9 @@ QwenFusionOp::Param QwenFusionOp::SetupParam()
 
 std::vector<int64_t> QwenFusionOp::SmartResize(int64_t factor)
 {
+    if (mQwenArgs.HasExplicitResize()) {
+        return { mQwenArgs.ResizeH(), mQwenArgs.ResizeW() };
+    }
     auto height = mInputMeta.Height();
     auto width = mInputMeta.Width();
     auto resizeH = PyRound(static_cast<double>(height) / static_cast<double>(factor)) * factor;
@@ -171,49 +204,89 @@ std::vector<int64_t> QwenFusionOp::SmartResize(int64_t factor)
     return { resizeH, resizeW };
 }
 
-template <typename InputType, typename OutputType>
-AccDataErrorCode QwenFusionOp::ClassifyTask(ThreadPool &pool, const Tensor &input, Tensor &output)
+AccDataErrorCode QwenFusionOp::PrepareCoeffs(const Param &param, ScratchArena &arena,
+    resizeKernelCoeffs &resizeCoeffs)
 {
-    auto inLayout = input.Layout();
-    if (inLayout != TensorLayout::NHWC) {
-        ACCDATA_ERROR("Unsupported input layout " << inLayout);
+    resizeCoeffs.coeffSizeX = PrecomputeCoeffs(param.width, param.resizeW, arena,
+        &resizeCoeffs.boundsX, &resizeCoeffs.coeffsX);
+    resizeCoeffs.coeffSizeY = PrecomputeCoeffs(param.height, param.resizeH, arena,
+        &resizeCoeffs.boundsY, &resizeCoeffs.coeffsY);
+    if (resizeCoeffs.coeffSizeX == 0 || resizeCoeffs.coeffSizeY == 0 || resizeCoeffs.coeffsX == nullptr ||
+        resizeCoeffs.boundsX == nullptr || resizeCoeffs.coeffsY == nullptr || resizeCoeffs.boundsY == nullptr) {
+        ACCDATA_ERROR("Failed to precompute resize coefficients.");
         return AccDataErrorCode::H_FUSIONOP_ERROR;
     }
+    NormalizeCoeffs(param.resizeW, resizeCoeffs.coeffSizeX, resizeCoeffs.coeffsX);
+    NormalizeCoeffs(param.resizeH, resizeCoeffs.coeffSizeY, resizeCoeffs.coeffsY);
+    return AccDataErrorCode::H_OK;
+}
 
-    if (input.DataType() != TensorDataType::UINT8) {
-        ACCDATA_ERROR("Unsupported input dataType " << input.DataType());
-        return AccDataErrorCode::H_FUSIONOP_ERROR;
+template <typename InputType, typename OutputType>
+AccDataErrorCode QwenFusionOp::ClassifyTask(ThreadPool &pool, const std::vector<const Tensor *> &inputs,
+    Tensor &output)
+{
+    for (auto input : inputs) {
+        auto inLayout = input->Layout();
+        if (inLayout != TensorLayout::NHWC) {
+            ACCDATA_ERROR("Unsupported input layout " << inLayout);
+            return AccDataErrorCode::H_FUSIONOP_ERROR;
+        }
+
+        if (input->DataType() != TensorDataType::UINT8) {
+            ACCDATA_ERROR("Unsupported input dataType " << input->DataType());
+            return AccDataErrorCode::H_FUSIONOP_ERROR;
+        }
     }
     output.SetLayout(TensorLayout::PLAIN);
 
-    return AddTask<InputType, OutputType, TensorLayout::NHWC>(pool, input, output);
+    return AddTask<InputType, OutputType, TensorLayout::NHWC>(pool, inputs, output);
 }
 
 template <typename InputType, typename OutputType, TensorLayout InLayout>
-AccDataErrorCode QwenFusionOp::AddTask(ThreadPool &pool, const Tensor &input, Tensor &output)
+AccDataErrorCode QwenFusionOp::AddTask(ThreadPool &pool, const std::vector<const Tensor *> &inputs, Tensor &output)
 {
-    int numThreads = pool.NumThreads();
-    auto numberSamples = mInputMeta.NumSamples();
-    auto strideIn = NumElements(input.Shape(), 1);
-    auto strideOut = NumElements(output.Shape(), 1);
+    int64_t numThreads = pool.NumThreads();
+    /* The frames are read where they are, one tensor may hold several of them. */
+    std::vector<const InputType *> samples;
+    for (auto input : inputs) {
+        auto strideIn = NumElements(input->Shape(), 1);
+        for (int64_t i = 0; i < mInputMeta.NumSamples(); ++i) {
+            samples.push_back(input->RawDataPtr<InputType>() + i * strideIn);
+        }
+    }
+    auto numberSamples = static_cast<int64_t>(samples.size());
+    auto temporalPatchSize = mQwenArgs.TemporalPatchSize();
+    auto gridT = (numberSamples + temporalPatchSize - 1) / temporalPatchSize;
+    auto strideOut = NumElements(output.Shape()) / gridT; // one temporal group
     Param param = SetupParam();
 
+    resizeKernelCoeffs resizeCoeffs;
+    auto errCode = PrepareCoeffs(param, ScratchArena::ThreadLocal(), resizeCoeffs);
+    ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to prepare resize.", errCode);
+
+    /* Frames are independent tasks already, rows are only split when there are fewer frames than threads. */
+    int64_t numBands = std::max<int64_t>(1, (numThreads + numberSamples - 1) / numberSamples);
+    /* Bands hold whole patch row blocks, so that every block is transposed by a single task. */
+    int64_t blockRows = mQwenArgs.PatchSize() * mQwenArgs.MergeSize();
+    int64_t numBlocks = param.resizeH / blockRows;
     for (int64_t i = 0; i < numberSamples; ++i) {
-        auto *in = input.RawDataPtr<InputType>() + i * strideIn;
-        auto *out = output.RawDataPtr<OutputType>() + i * strideOut;
-        for (int j = 0; j < numThreads; ++j) {
+        auto *in = samples[i];
+        auto *out = output.RawDataPtr<OutputType>() + (i / temporalPatchSize) * strideOut;
+        param.temporalBegin = i % temporalPatchSize;
+        param.temporalEnd = (i == numberSamples - 1) ? temporalPatchSize : param.temporalBegin + 1;
+        for (int64_t j = 0; j < numBands; ++j) {
             /* split based on the height dimension to ensure parallelism. */
             Balance::Task range;
-            auto errCode = Balance::Assign(param.resizeH, numThreads, j, range);
+            errCode = Balance::Assign(numBlocks, numBands, j, range);
             ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to distribute tasks.", errCode);
             if (range.begin >= range.end) {
                 break;
             }
-            param.begin = range.begin;
-            param.end = range.end;
+            param.begin = range.begin * blockRows;
+            param.end = range.end * blockRows;
             /* Because the task is executed after it leaves this scope, so use value capture. */
-            auto task = [this, in, out, param](int id, AccDataErrorCode &errCode) {
-                RunTask<InputType, OutputType, InLayout>(in, out, param, errCode);
+            auto task = [this, in, out, param, resizeCoeffs](int id, AccDataErrorCode &errCode) {
+                RunTask<InputType, OutputType, InLayout>(in, out, param, resizeCoeffs, errCode);
             };
             ACCDATA_DEBUG("Addtask sample: " << i << ", thread " << j);
             pool.AddTask(task);
@@ -225,11 +298,10 @@ AccDataErrorCode QwenFusionOp::AddTask(ThreadPool &pool, const Tensor &input, Te
 
 template <typename InputType, typename OutputType, TensorLayout InLayout>
 void QwenFusionOp::RunTask(const InputType *input, OutputType *output,
-    const QwenFusionOp::Param &param, AccDataErrorCode &workerErr)
+    const QwenFusionOp::Param &param, const resizeKernelCoeffs &resizeCoeffs, AccDataErrorCode &workerErr)
 {
     if constexpr (InLayout == TensorLayout::NHWC) {
-        KernelNHWC<InputType, OutputType>(input, output, param);
-        workerErr = AccDataErrorCode::H_OK;
+        workerErr = KernelNHWC<InputType, OutputType>(input, output, param, resizeCoeffs);
     } else {
         ACCDATA_ERROR("Unsupported result layout " << InLayout);
         workerErr = AccDataErrorCode::H_FUSIONOP_ERROR;
@@ -237,7 +309,7 @@ void QwenFusionOp::RunTask(const InputType *input, OutputType *output,
     return;
 }
 
-int QwenFusionOp::PrecomputeCoeffs(int inSize, int outSize, int **boundsPtr, double **coeffsPtr)
+int QwenFusionOp::PrecomputeCoeffs(int inSize, int outSize, ScratchArena &arena, int **boundsPtr, double **coeffsPtr)
 {
     double filterScale; // scale to find surround pixel in origin image
     double scale; // scale to find center pixel in origin image
@@ -254,8 +326,11 @@ int QwenFusionOp::PrecomputeCoeffs(int inSize, int outSize, int **boundsPtr, dou
         return 0;
     }
 
-    auto coeffs = (double *)aligned_alloc(ACCDATA_ALIGN_SIZE, AlignUp(outSize * coeffSize, sizeof(double)));
-    auto bounds = (int *)aligned_alloc(ACCDATA_ALIGN_SIZE, AlignUp(outSize * BOUND_SIZE, sizeof(int)));
+    auto coeffs = static_cast<double *>(arena.AllocateBytes(AlignUp(outSize * coeffSize, sizeof(double))));
+    auto bounds = static_cast<int *>(arena.AllocateBytes(AlignUp(outSize * BOUND_SIZE, sizeof(int))));
+    if (coeffs == nullptr || bounds == nullptr) {
+        return 0;
+    }
 
     auto ss = 1.0 / filterScale;
     for (auto i = 0; i < outSize; i++) {
@@ -305,7 +380,7 @@ int QwenFusionOp::PrecomputeCoeffs(int inSize, int outSize, int **boundsPtr, dou
 */
 template <typename InputType, typename OutputType>
 void QwenFusionOp::KernelNHWCHorizontal(const InputType *input, OutputType *output, const QwenFusionOp::Param &param,
-    resizeKernelCoeffs& resizeCoeffs)
+    const resizeKernelCoeffs &resizeCoeffs)
 {
     double *coeffsX = resizeCoeffs.coeffsX;
     int *boundsX = resizeCoeffs.boundsX;
@@ -341,7 +416,9 @@ void QwenFusionOp::KernelNHWCHorizontal(const InputType *input, OutputType *outp
 
 /**
  * @brief Resize the input image in vertical direction, then do totensor normalization and transpose.
- * The output is in CHW format.
+ * Rows are normalized in float into a CHW tile of one patch row block, which is flushed to the output once it
+ * is full, the conversion to a half precision OutputType happens on that flush.
+ * The task range must be aligned to the block rows.
  *
  * @tparam InputType Type of the input data (e.g., uint8_t).
  * @tparam OutputType Type of the output data (e.g., float).
@@ -351,26 +428,37 @@ void QwenFusionOp::KernelNHWCHorizontal(const InputType *input, OutputType *outp
  * @param resizeCoeffs Precomputed coefficients for resizing.
  */
 template <typename InputType, typename OutputType>
-void QwenFusionOp::KernelNHWCVertical(const InputType *input, OutputType *output, const QwenFusionOp::Param &param,
-    resizeKernelCoeffs& resizeCoeffs)
+AccDataErrorCode QwenFusionOp::KernelNHWCVertical(const InputType *input, OutputType *output, const QwenFusionOp::Param &param,
+    const resizeKernelCoeffs &resizeCoeffs)
 {
-    auto resized_row = (OutputType *)aligned_alloc(ACCDATA_ALIGN_SIZE,
-        AlignUp(param.resizeW * RGB_CHANNELS, sizeof(OutputType)));
     int64_t hdim[RGB_CHANNELS] = {mQwenArgs.PatchSize(), mQwenArgs.MergeSize(),
         param.resizeH / (mQwenArgs.MergeSize() * mQwenArgs.PatchSize())};
     int64_t wdim[RGB_CHANNELS] = {mQwenArgs.PatchSize(), mQwenArgs.MergeSize(),
         param.resizeW / (mQwenArgs.MergeSize() * mQwenArgs.PatchSize())};
     int64_t tps = mQwenArgs.TemporalPatchSize();
     Tranpose quickTranspose(hdim, wdim, tps);
+    int64_t blockRows = quickTranspose.BlockRows();
+    auto tile = static_cast<ResultType *>(ScratchArena::ThreadLocal().AllocateBytes(
+        AlignUp(quickTranspose.TileSize(), sizeof(ResultType))));
+    if (tile == nullptr) {
+        ACCDATA_ERROR("Failed to allocate the transpose tile.");
+        return AccDataErrorCode::H_FUSIONOP_ERROR;
+    }
     int *boundsY = resizeCoeffs.boundsY;
     auto intCoeffsY = reinterpret_cast<long *>(resizeCoeffs.coeffsY);
     auto coeffSizeY = resizeCoeffs.coeffSizeY;
     auto yStart = resizeCoeffs.boundsY[param.begin * BOUND_SIZE];
+    // hwc->chw && bgr->rgb && rescale
+    double mul = ToTensorArgs::NORM_FACTOR;
+    auto mean = mNormalizeArgs.Mean();
+    auto scale = mNormalizeArgs.Scale();
+    int64_t channelStride = blockRows * param.resizeW;
 
     for (auto yy = param.begin; yy < param.end; ++yy) {
         auto wv = &intCoeffsY[yy * coeffSizeY];
         int ymin = boundsY[yy * BOUND_SIZE + 0];
         int ymax = boundsY[yy * BOUND_SIZE + 1];
+        ResultType *row = tile + (yy % blockRows) * param.resizeW;
         for (int xx = 0; xx < param.resizeW; ++xx) {
             int t0 = 1 << (PRECISION_BITS - 1);
             int t1 = t0;
@@ -383,60 +471,45 @@ void QwenFusionOp::KernelNHWCVertical(const InputType *input, OutputType *output
                 t2 += (static_cast<uint8_t>(input[offset + RGB_CHANNEL_BLUE])) * wv[y];
             }
 
-            // hwc->chw && bgr->rgb && rescale
-            double mul = ToTensorArgs::NORM_FACTOR;
-            auto mean = mNormalizeArgs.Mean();
-            auto scale = mNormalizeArgs.Scale();
-            resized_row[RGB_CHANNEL_RED * param.resizeW + xx] =
-                    ((OutputType)(Clip8(t0) * mul) - mean[RGB_CHANNEL_RED]) * scale[RGB_CHANNEL_RED];
-            resized_row[RGB_CHANNEL_GREEN * param.resizeW + xx] =
-                    ((OutputType)(Clip8(t1) * mul) - mean[RGB_CHANNEL_GREEN]) * scale[RGB_CHANNEL_GREEN];
-            resized_row[RGB_CHANNEL_BLUE * param.resizeW + xx] =
-                    ((OutputType)(Clip8(t2) * mul) - mean[RGB_CHANNEL_BLUE]) * scale[RGB_CHANNEL_BLUE];
+            row[RGB_CHANNEL_RED * channelStride + xx] =
+                    ((ResultType)(Clip8(t0) * mul) - mean[RGB_CHANNEL_RED]) * scale[RGB_CHANNEL_RED];
+            row[RGB_CHANNEL_GREEN * channelStride + xx] =
+                    ((ResultType)(Clip8(t1) * mul) - mean[RGB_CHANNEL_GREEN]) * scale[RGB_CHANNEL_GREEN];
+            row[RGB_CHANNEL_BLUE * channelStride + xx] =
+                    ((ResultType)(Clip8(t2) * mul) - mean[RGB_CHANNEL_BLUE]) * scale[RGB_CHANNEL_BLUE];
         }
 
-        quickTranspose.Apply(resized_row + RGB_CHANNEL_RED * param.resizeW,
-            output, RGB_CHANNEL_RED, yy, hdim, wdim, tps);
-        quickTranspose.Apply(resized_row + RGB_CHANNEL_GREEN * param.resizeW,
-            output, RGB_CHANNEL_GREEN, yy, hdim, wdim, tps);
-        quickTranspose.Apply(resized_row + RGB_CHANNEL_BLUE * param.resizeW,
-            output, RGB_CHANNEL_BLUE, yy, hdim, wdim, tps);
+        if ((yy + 1) % blockRows == 0) {
+            quickTranspose.ApplyBlock(tile, output, yy / blockRows, param.temporalBegin, param.temporalEnd);
+        }
     }
 
-    free(resized_row);
+    return AccDataErrorCode::H_OK;
 }
 
 template <typename InputType, typename OutputType>
-void QwenFusionOp::KernelNHWC(const InputType *input, OutputType *output, const QwenFusionOp::Param &param)
+AccDataErrorCode QwenFusionOp::KernelNHWC(const InputType *input, OutputType *output, const QwenFusionOp::Param &param,
+    const resizeKernelCoeffs &resizeCoeffs)
 {
     ACCDATA_DEBUG("Running KernelNHWC2Pass");
     TRACE_BEGIN(FusionComputeOpt)
-    resizeKernelCoeffs resizeCoeffs;
-
-    resizeCoeffs.coeffSizeX = PrecomputeCoeffs(param.width, param.resizeW,
-        &resizeCoeffs.boundsX, &resizeCoeffs.coeffsX);
-    NormalizeCoeffs(param.resizeW, resizeCoeffs.coeffSizeX, resizeCoeffs.coeffsX);
-    resizeCoeffs.coeffSizeY = PrecomputeCoeffs(param.height, param.resizeH,
-        &resizeCoeffs.boundsY, &resizeCoeffs.coeffsY);
-    NormalizeCoeffs(param.resizeH, resizeCoeffs.coeffSizeY, resizeCoeffs.coeffsY);
     // First used row in the source image
     auto yStart = resizeCoeffs.boundsY[param.begin * BOUND_SIZE];
     // Last used row in the source image
     auto yEnd = resizeCoeffs.boundsY[param.end * BOUND_SIZE - BOUND_SIZE] +
         resizeCoeffs.boundsY[param.end * BOUND_SIZE - 1];
-    auto tmp_output = (InputType *)aligned_alloc(ACCDATA_ALIGN_SIZE,
-        AlignUp((yEnd - yStart) * param.resizeW * RGB_CHANNELS, sizeof(InputType)));
+    auto tmp_output = static_cast<InputType *>(ScratchArena::ThreadLocal().AllocateBytes(
+        AlignUp((yEnd - yStart) * param.resizeW * RGB_CHANNELS, sizeof(InputType))));
+    if (tmp_output == nullptr) {
+        ACCDATA_ERROR("Failed to allocate the horizontal resize buffer.");
+        return AccDataErrorCode::H_FUSIONOP_ERROR;
+    }
 
     KernelNHWCHorizontal(input, tmp_output, param, resizeCoeffs);
-    KernelNHWCVertical(tmp_output, output, param, resizeCoeffs);
-
-    free(resizeCoeffs.boundsX);
-    free(resizeCoeffs.boundsY);
-    free(resizeCoeffs.coeffsX);
-    free(resizeCoeffs.coeffsY);
-    free(tmp_output);
-    
+    auto errCode = KernelNHWCVertical(tmp_output, output, param, resizeCoeffs);
+
     TRACE_END(FusionComputeOpt)
+    return errCode;
 }
 ACCDATA_REGISTER_FUSION_OPERATOR(QwenFusionOp, QwenFusionOp);
 
@@ -23,12 +23,23 @@
 #ifndef ACCDATA_OPERATOR_IMAGE_QWEN_FUSION_OPS_H
 #define ACCDATA_OPERATOR_IMAGE_QWEN_FUSION_OPS_H
 #include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#elif defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+#include "accdata_scratch_arena.h"
 #include "operator/operator.h"
 #include "operator/image/resize_args.h"
 #include "operator/image/crop_args.h"
 #include "operator/image/to_tensor_args.h"
 
 #include "operator/math/normalize_args.h"
+#include "tensor/float16.h"
 #include "tensor/tensor_image.h"
 #include "qwen_args.h"
 
@@ -42,12 +53,17 @@ constexpr int BOUND_SIZE = 2; // maximum number of coeffs for each pixel is 2
  * @brief fusion operation for qwen2-vl image preprocess that combine
  * to_numpy_array/resize/rescale/normalize/to_chw/tile
  *
+ * The input may hold a batch of video frames (N, H, W, C). Every temporal_patch_size consecutive frames are
+ * interleaved into one temporal group of the output, and the last frame is repeated when N is not a multiple
+ * of temporal_patch_size, so a whole video is preprocessed in a single run. With merge_frames the frames may
+ * also be separate tensors of the input list, they are read in place and written into one output.
+ *
  * Argument:
  * - @see ref to
  * SCHEMA END
  */
 class QwenFusionOp : public Operator {
-    using ResultType = float; // Now assume the output datatype is float.
+    using ResultType = float; // Compute type, the output is converted to the dtype argument on the store.
 public:
     explicit QwenFusionOp(const OpSpec &spec) : Operator(spec) {}
 
@@ -65,15 +81,19 @@ private:
         /* Task range */
         int64_t begin = 0;
         int64_t end = 0;
+        /* Temporal slots of the output group written by the current frame */
+        int64_t temporalBegin = 0;
+        int64_t temporalEnd = 0;
     };
 
+    /* Tables live in the scratch arena of the thread running Run, which outlives the tasks reading them. */
     struct resizeKernelCoeffs {
-        double *coeffsX;
-        int *boundsX;
-        int coeffSizeX;
-        double *coeffsY;
-        int *boundsY;
-        int coeffSizeY;
+        double *coeffsX = nullptr;
+        int *boundsX = nullptr;
+        int coeffSizeX = 0;
+        double *coeffsY = nullptr;
+        int *boundsY = nullptr;
+        int coeffSizeY = 0;
     };
 
     AccDataErrorCode Setup(Workspace &ws);
@@ -84,25 +104,32 @@ private:
 
     std::vector<int64_t> SmartResize(int64_t factor = 2 * 14);
 
+    /**
+     * @brief Precompute the resize coefficients once, they are shared read-only by every frame and row band.
+     */
+    AccDataErrorCode PrepareCoeffs(const Param &param, ScratchArena &arena, resizeKernelCoeffs &resizeCoeffs);
+
     template <typename InputType, typename OutputType>
-    AccDataErrorCode ClassifyTask(ThreadPool &pool, const Tensor &input, Tensor &output);
+    AccDataErrorCode ClassifyTask(ThreadPool &pool, const std::vector<const Tensor *> &inputs, Tensor &output);
 
     template <typename InputType, typename OutputType, TensorLayout InLayout>
-    AccDataErrorCode AddTask(ThreadPool &pool, const Tensor &input, Tensor &output);
+    AccDataErrorCode AddTask(ThreadPool &pool, const std::vector<const Tensor *> &inputs, Tensor &output);
 
     template <typename InputType, typename OutputType, TensorLayout InLayout>
-    void RunTask(const InputType *input, OutputType *output, const Param &param, AccDataErrorCode &workerErr);
+    void RunTask(const InputType *input, OutputType *output, const Param &param,
+        const resizeKernelCoeffs &resizeCoeffs, AccDataErrorCode &workerErr);
 
     template <typename InputType, typename OutputType>
     void KernelNHWCHorizontal(const InputType *input, OutputType *output, const Param &param,
-        resizeKernelCoeffs& resizeCoeffs);
+        const resizeKernelCoeffs &resizeCoeffs);
 
     template <typename InputType, typename OutputType>
-    void KernelNHWCVertical(const InputType *input, OutputType *output, const Param &param,
-        resizeKernelCoeffs& resizeCoeffs);
+    AccDataErrorCode KernelNHWCVertical(const InputType *input, OutputType *output, const Param &param,
+        const resizeKernelCoeffs &resizeCoeffs);
 
     template <typename InputType, typename OutputType>
-    void KernelNHWC(const InputType *input, OutputType *output, const Param &param);
+    AccDataErrorCode KernelNHWC(const InputType *input, OutputType *output, const Param &param,
+        const resizeKernelCoeffs &resizeCoeffs);
 
     static inline double BicubicFilter(double x)
     {
@@ -130,11 +157,12 @@ private:
       * precompute coefficient w(x) and bound for each dimension
       * @param inSize input size
       * @param outSize output size
+      * @param arena scratch arena the tables are allocated from
       * @param boundsPtr bounds for dimension x, e.g. x_min as lower bound of the filter and x_max as the size of filter
       * @param coeffsPtr coefficient for dimension x
       * @return maximum number of coeffs for current pixel
       */
-    int PrecomputeCoeffs(int inSize, int outSize, int **boundsPtr, double **coeffsPtr);
+    int PrecomputeCoeffs(int inSize, int outSize, ScratchArena &arena, int **boundsPtr, double **coeffsPtr);
 
     void NormalizeCoeffs(int outSize, int ksize, double *coeffs)
     {
@@ -233,58 +261,132 @@ private:
     };
 };
 
+/**
+ * @brief Patch shuffle of the Qwen2-VL output.
+ *
+ * The vertical resize pass fills a tile holding one block of patchSize * mergeSize rows of every channel
+ * (CHW order). ApplyBlock then emits all output rows of that block in order, so the writes are sequential and
+ * the tile stays in cache, every patch row is copied as one contiguous run of patchSize elements. The tile is
+ * always float, a half precision destination is converted while the runs are copied.
+ */
 class Tranpose {
 public:
     Tranpose(int64_t hdim[3], int64_t wdim[3], int64_t b)
     {
-        height = hdim[0] * hdim[1] * hdim[2ULL];
+        patchSize = hdim[0];
+        mergeSize = hdim[1];
+        blocksW = wdim[2ULL];
+        temporal = b;
         width = wdim[0] * wdim[1] * wdim[2ULL];
-        hstride0 = wdim[0];
-        hstride1 = wdim[0] * wdim[1] * hdim[0] * b * 3LL;
-        hstride2 = hdim[0] * hdim[1] * width * b * 3LL;
-        bstride = hdim[0] * wdim[0];
-        cstride = bstride * b;
-        wstride0 = 1;
-        wstride1 = cstride * 3LL;
-        wstride2 = wstride1 * wdim[1] * hdim[1];
+        blockRows = hdim[0] * hdim[1];
+        patchArea = hdim[0] * wdim[0];
+        rowLength = patchArea * b * 3LL;
+        blockStride = rowLength * blocksW * wdim[1] * hdim[1];
+    }
+
+    int64_t BlockRows() const
+    {
+        return blockRows;
     }
 
-    template <typename T> void ApplyBatch(const T *src, T *dst, int64_t wdim[3])
+    /**
+     * @brief Size of the tile consumed by ApplyBlock, in elements.
+     */
+    int64_t TileSize() const
     {
-        for (int w2 = 0; w2 < wdim[2ULL]; w2++) {
-            T *dp2 = dst + w2 * wstride2;
-            for (int w1 = 0; w1 < wdim[1]; w1++) {
-                T *dp1 = dp2 + w1 * wstride1;
-                for (int w0 = 0; w0 < wdim[0]; w0++) {
-                    dp1[w0] = *src++;
+        return blockRows * width * 3LL;
+    }
+
+    /**
+     * @brief Scatter one tile into the temporal slots [tBegin, tEnd) of the rows of block h2.
+     */
+    template <typename T, typename U>
+    void ApplyBlock(const T *tile, U *dst, int64_t h2, int64_t tBegin, int64_t tEnd) const
+    {
+        U *dp = dst + h2 * blockStride;
+        for (int64_t w2 = 0; w2 < blocksW; w2++) {
+            for (int64_t h1 = 0; h1 < mergeSize; h1++) {
+                for (int64_t w1 = 0; w1 < mergeSize; w1++) {
+                    const T *sp = tile + h1 * patchSize * width + (w2 * mergeSize + w1) * patchSize;
+                    ApplyRow(sp, dp, tBegin, tEnd);
+                    dp += rowLength;
                 }
             }
         }
     }
 
-    template <typename T> void Apply(const T *src, T *dst, int c, int h, int64_t hdim[3], int64_t wdim[3], int64_t b)
+private:
+    template <typename T, typename U> void ApplyRow(const T *src, U *dst, int64_t tBegin, int64_t tEnd) const
     {
-        int h0 = h % hdim[0];
-        int h1 = (h / hdim[0]) % hdim[1];
-        int h2 = h / (hdim[0] * hdim[1]);
-        for (int j = 0; j < b; j++) {
-            T *dp = dst + h0 * hstride0 + h1 * hstride1 + h2 * hstride2 + c * cstride + j * bstride;
-            const T *sp = src;
-            ApplyBatch(sp, dp, wdim);
+        for (int64_t c = 0; c < 3LL; c++) {
+            const T *cp = src + c * blockRows * width;
+            for (int64_t t = tBegin; t < tEnd; t++) {
+                U *tp = dst + (c * temporal + t) * patchArea;
+                for (int64_t h0 = 0; h0 < patchSize; h0++) {
+                    CopyRun(cp + h0 * width, tp + h0 * patchSize, patchSize);
+                }
+            }
         }
     }
 
-private:
-    int64_t height = 0;   // = hdim[0] * hdim[1] * hdim[2];
-    int64_t width = 0;    // = wdim[0] * wdim[1] * wdim[2];
-    int64_t hstride0 = 0; // = wdim[0];
-    int64_t hstride1 = 0; // = wdim[0] * wdim[1] * hdim[0] * b * 3;
-    int64_t hstride2 = 0; // = hdim[0] * hdim[1] * width * b * 3;
-    int64_t bstride = 0;  // = hdim[0] * wdim[0];
-    int64_t cstride = 0;  // = bstride * b;
-    int64_t wstride0 = 1; // = 1;
-    int64_t wstride1 = 0; // = cstride * 3;
-    int64_t wstride2 = 0; // = wstride1 * wdim[1] * hdim[1];
+    template <typename T, typename U> static inline void CopyRun(const T *src, U *dst, int64_t n)
+    {
+        if constexpr (std::is_same_v<T, float> && !std::is_same_v<U, float>) {
+            ConvertFloatRow(src, dst, n);
+            return;
+        }
+        int64_t i = 0;
+#ifdef __ARM_NEON
+        if constexpr (std::is_same_v<T, float> && std::is_same_v<U, float>) {
+            for (; i + 8 <= n; i += 8) {
+                float32x4_t v0 = vld1q_f32(src + i);
+                float32x4_t v1 = vld1q_f32(src + i + 4);
+                vst1q_f32(dst + i, v0);
+                vst1q_f32(dst + i + 4, v1);
+            }
+            for (; i + 4 <= n; i += 4) {
+                vst1q_f32(dst + i, vld1q_f32(src + i));
+            }
+        }
+#elif defined(__AVX__)
+        if constexpr (std::is_same_v<T, float> && std::is_same_v<U, float>) {
+            for (; i + 16 <= n; i += 16) {
+                __m256 v0 = _mm256_loadu_ps(src + i);
+                __m256 v1 = _mm256_loadu_ps(src + i + 8);
+                _mm256_storeu_ps(dst + i, v0);
+                _mm256_storeu_ps(dst + i + 8, v1);
+            }
+            for (; i + 8 <= n; i += 8) {
+                _mm256_storeu_ps(dst + i, _mm256_loadu_ps(src + i));
+            }
+        }
+#elif defined(__SSE2__)
+        if constexpr (std::is_same_v<T, float> && std::is_same_v<U, float>) {
+            for (; i + 8 <= n; i += 8) {
+                __m128 v0 = _mm_loadu_ps(src + i);
+                __m128 v1 = _mm_loadu_ps(src + i + 4);
+                _mm_storeu_ps(dst + i, v0);
+                _mm_storeu_ps(dst + i + 4, v1);
+            }
+            for (; i + 4 <= n; i += 4) {
+                _mm_storeu_ps(dst + i, _mm_loadu_ps(src + i));
+            }
+        }
+#endif
+        for (; i < n; i++) {
+            dst[i] = src[i];
+        }
+    }
+
+    int64_t patchSize = 0;   // = hdim[0] = wdim[0];
+    int64_t mergeSize = 0;   // = hdim[1] = wdim[1];
+    int64_t blocksW = 0;     // = wdim[2];
+    int64_t temporal = 0;    // = b;
+    int64_t width = 0;       // = wdim[0] * wdim[1] * wdim[2];
+    int64_t blockRows = 0;   // = hdim[0] * hdim[1];
+    int64_t patchArea = 0;   // = hdim[0] * wdim[0];
+    int64_t rowLength = 0;   // = patchArea * b * 3;
+    int64_t blockStride = 0; // = rowLength * wdim[2] * wdim[1] * hdim[1];
 };
 
 }  // namespace accdata
@@ -24,6 +24,7 @@
 #include "to_tensor_resize_crop_normalize.h"
 
 #include "common/balance.h"
+#include "accdata_scratch_arena.h"
 #include "common/tracer.h"
 #include "operator/op_factory.h"
 
@@ -57,7 +58,7 @@ AccDataErrorCode ToTensorResizeCropNormalize::Run(Workspace &ws)
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK,
                                    "Failed to get output shape.", errCode);
 
-    errCode = output.Resize<ResultType>(outputShape);
+    errCode = output.Resize(outputShape, mNormArgs.OutputDataType());
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to resize.", errCode);
 
     auto &pool = ws.GetThreadPool();
@@ -66,7 +67,17 @@ AccDataErrorCode ToTensorResizeCropNormalize::Run(Workspace &ws)
     for (int i = 0; i < numTensors; ++i) {
         auto &in = input[i];
         auto &out = output[i];
-        errCode = ClassifyTask<uint8_t, ResultType>(pool, in, out);
+        switch (mNormArgs.OutputDataType()) {
+            case TensorDataType::FP16:
+                errCode = ClassifyTask<uint8_t, Float16>(pool, in, out);
+                break;
+            case TensorDataType::BF16:
+                errCode = ClassifyTask<uint8_t, BFloat16>(pool, in, out);
+                break;
+            default:
+                errCode = ClassifyTask<uint8_t, ResultType>(pool, in, out);
+                break;
+        }
         ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK,
                                        "Failed to classify task.", errCode);
     }
@@ -221,8 +232,7 @@ void ToTensorResizeCropNormalize::RunTask(const InputType *input, OutputType *ou
                                           AccDataErrorCode &errCode)
 {
     if constexpr (InLayout == TensorLayout::NHWC && OutLayout == TensorLayout::NCHW) {
-        Kernel2NCHW<InputType, OutputType>(input, output, param);
-        errCode = AccDataErrorCode::H_OK;
+        errCode = Kernel2NCHW<InputType, OutputType>(input, output, param);
     } else if constexpr (InLayout == TensorLayout::NHWC && OutLayout == TensorLayout::NHWC) {
         ACCDATA_ERROR("Unimplemented NHWC to NHWC.");
         errCode = AccDataErrorCode::H_FUSIONOP_ERROR;
@@ -239,7 +249,8 @@ void ToTensorResizeCropNormalize::RunTask(const InputType *input, OutputType *ou
 }
 
 template <typename InputType, typename OutputType>
-void ToTensorResizeCropNormalize::Kernel2NCHW(const InputType *input, OutputType *output, const OperatorParam &param)
+AccDataErrorCode ToTensorResizeCropNormalize::Kernel2NCHW(const InputType *input, OutputType *output,
+                                                          const OperatorParam &param)
 {
     auto ch = mCropArgs.Height();
     auto cw = mCropArgs.Width();
@@ -250,34 +261,41 @@ void ToTensorResizeCropNormalize::Kernel2NCHW(const InputType *input, OutputType
     auto cropH = mCropArgs.Height();
     auto cropW = mCropArgs.Width();
 
-    auto scaleX = (OutputType *)aligned_alloc(ACCDATA_ALIGN_SIZE, AlignUp(resizeW, sizeof(OutputType)));
-    auto scaleY = (OutputType *)aligned_alloc(ACCDATA_ALIGN_SIZE, AlignUp(resizeH, sizeof(OutputType)));
-    auto depX = (int *)aligned_alloc(ACCDATA_ALIGN_SIZE, AlignUp(resizeW, sizeof(int)));
-    auto depY = (int *)aligned_alloc(ACCDATA_ALIGN_SIZE, AlignUp(resizeH, sizeof(int)));
-    // Allocate space for f(x,y0) and f(x, y1) in 3 channels, thus 2 * 3 = 6
-    auto space = (OutputType *)aligned_alloc(ACCDATA_ALIGN_SIZE, AlignUp(cropW * 6, sizeof(OutputType)));
+    auto &arena = ScratchArena::ThreadLocal();
+    auto scaleX = static_cast<ResultType *>(arena.AllocateBytes(AlignUp(resizeW, sizeof(ResultType))));
+    auto scaleY = static_cast<ResultType *>(arena.AllocateBytes(AlignUp(resizeH, sizeof(ResultType))));
+    auto depX = static_cast<int *>(arena.AllocateBytes(AlignUp(resizeW, sizeof(int))));
+    auto depY = static_cast<int *>(arena.AllocateBytes(AlignUp(resizeH, sizeof(int))));
+    // Allocate space for f(x,y0) and f(x, y1) in 3 channels, thus 2 * 3 = 6, plus one normalized row which is
+    // converted to the half precision output
+    auto space = static_cast<ResultType *>(arena.AllocateBytes(AlignUp(cropW * 7, sizeof(ResultType))));
+    if (scaleX == nullptr || scaleY == nullptr || depX == nullptr || depY == nullptr || space == nullptr) {
+        ACCDATA_ERROR("Failed to allocate the resize buffers.");
+        return AccDataErrorCode::H_FUSIONOP_ERROR;
+    }
 
     // precompute coefficient
-    auto widthScale = static_cast<OutputType>(mInputMeta.Width()) / static_cast<OutputType>(resizeW);
-    auto heightScale = static_cast<OutputType>(mInputMeta.Height()) / static_cast<OutputType>(resizeH);
+    auto widthScale = static_cast<ResultType>(mInputMeta.Width()) / static_cast<ResultType>(resizeW);
+    auto heightScale = static_cast<ResultType>(mInputMeta.Height()) / static_cast<ResultType>(resizeH);
 
     for (int64_t x = param.cropOffsetX; x < param.cropOffsetX + cropW; ++x) {
-        OutputType fdx = std::max((x + 0.5) * widthScale - 0.5, 0.0);
+        ResultType fdx = std::max((x + 0.5) * widthScale - 0.5, 0.0);
         int idx = depX[x] = static_cast<int>(fdx);
         scaleX[x] = 1.0 + idx - fdx;
     }
     for (int64_t y = param.cropOffsetY; y < param.cropOffsetY + cropH; ++y) {
-        OutputType fdy = std::max((y + 0.5) * heightScale - 0.5, 0.0);
+        ResultType fdy = std::max((y + 0.5) * heightScale - 0.5, 0.0);
         int idx = depY[y] = static_cast<int>(fdy);
         scaleY[y] = 1.0 + idx - fdy;
     }
 
-    auto c00 = (OutputType *)space;  // f(x, y0) for channel 1
+    auto c00 = (ResultType *)space;  // f(x, y0) for channel 1
     auto c01 = c00 + cw;          // f(x, y1) for channel 1
     auto c02 = c01 + cw;          // f(x, y0) for channel 2
     auto c10 = c02 + cw;          // f(x, y1) for channel 2
     auto c11 = c10 + cw;          // f(x, y0) for channel 3
     auto c12 = c11 + cw;          // f(x, y1) for channel 3
+    auto normRow = c12 + cw;      // normalized row before the conversion to OutputType
 
     for (auto sample = param.begin; sample < param.end; ++sample) {
         auto src = input + sample * hwcOrigin;
@@ -291,38 +309,39 @@ void ToTensorResizeCropNormalize::Kernel2NCHW(const InputType *input, OutputType
             auto sy1 = 1.0f - sy0;
 
             if (y0 - oy >= RGB_CHANNEL_BLUE) {
-                Compute3ChannelLine<InputType, OutputType>(src + y0 * param.width * param.channel, c00, c01, c02,
+                Compute3ChannelLine<InputType, ResultType>(src + y0 * param.width * param.channel, c00, c01, c02,
                                                            param.width, cw, depX + param.cropOffsetX,
                                                            scaleX + param.cropOffsetX, mToTensorArgs.Mul());
-                Compute3ChannelLine<InputType, OutputType>(src + y1 * param.width * param.channel, c10, c11, c12,
+                Compute3ChannelLine<InputType, ResultType>(src + y1 * param.width * param.channel, c10, c11, c12,
                                                            param.width, cw, depX + param.cropOffsetX,
                                                            scaleX + param.cropOffsetX, mToTensorArgs.Mul());
             } else if (y0 - oy == 1) {
                 std::swap(c00, c10);
                 std::swap(c01, c11);
                 std::swap(c02, c12);
-                Compute3ChannelLine<InputType, OutputType>(src + y1 * param.width * param.channel, c10, c11, c12,
+                Compute3ChannelLine<InputType, ResultType>(src + y1 * param.width * param.channel, c10, c11, c12,
                                                            param.width, cw, depX + param.cropOffsetX,
                                                            scaleX + param.cropOffsetX, mToTensorArgs.Mul());
             }
             oy = y0;
-            Add2LinesAndNorm<OutputType>(c00, c10, dst + RGB_CHANNEL_RED * cw * ch + (y - param.cropOffsetY) * cw, cw,
-                                         sy0, sy1, (OutputType)mNormArgs.Mean()[RGB_CHANNEL_RED],
-                                         (OutputType)mNormArgs.Scale()[RGB_CHANNEL_RED]);
-            Add2LinesAndNorm<OutputType>(c01, c11, dst + RGB_CHANNEL_GREEN * cw * ch + (y - param.cropOffsetY) * cw, cw,
-                                         sy0, sy1, (OutputType)mNormArgs.Mean()[RGB_CHANNEL_GREEN],
-                                         (OutputType)mNormArgs.Scale()[RGB_CHANNEL_GREEN]);
-            Add2LinesAndNorm<OutputType>(c02, c12, dst + RGB_CHANNEL_BLUE * cw * ch + (y - param.cropOffsetY) * cw, cw,
-                                         sy0, sy1, (OutputType)mNormArgs.Mean()[RGB_CHANNEL_BLUE],
-                                         (OutputType)mNormArgs.Scale()[RGB_CHANNEL_BLUE]);
+            auto storeLine = [&](const ResultType *s0, const ResultType *s1, int channel) {
+                OutputType *line = dst + channel * cw * ch + (y - param.cropOffsetY) * cw;
+                ResultType *target = normRow;
+                if constexpr (std::is_same_v<OutputType, ResultType>) {
+                    target = line;
+                }
+                Add2LinesAndNorm<ResultType>(s0, s1, target, cw, sy0, sy1, (ResultType)mNormArgs.Mean()[channel],
+                                             (ResultType)mNormArgs.Scale()[channel]);
+                if constexpr (!std::is_same_v<OutputType, ResultType>) {
+                    ConvertFloatRow(normRow, line, cw);
+                }
+            };
+            storeLine(c00, c10, RGB_CHANNEL_RED);
+            storeLine(c01, c11, RGB_CHANNEL_GREEN);
+            storeLine(c02, c12, RGB_CHANNEL_BLUE);
         }
     }
-
-    free(scaleX);
-    free(scaleY);
-    free(depX);
-    free(depY);
-    free(space);
+    return AccDataErrorCode::H_OK;
 }
 ACCDATA_REGISTER_FUSION_OPERATOR(ToTensorResizeCropNormalize, ToTensorResizeCropNormalize);
 
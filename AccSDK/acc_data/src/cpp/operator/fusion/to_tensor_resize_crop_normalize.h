@@ -43,7 +43,7 @@ namespace accdata {
  * SCHEMA END
  */
 class ToTensorResizeCropNormalize : public Operator {
-    using ResultType = float;  // Now assume the output datatype is float.
+    using ResultType = float;  // Compute type, the output is converted to the dtype argument on the store.
 public:
     explicit ToTensorResizeCropNormalize(const OpSpec &spec) : Operator(spec)
     {
@@ -70,7 +70,7 @@ private:
     void RunTask(const InputType *input, OutputType *output, const OperatorParam &param, AccDataErrorCode &errCode);
 
     template <typename InputType, typename OutputType>
-    void Kernel2NCHW(const InputType *input, OutputType *output, const OperatorParam &param);
+    AccDataErrorCode Kernel2NCHW(const InputType *input, OutputType *output, const OperatorParam &param);
 
     template <typename InputType, typename OutputType>
     inline int Compute3ChannelLine(const InputType *src, OutputType *dst0, OutputType *dst1, OutputType *dst2, int sw,
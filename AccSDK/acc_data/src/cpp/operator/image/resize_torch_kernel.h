@@ -30,6 +30,7 @@
 #include "pipeline/workspace/workspace.h"
 #include "tensor/tensor_image.h"
 #include "common/balance.h"
+#include "accdata_scratch_arena.h"
 
 namespace acclib {
 namespace accdata {
@@ -56,10 +57,10 @@ struct CalcPixParams {
 };
 
 template <typename T>
-void CalcPixBilinear(CalcPixParams<T> param, std::array<std::vector<T>, 2ULL> lambdas,
-                     std::array<std::vector<int>, 2ULL> iws, const T* srcPtr, T* dstPtr, AccDataErrorCode &errCode)
+void CalcPixBilinear(CalcPixParams<T> param, std::array<const T*, 2ULL> lambdas,
+                     std::array<const int*, 2ULL> iws, const T* srcPtr, T* dstPtr, AccDataErrorCode &errCode)
 {
-    T* space4UpperLowerValue = reinterpret_cast<T*>(aligned_alloc(256, param.tw * ROW_CNT * sizeof(T)));
+    T* space4UpperLowerValue = ScratchArena::ThreadLocal().Allocate<T>(static_cast<int64_t>(param.tw) * ROW_CNT);
     if (space4UpperLowerValue == nullptr) {
         ACCDATA_ERROR("In torch bilinar alloc space failed.");
         errCode = AccDataErrorCode::H_SINGLEOP_ERROR;
@@ -107,7 +108,6 @@ void CalcPixBilinear(CalcPixParams<T> param, std::array<std::vector<T>, 2ULL> la
         }
     }
 
-    free(space4UpperLowerValue);
     errCode = AccDataErrorCode::H_OK;
 }
 
@@ -137,10 +137,16 @@ AccDataErrorCode TorchBilinear(const Tensor& src, Tensor& dst, int rh, int rw, i
     int sh = static_cast<int>(inputMeta.Height());
     int sw = static_cast<int>(inputMeta.Width());
 
-    std::vector<int> iw0(tw);  // 左侧像素索引
-    std::vector<int> iw1(tw);  // 右侧像素索引
-    std::vector<T> w0lambda(tw);  // 与左侧邻域像素插值权重
-    std::vector<T> w1lambda(tw);  // 与右侧邻域像素插值权重
+    // 水平方向的索引和权重表在本线程的scratch arena中,任务执行完之前不释放
+    ScratchScope scratch;
+    int* iw0 = scratch.Arena().Allocate<int>(tw);  // 左侧像素索引
+    int* iw1 = scratch.Arena().Allocate<int>(tw);  // 右侧像素索引
+    T* w0lambda = scratch.Arena().Allocate<T>(tw);  // 与左侧邻域像素插值权重
+    T* w1lambda = scratch.Arena().Allocate<T>(tw);  // 与右侧邻域像素插值权重
+    if (iw0 == nullptr || iw1 == nullptr || w0lambda == nullptr || w1lambda == nullptr) {
+        ACCDATA_ERROR("In torch bilinar alloc space failed.");
+        return AccDataErrorCode::H_SINGLEOP_ERROR;
+    }
 
     T widthScale = static_cast<T>(sw) / static_cast<T>(rw);  // 水平方向缩放系数
     T heightScale = static_cast<T>(sh) / static_cast<T>(rh);  // 垂直方向缩放系数
@@ -165,7 +171,11 @@ AccDataErrorCode TorchBilinear(const Tensor& src, Tensor& dst, int rh, int rw, i
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to get threads number.", errCode);
     for (int t = 0; t < nts; t++) {
         errCode = Balance::Assign(batchsize * channels, nts, t, range);
-        ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to distribute tasks.", errCode);
+        if (errCode != AccDataErrorCode::H_OK) {
+            ws.GetThreadPool().RunAll();  // 已添加的任务读取scratch中的表,须在其释放前执行完
+            ACCDATA_ERROR("Failed to distribute tasks.");
+            return errCode;
+        }
         if (range.begin >= range.end) {
             break;
         }
@@ -214,9 +224,20 @@ struct T4 {
 };
 
 template <typename T>
-void CalcPixBicubic(CalcPixParams<T> param, std::array<std::vector<int>, 4> iws, std::vector<T4<T>> scaleX,
-                    const T* srcPtr, T* dstPtr, AccDataErrorCode &errCode = AccDataErrorCode::H_OK)
+void CalcPixBicubic(CalcPixParams<T> param, std::array<const int*, 4> iws, const T4<T>* scaleX,
+                    const T* srcPtr, T* dstPtr, AccDataErrorCode &errCode)
 {
+    // 存放四行水平插值结果的数组,每行长度为tw
+    T* c0 = ScratchArena::ThreadLocal().Allocate<T>(static_cast<int64_t>(param.tw) * 4);
+    if (c0 == nullptr) {
+        ACCDATA_ERROR("In torch bicubic alloc space failed.");
+        errCode = AccDataErrorCode::H_SINGLEOP_ERROR;
+        return;
+    }
+    T* c1 = c0 + param.tw;
+    T* c2 = c1 + param.tw;
+    T* c3 = c2 + param.tw;
+
     for (int idx = param.range.begin; idx < param.range.end; idx++) {
         int s = idx / param.channels;
         int c = idx % param.channels;
@@ -237,11 +258,6 @@ void CalcPixBicubic(CalcPixParams<T> param, std::array<std::vector<int>, 4> iws,
             int ih2 = Clip(fh1 + 1, 0, param.sh);
             int ih3 = Clip(fh1 + 2, 0, param.sh);
 
-            std::vector<T> c0(param.tw);
-            std::vector<T> c1(param.tw);
-            std::vector<T> c2(param.tw);
-            std::vector<T> c3(param.tw);
-
             // 假设取映射点P周围16个像素,a00到a33(P位于a11),value(P)=∑(0<=i<=3)∑(0<=j<=3)aij * W(i) * W(j)
             for (int ow = 0; ow < param.tw; ++ow) {
                 c0[ow] = scaleX[ow].values[LEFT_UPPER] * spPtr[ih0 * param.sw + iws[LEFT_UPPER][ow]] +
@@ -272,6 +288,7 @@ void CalcPixBicubic(CalcPixParams<T> param, std::array<std::vector<int>, 4> iws,
             }
         }
     }
+    errCode = AccDataErrorCode::H_OK;
 }
 
 /**
@@ -298,11 +315,16 @@ AccDataErrorCode TorchBicubic(const Tensor& src, Tensor& dst, int rh, int rw, in
     int sh = static_cast<int>(inputMeta.Height());
     int sw = static_cast<int>(inputMeta.Width());
 
-    std::vector<int> iw0(tw);
-    std::vector<int> iw1(tw);
-    std::vector<int> iw2(tw);
-    std::vector<int> iw3(tw);
-    std::vector<T4<T>> scaleX(tw);
+    ScratchScope scratch;
+    int* iw0 = scratch.Arena().Allocate<int>(tw);
+    int* iw1 = scratch.Arena().Allocate<int>(tw);
+    int* iw2 = scratch.Arena().Allocate<int>(tw);
+    int* iw3 = scratch.Arena().Allocate<int>(tw);
+    T4<T>* scaleX = scratch.Arena().Allocate<T4<T>>(tw);
+    if (iw0 == nullptr || iw1 == nullptr || iw2 == nullptr || iw3 == nullptr || scaleX == nullptr) {
+        ACCDATA_ERROR("In torch bicubic alloc space failed.");
+        return AccDataErrorCode::H_SINGLEOP_ERROR;
+    }
 
     T widthScale = static_cast<T>(sw) / static_cast<T>(rw);
     T heightScale = static_cast<T>(sh) / static_cast<T>(rh);
@@ -328,7 +350,11 @@ AccDataErrorCode TorchBicubic(const Tensor& src, Tensor& dst, int rh, int rw, in
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to get threads number", errCode);
     for (int t = 0; t < nts; t++) {
         errCode = Balance::Assign(batchsize * channels, nts, t, range);
-        ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to distribute tasks.", errCode);
+        if (errCode != AccDataErrorCode::H_OK) {
+            ws.GetThreadPool().RunAll();
+            ACCDATA_ERROR("Failed to distribute tasks.");
+            return errCode;
+        }
         if (range.begin >= range.end) {
             break;
         }
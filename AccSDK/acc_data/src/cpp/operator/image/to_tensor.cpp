@@ -23,6 +23,7 @@
 
 #include "to_tensor.h"
 
+#include <algorithm>
 #include <atomic>
 
 #include "operator/op_factory.h"
@@ -31,6 +32,9 @@
 
 namespace acclib {
 namespace accdata {
+namespace {
+constexpr int64_t TO_TENSOR_CHUNK_SIZE = 512; // elements per channel computed in float before a store
+} // namespace
 
 AccDataErrorCode ToTensor::Run(Workspace &ws)
 {
@@ -59,7 +63,7 @@ AccDataErrorCode ToTensor::Run(Workspace &ws)
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK,
                                    "Failed to get output shape.", errCode);
 
-    errCode = output.Resize<float>(outputShape);
+    errCode = output.Resize(outputShape, mToTensorArgs.OutputDataType());
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to resize.", errCode);
 
     auto &pool = ws.GetThreadPool();
@@ -67,7 +71,17 @@ AccDataErrorCode ToTensor::Run(Workspace &ws)
     for (int i = 0; i < numTensors; ++i) {
         auto &in = input[i];
         auto &out = output[i];
-        errCode = AddTask<uint8_t, float>(pool, in, out);
+        switch (mToTensorArgs.OutputDataType()) {
+            case TensorDataType::FP16:
+                errCode = AddTask<uint8_t, Float16>(pool, in, out);
+                break;
+            case TensorDataType::BF16:
+                errCode = AddTask<uint8_t, BFloat16>(pool, in, out);
+                break;
+            default:
+                errCode = AddTask<uint8_t, float>(pool, in, out);
+                break;
+        }
         ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to add task.", errCode);
     }
     errCode = pool.RunAll();
@@ -155,8 +169,19 @@ AccDataErrorCode ToTensor::AddTaskSameLayout(ThreadPool &pool, const Tensor &inp
             break;
         }
         auto task = [this, in, out, range, mul](int id, AccDataErrorCode &errCode = AccDataErrorCode::H_OK) {
-            for (int64_t j = range.begin; j < range.end; ++j) {
-                out[j] = in[j] * mul;
+            if constexpr (std::is_same_v<OutputType, float>) {
+                for (int64_t j = range.begin; j < range.end; ++j) {
+                    out[j] = in[j] * mul;
+                }
+            } else {
+                float buffer[TO_TENSOR_CHUNK_SIZE];
+                for (int64_t j = range.begin; j < range.end; j += TO_TENSOR_CHUNK_SIZE) {
+                    int64_t length = std::min(TO_TENSOR_CHUNK_SIZE, range.end - j);
+                    for (int64_t k = 0; k < length; ++k) {
+                        buffer[k] = in[j + k] * mul;
+                    }
+                    ConvertFloatRow(buffer, out + j, length);
+                }
             }
         };
         pool.AddTask(task);
@@ -218,22 +243,41 @@ void ToTensor::RunTask(const InputType *input, const OperatorParam param, Output
     }
 }
 
+/**
+ * @brief HWC -> CHW in chunks of pixels, results of a half precision output are gathered per channel in float
+ *        and converted with one vector store per channel row.
+ */
 template <typename InputType, typename OutputType>
 void ToTensor::Trans2NCHW(const InputType *input, const OperatorParam &param, OutputType *output)
 {
-    auto resolution = param.height * param.width;
+    int64_t resolution = static_cast<int64_t>(param.height * param.width);
     auto hwc = resolution * param.channel;
     auto mul = mToTensorArgs.Mul();
+    float buffer[RGB_CHANNELS][TO_TENSOR_CHUNK_SIZE];
 
     for (auto i = param.begin; i < param.end; ++i) {
         auto offset = i * hwc;
-        for (uint64_t j = 0; j < resolution; ++j) {
-            output[offset + RGB_CHANNEL_RED * resolution + j] =
-                input[offset + RGB_CHANNELS * j + RGB_CHANNEL_RED] * mul;
-            output[offset + RGB_CHANNEL_GREEN * resolution + j] =
-                input[offset + RGB_CHANNELS * j + RGB_CHANNEL_GREEN] * mul;
-            output[offset + RGB_CHANNEL_BLUE * resolution + j] =
-                input[offset + RGB_CHANNELS * j + RGB_CHANNEL_BLUE] * mul;
+        for (int64_t j0 = 0; j0 < resolution; j0 += TO_TENSOR_CHUNK_SIZE) {
+            int64_t length = std::min(TO_TENSOR_CHUNK_SIZE, resolution - j0);
+            float *dst[RGB_CHANNELS];
+            for (int c = 0; c < RGB_CHANNELS; ++c) {
+                if constexpr (std::is_same_v<OutputType, float>) {
+                    dst[c] = output + offset + c * resolution + j0;
+                } else {
+                    dst[c] = buffer[c];
+                }
+            }
+            const InputType *src = input + offset + RGB_CHANNELS * j0;
+            for (int64_t j = 0; j < length; ++j) {
+                dst[RGB_CHANNEL_RED][j] = src[RGB_CHANNELS * j + RGB_CHANNEL_RED] * mul;
+                dst[RGB_CHANNEL_GREEN][j] = src[RGB_CHANNELS * j + RGB_CHANNEL_GREEN] * mul;
+                dst[RGB_CHANNEL_BLUE][j] = src[RGB_CHANNELS * j + RGB_CHANNEL_BLUE] * mul;
+            }
+            if constexpr (!std::is_same_v<OutputType, float>) {
+                for (int c = 0; c < RGB_CHANNELS; ++c) {
+                    ConvertFloatRow(buffer[c], output + offset + c * resolution + j0, length);
+                }
+            }
         }
     }
 }
@@ -241,19 +285,28 @@ void ToTensor::Trans2NCHW(const InputType *input, const OperatorParam &param, Ou
 template <typename InputType, typename OutputType>
 void ToTensor::Trans2NHWC(const InputType *input, const OperatorParam &param, OutputType *output)
 {
-    auto resolution = param.height * param.width;
+    int64_t resolution = static_cast<int64_t>(param.height * param.width);
     auto hwc = resolution * param.channel;
     auto mul = mToTensorArgs.Mul();
+    float buffer[RGB_CHANNELS * TO_TENSOR_CHUNK_SIZE];
 
     for (auto i = param.begin; i < param.end; ++i) {
         auto offset = i * hwc;
-        for (uint64_t j = 0; j < resolution; ++j) {
-            output[offset + RGB_CHANNELS * j + RGB_CHANNEL_RED] =
-                input[offset + RGB_CHANNEL_RED * resolution + j] * mul;
-            output[offset + RGB_CHANNELS * j + RGB_CHANNEL_GREEN] =
-                input[offset + RGB_CHANNEL_GREEN * resolution + j] * mul;
-            output[offset + RGB_CHANNELS * j + RGB_CHANNEL_BLUE] =
-                input[offset + RGB_CHANNEL_BLUE * resolution + j] * mul;
+        for (int64_t j0 = 0; j0 < resolution; j0 += TO_TENSOR_CHUNK_SIZE) {
+            int64_t length = std::min(TO_TENSOR_CHUNK_SIZE, resolution - j0);
+            float *dst = buffer;
+            if constexpr (std::is_same_v<OutputType, float>) {
+                dst = output + offset + RGB_CHANNELS * j0;
+            }
+            const InputType *src = input + offset + j0;
+            for (int64_t j = 0; j < length; ++j) {
+                dst[RGB_CHANNELS * j + RGB_CHANNEL_RED] = src[RGB_CHANNEL_RED * resolution + j] * mul;
+                dst[RGB_CHANNELS * j + RGB_CHANNEL_GREEN] = src[RGB_CHANNEL_GREEN * resolution + j] * mul;
+                dst[RGB_CHANNELS * j + RGB_CHANNEL_BLUE] = src[RGB_CHANNEL_BLUE * resolution + j] * mul;
+            }
+            if constexpr (!std::is_same_v<OutputType, float>) {
+                ConvertFloatRow(buffer, output + offset + RGB_CHANNELS * j0, RGB_CHANNELS * length);
+            }
         }
     }
 }
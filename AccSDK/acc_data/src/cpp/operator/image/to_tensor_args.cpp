@@ -40,6 +40,18 @@ namespace accdata {
         return AccDataErrorCode::H_COMMON_OPERATOR_ERROR;
     }
 
+    int64_t dtype = static_cast<int64_t>(TensorDataType::FP32);
+    if (spec.HasArg("dtype")) {
+        errCode = spec.GetArg<int64_t>("dtype", dtype);
+        ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to get arguments.", errCode);
+    }
+    mDataType = static_cast<TensorDataType>(dtype);
+    if (mDataType != TensorDataType::FP32 && mDataType != TensorDataType::FP16 &&
+        mDataType != TensorDataType::BF16) {
+        ACCDATA_ERROR("The output datatype should be FP32, FP16 or BF16.");
+        return AccDataErrorCode::H_COMMON_OPERATOR_ERROR;
+    }
+
     auto &inputTensorList = ws.GetInput(0, errCode);
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to get input.", errCode);
 
@@ -37,6 +37,7 @@ namespace accdata {
  * Optional argument:
  * - layout: The layout of the output which should be 'TensorLayout::NHWC' or 'TensorLayout::NCHW'.
  *          Default is 'TensorLayout::NHWC'.
+ * - dtype: The datatype of the output, one of FP32, FP16 and BF16. Default is FP32.
  */
 class ToTensorArgs {
 public:
@@ -64,6 +65,12 @@ public:
         return mSameLayout;
     }
 
+    /** @brief  datatype of the output */
+    inline TensorDataType OutputDataType() const
+    {
+        return mDataType;
+    }
+
     /** @brief  the factor to multiple to change an uint8_t to float, use 1/255.0 as default */
     inline double Mul() const
     {
@@ -73,6 +80,7 @@ public:
 private:
     TensorLayout mLayout{ TensorLayout::NCHW };
     bool mSameLayout{ true };
+    TensorDataType mDataType{ TensorDataType::FP32 };
 };
 
 }  // namespace accdata
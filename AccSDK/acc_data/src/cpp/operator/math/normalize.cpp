@@ -23,7 +23,10 @@
 
 #include "normalize.h"
 
+#include <algorithm>
+#ifdef __ARM_NEON
 #include <arm_neon.h>
+#endif
 
 #include "operator/op_factory.h"
 #include "common/balance.h"
@@ -33,7 +36,102 @@
 namespace acclib {
 namespace accdata {
 
-using OutputType = float;  // Now assume the output datatype is float.
+namespace {
+constexpr uint64_t NORM_CHUNK_SIZE = 1024; // elements normalized in float before a half precision store
+
+/**
+ * @brief out = (in - mean) * scale over a contiguous span of one channel, computed in float.
+ */
+template <typename InputType>
+void NormalizeSpan(const InputType *input, float *output, uint64_t length, float mean, float scale)
+{
+    uint64_t j = 0;
+#ifdef __ARM_NEON
+    if constexpr (std::is_same_v<InputType, float>) {
+        float32x4_t meanValue = vdupq_n_f32(mean);
+        float32x4_t scaleValue = vdupq_n_f32(scale);
+        for (; j + 4 <= length; j += 4) {    // 128位寄存器可以放4个float32,数据不足四个时单独处理
+            float32x4_t datas = vld1q_f32(&input[j]);
+            datas = vsubq_f32(datas, meanValue);
+            datas = vmulq_f32(datas, scaleValue);
+            vst1q_f32(&output[j], datas);
+        }
+    }
+#endif
+    for (; j < length; ++j) {
+        output[j] = (input[j] - mean) * scale;
+    }
+}
+
+#ifdef __ARM_NEON
+inline float32x4_t WidenLow(uint16x8_t value)
+{
+    return vcvtq_f32_u32(vmovl_u16(vget_low_u16(value)));
+}
+
+inline float32x4_t WidenHigh(uint16x8_t value)
+{
+    return vcvtq_f32_u32(vmovl_u16(vget_high_u16(value)));
+}
+#endif
+
+/**
+ * @brief out = in * mul + bias over a contiguous span of one uint8 channel, one fused multiply-add per element.
+ */
+void NormalizePixelSpan(const uint8_t *input, float *output, uint64_t length, float mul, float bias)
+{
+    uint64_t j = 0;
+#ifdef __ARM_NEON
+    float32x4_t mulValue = vdupq_n_f32(mul);
+    float32x4_t biasValue = vdupq_n_f32(bias);
+    for (; j + 16 <= length; j += 16) {
+        uint8x16_t pixels = vld1q_u8(&input[j]);
+        uint16x8_t low = vmovl_u8(vget_low_u8(pixels));
+        uint16x8_t high = vmovl_u8(vget_high_u8(pixels));
+        vst1q_f32(&output[j], vfmaq_f32(biasValue, WidenLow(low), mulValue));
+        vst1q_f32(&output[j + 4], vfmaq_f32(biasValue, WidenHigh(low), mulValue));
+        vst1q_f32(&output[j + 8], vfmaq_f32(biasValue, WidenLow(high), mulValue));
+        vst1q_f32(&output[j + 12], vfmaq_f32(biasValue, WidenHigh(high), mulValue));
+    }
+#endif
+    for (; j < length; ++j) {
+        output[j] = input[j] * mul + bias;
+    }
+}
+
+/**
+ * @brief Interleaved 3 channels version of the uint8 span above.
+ */
+void NormalizePixels(const uint8_t *input, float *output, uint64_t numPixels, const float *mul, const float *bias)
+{
+    constexpr uint64_t channels = 3;
+    uint64_t i = 0;
+#ifdef __ARM_NEON
+    float32x4_t mulValue[channels] = {vdupq_n_f32(mul[0]), vdupq_n_f32(mul[1]), vdupq_n_f32(mul[2])};
+    float32x4_t biasValue[channels] = {vdupq_n_f32(bias[0]), vdupq_n_f32(bias[1]), vdupq_n_f32(bias[2])};
+    for (; i + 16 <= numPixels; i += 16) {    // vld3 splits 16 RGB pixels into the 3 channels
+        uint8x16x3_t pixels = vld3q_u8(input + i * channels);
+        float32x4x3_t result[4];
+        for (uint64_t c = 0; c < channels; ++c) {
+            uint16x8_t low = vmovl_u8(vget_low_u8(pixels.val[c]));
+            uint16x8_t high = vmovl_u8(vget_high_u8(pixels.val[c]));
+            result[0].val[c] = vfmaq_f32(biasValue[c], WidenLow(low), mulValue[c]);
+            result[1].val[c] = vfmaq_f32(biasValue[c], WidenHigh(low), mulValue[c]);
+            result[2].val[c] = vfmaq_f32(biasValue[c], WidenLow(high), mulValue[c]);
+            result[3].val[c] = vfmaq_f32(biasValue[c], WidenHigh(high), mulValue[c]);
+        }
+        for (uint64_t k = 0; k < 4; ++k) {
+            vst3q_f32(output + (i + k * 4) * channels, result[k]);
+        }
+    }
+#endif
+    for (; i < numPixels; ++i) {
+        for (uint64_t c = 0; c < channels; ++c) {
+            output[i * channels + c] = input[i * channels + c] * mul[c] + bias[c];
+        }
+    }
+}
+} // namespace
 
 AccDataErrorCode Normalize::Run(Workspace& ws)
 {
@@ -55,7 +153,7 @@ AccDataErrorCode Normalize::Run(Workspace& ws)
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to set up the normalize operator",
                                    errCode);
 
-    errCode = outputList.Resize<OutputType>(inputList.Shape());
+    errCode = outputList.Resize(inputList.Shape(), mNormalizeArgs.OutputDataType());
     ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to resize.", errCode);
 
     int numTensors = inputList.NumTensors();
@@ -105,9 +203,27 @@ AccDataErrorCode Normalize::AddTask(ThreadPool& pool, const Tensor& input, Tenso
 {
     switch (input.DataType()) {
         case TensorDataType::FP32:
-            return AddTask<float, OutputType>(pool, input, output);
+            return AddTaskByOutput<float>(pool, input, output);
+        case TensorDataType::UINT8:
+            return AddTaskByOutput<uint8_t>(pool, input, output);
         default:
-            ACCDATA_ERROR("The datatype of Normalize input should be float.");
+            ACCDATA_ERROR("The datatype of Normalize input should be float or uint8.");
+            return AccDataErrorCode::H_SINGLEOP_ERROR;
+    }
+}
+
+template <typename InputType>
+AccDataErrorCode Normalize::AddTaskByOutput(ThreadPool& pool, const Tensor& input, Tensor& output)
+{
+    switch (output.DataType()) {
+        case TensorDataType::FP32:
+            return AddTask<InputType, float>(pool, input, output);
+        case TensorDataType::FP16:
+            return AddTask<InputType, Float16>(pool, input, output);
+        case TensorDataType::BF16:
+            return AddTask<InputType, BFloat16>(pool, input, output);
+        default:
+            ACCDATA_ERROR("Unsupported output datatype '" << output.DataType() << "'.");
             return AccDataErrorCode::H_SINGLEOP_ERROR;
     }
 }
@@ -186,17 +302,36 @@ void Normalize::RunHWC(const InputType* input, const OperatorParam& param, Outpu
 {
     auto& mean = mNormalizeArgs.Mean();
     auto& scale = mNormalizeArgs.Scale();
+    auto& pixelMul = mNormalizeArgs.PixelMul();
+    auto& pixelBias = mNormalizeArgs.PixelBias();
     auto begin = param.begin * param.height * param.width;
     auto end = param.end * param.height * param.width;
     constexpr int channelRed = 0;
     constexpr int channelGreen = 1;
     constexpr int channelBlue = 2;
-    for (uint64_t i = begin; i < end; ++i) {
-        output[i * param.channel] = (input[i * param.channel] - mean[channelRed]) * scale[channelRed];
-        output[i * param.channel + channelGreen] =
-            (input[i * param.channel + channelGreen] - mean[channelGreen]) * scale[channelGreen];
-        output[i * param.channel + channelBlue] =
-            (input[i * param.channel + channelBlue] - mean[channelBlue]) * scale[channelBlue];
+    auto normalizePixels = [&](const InputType *in, float *out, uint64_t numPixels) {
+        if constexpr (std::is_same_v<InputType, uint8_t>) {
+            NormalizePixels(in, out, numPixels, pixelMul.data(), pixelBias.data());
+        } else {
+            for (uint64_t i = 0; i < numPixels; ++i) {
+                out[i * param.channel] = (in[i * param.channel] - mean[channelRed]) * scale[channelRed];
+                out[i * param.channel + channelGreen] =
+                    (in[i * param.channel + channelGreen] - mean[channelGreen]) * scale[channelGreen];
+                out[i * param.channel + channelBlue] =
+                    (in[i * param.channel + channelBlue] - mean[channelBlue]) * scale[channelBlue];
+            }
+        }
+    };
+    if constexpr (std::is_same_v<OutputType, float>) {
+        normalizePixels(input + begin * param.channel, output + begin * param.channel, end - begin);
+    } else {
+        float buffer[NORM_CHUNK_SIZE];
+        uint64_t chunkPixels = NORM_CHUNK_SIZE / param.channel;
+        for (uint64_t i = begin; i < end; i += chunkPixels) {
+            uint64_t numPixels = std::min(chunkPixels, end - i);
+            normalizePixels(input + i * param.channel, buffer, numPixels);
+            ConvertFloatRow(buffer, output + i * param.channel, static_cast<int64_t>(numPixels * param.channel));
+        }
     }
     return;
 }
@@ -204,26 +339,30 @@ void Normalize::RunHWC(const InputType* input, const OperatorParam& param, Outpu
 template <typename InputType, typename OutputType>
 void Normalize::RunCHW(const InputType* input, const OperatorParam& param, OutputType* output)
 {
-    auto& mean = mNormalizeArgs.Mean();
-    auto& scale = mNormalizeArgs.Scale();
     auto begin = param.begin * param.channel;
     auto end = param.end * param.channel;
     auto resolution = param.height * param.width;
+    auto normalizeSpan = [this](const InputType *in, float *out, uint64_t length, uint32_t channel) {
+        if constexpr (std::is_same_v<InputType, uint8_t>) {
+            NormalizePixelSpan(in, out, length, mNormalizeArgs.PixelMul()[channel],
+                               mNormalizeArgs.PixelBias()[channel]);
+        } else {
+            NormalizeSpan(in, out, length, mNormalizeArgs.Mean()[channel], mNormalizeArgs.Scale()[channel]);
+        }
+    };
 
     for (uint64_t i = begin; i < end; ++i) {
         uint32_t channel = i % 3;
         uint64_t offset = i * resolution;
-        float32x4_t meanValue = vdupq_n_f32(mean[channel]);
-        float32x4_t scaleValue = vdupq_n_f32(scale[channel]);
-        uint64_t j = 0;
-        for (; j < resolution - 3; j += 4) {    // 128位寄存器可以放4个float32,数据不足四个时单独处理
-            float32x4_t datas = vld1q_f32(&input[offset + j]);
-            datas = vsubq_f32(datas, meanValue);
-            datas = vmulq_f32(datas, scaleValue);
-            vst1q_f32(&output[offset + j], datas);
-        }
-        for (; j < resolution; ++j) {
-            output[offset + j] = (input[offset + j] - mean[channel]) * scale[channel];
+        if constexpr (std::is_same_v<OutputType, float>) {
+            normalizeSpan(input + offset, output + offset, resolution, channel);
+        } else {
+            float buffer[NORM_CHUNK_SIZE];
+            for (uint64_t j = 0; j < resolution; j += NORM_CHUNK_SIZE) {
+                uint64_t length = std::min(NORM_CHUNK_SIZE, resolution - j);
+                normalizeSpan(input + offset + j, buffer, length, channel);
+                ConvertFloatRow(buffer, output + offset + j, static_cast<int64_t>(length));
+            }
         }
     }
     return;
@@ -36,6 +36,8 @@ namespace accdata {
  *
  * Normalizes the input by removing the mean and dividing by the standard deviation.
  *      Formula: out = (in - mean) / stddev * scale
+ * Input is float or uint8, uint8 input is scaled by 1/255 like ToTensor in the same pass:
+ *      Formula: out = (in / 255 - mean) / stddev * scale
  * SCHEMA BEGIN
  *      Inputs:
  *          - 0, original data.
@@ -63,6 +65,9 @@ private:
 
     AccDataErrorCode AddTask(ThreadPool &pool, const Tensor &input, Tensor &output);
 
+    template<typename InputType>
+    AccDataErrorCode AddTaskByOutput(ThreadPool &pool, const Tensor &input, Tensor &output);
+
     template<typename InputType, typename OutputType>
     AccDataErrorCode AddTask(ThreadPool &pool, const Tensor &input, Tensor &output);
 
@@ -58,6 +58,24 @@ AccDataErrorCode NormalizeArgs::Setup(const OpSpec &spec, Workspace &ws)
             AccDataErrorCode::H_COMMON_INVALID_PARAM);
         s = 1 / s * scale;
     }
+    mPixelMul.resize(mStddev.size());
+    mPixelBias.resize(mStddev.size());
+    for (size_t i = 0; i < mStddev.size(); ++i) {
+        mPixelMul[i] = static_cast<float>(ToTensorArgs::NORM_FACTOR * mStddev[i]);
+        mPixelBias[i] = -mMean[i] * mStddev[i];
+    }
+
+    int64_t dtype = static_cast<int64_t>(TensorDataType::FP32);
+    if (spec.HasArg("dtype")) {
+        errCode = spec.GetArg<int64_t>("dtype", dtype);
+        ACCDATA_CHECK_ERRORCODE_RETURN(errCode == AccDataErrorCode::H_OK, "Failed to get the dtype argument.", errCode);
+    }
+    mDataType = static_cast<TensorDataType>(dtype);
+    if (mDataType != TensorDataType::FP32 && mDataType != TensorDataType::FP16 &&
+        mDataType != TensorDataType::BF16) {
+        ACCDATA_ERROR("The output datatype should be FP32, FP16 or BF16.");
+        return AccDataErrorCode::H_COMMON_INVALID_PARAM;
+    }
 
     return AccDataErrorCode::H_OK;
 }
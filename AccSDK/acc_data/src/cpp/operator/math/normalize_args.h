@@ -24,6 +24,7 @@
 #define ACCDATA_SRC_CPP_OPERATOR_MATH_NORMALIZE_ARGS_H_
 
 #include "operator/op_spec.h"
+#include "operator/image/to_tensor_args.h"
 #include "pipeline/workspace/workspace.h"
 
 namespace acclib {
@@ -38,6 +39,7 @@ namespace accdata {
  *      - stddev: Standard deviation value to scale the data.
  * Optional arguments:
  *      - scale: The scaling factor applied to the output. Default is 1.0.
+ *      - dtype: The datatype of the output, one of FP32, FP16 and BF16. Default is FP32.
  */
 class NormalizeArgs {
 public:
@@ -66,9 +68,33 @@ public:
         return mStddev;
     }
 
+    /**
+     * @brief Per channel factors applied to uint8 input, which is scaled to [0, 1] like ToTensor first.
+     *
+     * out = in * PixelMul + PixelBias == (in / 255 - mean) / stddev * scale
+     */
+    const std::vector<float>& PixelMul() const
+    {
+        return mPixelMul;
+    }
+
+    const std::vector<float>& PixelBias() const
+    {
+        return mPixelBias;
+    }
+
+    /** @brief Datatype of the output, the data is computed in float and converted on the store. */
+    TensorDataType OutputDataType() const
+    {
+        return mDataType;
+    }
+
 private:
     std::vector<float> mMean{};
     std::vector<float> mStddev{};
+    std::vector<float> mPixelMul{};
+    std::vector<float> mPixelBias{};
+    TensorDataType mDataType{ TensorDataType::FP32 };
 };
 
 } // namespace accdata
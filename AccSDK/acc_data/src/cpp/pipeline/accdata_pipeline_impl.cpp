@@ -98,8 +98,25 @@ AccDataErrorCode AccDataPipelineImpl::Build(const std::vector<std::shared_ptr<Ac
 
 AccDataErrorCode AccDataPipelineImpl::Run(std::unordered_map<std::string, std::shared_ptr<AccDataTensorList>> inputs,
     std::vector<std::shared_ptr<AccDataTensorList>>& opOutputs, bool copy)
+{
+    return RunInto(std::move(inputs), opOutputs, copy, {});
+}
+
+AccDataErrorCode AccDataPipelineImpl::RunInto(
+    std::unordered_map<std::string, std::shared_ptr<AccDataTensorList>> inputs,
+    std::vector<std::shared_ptr<AccDataTensorList>>& opOutputs, bool copy,
+    const std::vector<std::shared_ptr<AccDataTensorList>> &outputBuffers)
 {
     auto errorCode = AccDataErrorCode::H_OK;
+    std::vector<std::shared_ptr<TensorList>> buffers(outputBuffers.size());
+    for (size_t i = 0; i < outputBuffers.size(); ++i) {
+        if (outputBuffers[i] == nullptr) {
+            continue;
+        }
+        buffers[i] = std::dynamic_pointer_cast<TensorList>(outputBuffers[i]);
+        ACCDATA_CHECK_ERRORCODE_RETURN(buffers[i].get() != nullptr, "Invalid output buffer tensorList.",
+            AccDataErrorCode::H_COMMON_NULLPTR);
+    }
     for (auto input : inputs) {
         std::shared_ptr<TensorList> tensorList = std::dynamic_pointer_cast<TensorList>(input.second);
         ACCDATA_CHECK_ERRORCODE_RETURN(tensorList.get() != nullptr, "Invalid input tensorList.",
@@ -108,7 +125,7 @@ AccDataErrorCode AccDataPipelineImpl::Run(std::unordered_map<std::string, std::s
         ACCDATA_CHECK_ERRORCODE_RETURN(errorCode == AccDataErrorCode::H_OK, "Failed to feed input data.", errorCode);
     }
 
-    errorCode = mExecutor->Run();
+    errorCode = mExecutor->Run(buffers);
     ACCDATA_CHECK_ERRORCODE_RETURN(errorCode == AccDataErrorCode::H_OK, "Failed to run ops.", errorCode);
     Workspace ws;
     errorCode = Outputs(ws);
@@ -61,6 +61,13 @@ public:
     AccDataErrorCode Run(std::unordered_map<std::string, std::shared_ptr<AccDataTensorList>> inputs,
         std::vector<std::shared_ptr<AccDataTensorList>>& opOutputs, bool copy);
 
+    /**
+     * @brief Run the pipeline and write the outputs into caller owned buffers
+     */
+    AccDataErrorCode RunInto(std::unordered_map<std::string, std::shared_ptr<AccDataTensorList>> inputs,
+        std::vector<std::shared_ptr<AccDataTensorList>>& opOutputs, bool copy,
+        const std::vector<std::shared_ptr<AccDataTensorList>> &outputBuffers);
+
     /**
      * @brief Get the generated outputs
      *
@@ -89,7 +89,19 @@ public:
     /**
      * @brief Run the executor
      */
-    virtual AccDataErrorCode Run() = 0;
+    AccDataErrorCode Run()
+    {
+        return Run({});
+    }
+
+    /**
+     * @brief Run the executor and write the outputs into the given buffers
+     *
+     * @param [in] outputBuffers    Buffers shared into the pipeline outputs before the operators run, one entry
+     *                              per output, nullptr or a missing entry leaves the output to the operator.
+     *                              An operator only writes into a buffer that is large enough for its result.
+     */
+    virtual AccDataErrorCode Run(const std::vector<std::shared_ptr<TensorList>> &outputBuffers) = 0;
 
     /**
      * @brief Get the generated outputs
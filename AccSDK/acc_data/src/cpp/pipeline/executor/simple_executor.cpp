@@ -49,7 +49,7 @@ AccDataErrorCode SimpleExecutor::Build(Graph &&graph)
     return AccDataErrorCode::H_OK;
 }
 
-AccDataErrorCode SimpleExecutor::Run()
+AccDataErrorCode SimpleExecutor::Run(const std::vector<std::shared_ptr<TensorList>> &outputBuffers)
 {
     if (mState != State::BUILT) {
         ACCDATA_ERROR("Unexpected state.");
@@ -62,6 +62,19 @@ AccDataErrorCode SimpleExecutor::Run()
         ACCDATA_ERROR("Accdata acquire FreeIdx timeout!");
         return AccDataErrorCode::H_PIPELINE_ERROR;
     }
+    /* Operators resize their outputs in place, a shared buffer that is large enough receives the result. */
+    const auto &outputIds = mGraph.GetOutputs();
+    for (uint64_t i = 0; i < outputBuffers.size() && i < outputIds.size(); ++i) {
+        if (outputBuffers[i] == nullptr) {
+            continue;
+        }
+        errCode = mWorkspaceManager.GetDataStore(idx, outputIds[i])->ShareData(outputBuffers[i]);
+        if (errCode != AccDataErrorCode::H_OK) {
+            ACCDATA_ERROR("Accdata executor failed to share output buffer " << i << " :" << errCode);
+            mWorkspaceManager.Recycle(idx);
+            return errCode;
+        }
+    }
 
     for (uint64_t i = 0; i < mGraph.NumOpNode(); ++i) {
         const auto &opNode = mGraph.GetOpNode(i, errCode);
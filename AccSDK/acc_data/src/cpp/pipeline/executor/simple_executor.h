@@ -41,7 +41,9 @@ public:
 public:
     AccDataErrorCode Build(Graph &&graph) override;
 
-    AccDataErrorCode Run() override;
+    using Executor::Run;
+
+    AccDataErrorCode Run(const std::vector<std::shared_ptr<TensorList>> &outputBuffers) override;
 
     AccDataErrorCode Outputs(Workspace &ws) override;
 
@@ -0,0 +1,223 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * @Description: Half precision storage types and float row conversion.
+ * @Version: 1.0
+ * @Date: 2025-10-20 10:00:00
+ * @LastEditors: dev
+ * @LastEditTime: 2025-10-20 10:00:00
+ */
+
+#ifndef ACCDATA_SRC_CPP_TENSOR_FLOAT16_H_
+#define ACCDATA_SRC_CPP_TENSOR_FLOAT16_H_
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+#if defined(__F16C__) || defined(__AVX2__) || defined(__AVX512BF16__)
+#include <immintrin.h>
+#endif
+
+namespace acclib {
+namespace accdata {
+
+/**
+ * @brief IEEE 754 binary16 storage type.
+ *
+ * Only used to store results, kernels compute in float and round to nearest even on the store.
+ */
+struct Float16 {
+    uint16_t bits;
+
+    Float16() = default;
+
+    Float16(float value) : bits(FromFloat(value)) {}
+
+    operator float() const
+    {
+        return ToFloat(bits);
+    }
+
+    static inline uint16_t FromFloat(float value)
+    {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        __fp16 half = value;
+        uint16_t result;
+        std::memcpy(&result, &half, sizeof(result));
+        return result;
+#elif defined(__F16C__)
+        return static_cast<uint16_t>(_cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT));
+#else
+        uint32_t f;
+        std::memcpy(&f, &value, sizeof(f));
+        uint32_t sign = (f >> 16) & 0x8000U;
+        uint32_t absF = f & 0x7FFFFFFFU;
+        if (absF >= 0x7F800000U) { // inf or nan, keep nan quiet
+            return static_cast<uint16_t>(sign | 0x7C00U | (absF > 0x7F800000U ? 0x0200U : 0U));
+        }
+        if (absF >= 0x477FF000U) { // 65520 and above round to inf
+            return static_cast<uint16_t>(sign | 0x7C00U);
+        }
+        if (absF < 0x38800000U) { // subnormal result, let the fpu round the mantissa by adding 0.5f
+            float tmp;
+            std::memcpy(&tmp, &absF, sizeof(tmp));
+            tmp += 0.5f;
+            uint32_t t;
+            std::memcpy(&t, &tmp, sizeof(t));
+            return static_cast<uint16_t>(sign | (t - 0x3F000000U));
+        }
+        uint32_t mantOdd = (absF >> 13) & 1U;
+        absF += 0xC8000FFFU + mantOdd; // rebias the exponent from 127 to 15 and round to nearest even
+        return static_cast<uint16_t>(sign | (absF >> 13));
+#endif
+    }
+
+    static inline float ToFloat(uint16_t half)
+    {
+        uint32_t sign = static_cast<uint32_t>(half & 0x8000U) << 16;
+        uint32_t exp = (half >> 10) & 0x1FU;
+        uint32_t mant = half & 0x3FFU;
+        uint32_t f;
+        if (exp == 0) {
+            float value = static_cast<float>(mant) * 5.9604644775390625e-8f; // mant * 2^-24
+            std::memcpy(&f, &value, sizeof(f));
+            f |= sign;
+        } else if (exp == 0x1FU) {
+            f = sign | 0x7F800000U | (mant << 13);
+        } else {
+            f = sign | ((exp + 112U) << 23) | (mant << 13);
+        }
+        float result;
+        std::memcpy(&result, &f, sizeof(result));
+        return result;
+    }
+};
+
+/**
+ * @brief bfloat16 storage type, the upper half of a float rounded to nearest even.
+ */
+struct BFloat16 {
+    uint16_t bits;
+
+    BFloat16() = default;
+
+    BFloat16(float value) : bits(FromFloat(value)) {}
+
+    operator float() const
+    {
+        uint32_t f = static_cast<uint32_t>(bits) << 16;
+        float result;
+        std::memcpy(&result, &f, sizeof(result));
+        return result;
+    }
+
+    static inline uint16_t FromFloat(float value)
+    {
+        uint32_t f;
+        std::memcpy(&f, &value, sizeof(f));
+        if ((f & 0x7FFFFFFFU) > 0x7F800000U) {
+            return static_cast<uint16_t>((f >> 16) | 0x40U);
+        }
+        f += 0x7FFFU + ((f >> 16) & 1U);
+        return static_cast<uint16_t>(f >> 16);
+    }
+};
+
+static_assert(sizeof(Float16) == sizeof(uint16_t) && std::is_trivially_copyable_v<Float16>);
+static_assert(sizeof(BFloat16) == sizeof(uint16_t) && std::is_trivially_copyable_v<BFloat16>);
+
+template <typename T>
+inline constexpr bool IS_FLOAT_RESULT_TYPE =
+    std::is_same_v<T, float> || std::is_same_v<T, Float16> || std::is_same_v<T, BFloat16>;
+
+/**
+ * @brief Store a row of float results as T.
+ *
+ * fp16 uses the NEON or F16C conversion instructions, bf16 uses AVX512-BF16 when available and otherwise
+ * the integer round to nearest even on NEON or AVX2. The tail and other targets go through the scalar path.
+ */
+template <typename T>
+inline void ConvertFloatRow(const float *src, T *dst, int64_t n)
+{
+    static_assert(IS_FLOAT_RESULT_TYPE<T>, "Unsupported result type.");
+    int64_t i = 0;
+    if constexpr (std::is_same_v<T, float>) {
+        if (n > 0) {
+            std::memcpy(dst, src, static_cast<size_t>(n) * sizeof(float));
+        }
+        return;
+    } else if constexpr (std::is_same_v<T, Float16>) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        for (; i + 8 <= n; i += 8) {
+            float16x4_t lo = vcvt_f16_f32(vld1q_f32(src + i));
+            float16x4_t hi = vcvt_f16_f32(vld1q_f32(src + i + 4));
+            vst1q_u16(reinterpret_cast<uint16_t *>(dst + i), vreinterpretq_u16_f16(vcombine_f16(lo, hi)));
+        }
+#elif defined(__F16C__) && defined(__AVX__)
+        for (; i + 8 <= n; i += 8) {
+            __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), half);
+        }
+#endif
+    } else {
+#if defined(__AVX512BF16__) && defined(__AVX512F__)
+        for (; i + 16 <= n; i += 16) {
+            __m256bh half = _mm512_cvtneps_pbh(_mm512_loadu_ps(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), reinterpret_cast<__m256i &>(half));
+        }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+        const uint32x4_t one = vdupq_n_u32(1U);
+        const uint32x4_t bias = vdupq_n_u32(0x7FFFU);
+        const uint32x4_t quiet = vdupq_n_u32(0x400000U);
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t v = vld1q_f32(src + i);
+            uint32x4_t f = vreinterpretq_u32_f32(v);
+            uint32x4_t lsb = vandq_u32(vshrq_n_u32(f, 16), one);
+            uint32x4_t rounded = vaddq_u32(f, vaddq_u32(lsb, bias));
+            uint32x4_t isNan = vmvnq_u32(vceqq_f32(v, v));
+            rounded = vbslq_u32(isNan, vorrq_u32(f, quiet), rounded);
+            vst1_u16(reinterpret_cast<uint16_t *>(dst + i), vshrn_n_u32(rounded, 16));
+        }
+#elif defined(__AVX2__)
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i bias = _mm256_set1_epi32(0x7FFF);
+        const __m256i quiet = _mm256_set1_epi32(0x400000);
+        for (; i + 8 <= n; i += 8) {
+            __m256 v = _mm256_loadu_ps(src + i);
+            __m256i f = _mm256_castps_si256(v);
+            __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(f, 16), one);
+            __m256i rounded = _mm256_add_epi32(f, _mm256_add_epi32(lsb, bias));
+            __m256i isNan = _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+            rounded = _mm256_srli_epi32(_mm256_blendv_epi8(rounded, _mm256_or_si256(f, quiet), isNan), 16);
+            // packus works per 128 bit lane, restore the element order before storing the low half
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(rounded, rounded), 0xD8);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm256_castsi256_si128(packed));
+        }
+#endif
+    }
+    for (; i < n; i++) {
+        dst[i] = T(src[i]);
+    }
+}
+
+}  // namespace accdata
+}  // namespace acclib
+
+#endif  // ACCDATA_SRC_CPP_TENSOR_FLOAT16_H_
@@ -21,7 +21,11 @@
  * @LastEditTime: 2025-3-21 9:00:00
  */
 
+#include <atomic>
+#include <new>
+
 #include "accdata_tensor.h"
+#include "tensor.h"
 #include "tensor_list.h"
 
 namespace acclib {
@@ -39,6 +43,12 @@ std::ostream &operator << (std::ostream &os, TensorDataType layout)
         case TensorDataType::CHAR:
             os << "CHAR";
             break;
+        case TensorDataType::FP16:
+            os << "FP16";
+            break;
+        case TensorDataType::BF16:
+            os << "BF16";
+            break;
         default:
             os << "Unknown";
             break;
@@ -55,6 +65,9 @@ int32_t TensorDataTypeSize(TensorDataType dataType)
             return sizeof(float);
         case TensorDataType::CHAR:
             return sizeof(char);
+        case TensorDataType::FP16:
+        case TensorDataType::BF16:
+            return sizeof(uint16_t);
         default:
             ACCDATA_ERROR("Unknown data type.");
             return 0;
@@ -80,6 +93,31 @@ std::ostream &operator << (std::ostream &os, TensorLayout layout)
     return os;
 }
 
+namespace {
+std::atomic<TensorAllocator> g_tensorAllocator{nullptr};
+}
+
+void SetTensorAllocator(TensorAllocator allocator)
+{
+    g_tensorAllocator.store(allocator, std::memory_order_release);
+}
+
+std::shared_ptr<void> AllocateTensorData(size_t numBytes)
+{
+    TensorAllocator allocator = g_tensorAllocator.load(std::memory_order_acquire);
+    if (allocator != nullptr) {
+        std::shared_ptr<void> data = allocator(numBytes);
+        if (data == nullptr) {
+            throw std::bad_alloc();
+        }
+        return data;
+    }
+    return std::shared_ptr<uint8_t>(new (std::align_val_t(ACCDATA_ALIGN_SIZE)) uint8_t[numBytes],
+        [](uint8_t* ptr) {  // 智能指针默认删除器处理自定义对齐分配的空间时可能导致内存泄漏
+            operator delete[] (ptr, (std::align_val_t(ACCDATA_ALIGN_SIZE)));
+        }
+    );
+}
 
 std::shared_ptr<AccDataTensorList> AccDataTensorList::Create(uint64_t batchSize)
 {
@@ -35,6 +35,7 @@
 #include "common/check.h"
 #include "common/utility.h"
 #include "accdata_tensor.h"
+#include "tensor/float16.h"
 
 namespace acclib {
 namespace accdata {
@@ -48,6 +49,10 @@ inline constexpr TensorDataType TensorDataTypeEnum()
         return TensorDataType::FP32;
     } else if constexpr (std::is_same_v<T, char>) {
         return TensorDataType::CHAR;
+    } else if constexpr (std::is_same_v<T, Float16>) {
+        return TensorDataType::FP16;
+    } else if constexpr (std::is_same_v<T, BFloat16>) {
+        return TensorDataType::BF16;
     } else {
         ACCDATA_ERROR("Unsupported data type.");
         return TensorDataType::LAST;
@@ -76,7 +81,8 @@ inline bool IsValidShape(const TensorShape& shape)
 inline bool IsValidDataType(TensorDataType dataType)
 {
     static const std::unordered_set<TensorDataType> validDataTypes = {
-        TensorDataType::CHAR, TensorDataType::FP32, TensorDataType::UINT8
+        TensorDataType::CHAR, TensorDataType::FP32, TensorDataType::UINT8, TensorDataType::FP16,
+        TensorDataType::BF16
     };
     return validDataTypes.find(dataType) != validDataTypes.end();
 }
@@ -89,6 +95,11 @@ inline bool IsValidLayout(TensorLayout layoutType)
     return validDataLayouts.find(layoutType) != validDataLayouts.end();
 }
 
+/**
+ * @brief Allocate tensor data with the allocator set by SetTensorAllocator, throws std::bad_alloc on failure.
+ */
+std::shared_ptr<void> AllocateTensorData(size_t numBytes);
+
 /**
  * @brief Tensor
  */
@@ -189,12 +200,8 @@ public:
         if (numBytes <= mNumBytes) {
             return;
         }
+        mData = AllocateTensorData(static_cast<size_t>(numBytes));
         mNumBytes = numBytes;
-        mData = std::shared_ptr<uint8_t>(new (std::align_val_t(ACCDATA_ALIGN_SIZE)) uint8_t[mNumBytes],
-            [](uint8_t* ptr) {  // 智能指针默认删除器处理自定义对齐分配的空间时可能导致内存泄漏
-                operator delete[] (ptr, (std::align_val_t(ACCDATA_ALIGN_SIZE)));
-            }
-        );
         return;
     }
 
@@ -165,6 +165,7 @@ def normalize(input_tensor, mean, std, scale=None):
     """
     Normalizes the input by removing the mean and dividing by the standard deviation.
         Formula: out = (in - mean) / stddev * scale
+        uint8 input is divided by 255 first, in the same per-channel multiply-add.
     :param mean: Mean value to be subtracted from the data.
     :param stddev: Standard deviation value to scale the data.
     :param scale: The scaling factor applied to the output. Default is 1.0.
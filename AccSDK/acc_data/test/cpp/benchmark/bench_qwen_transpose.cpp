@@ -0,0 +1,79 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * @Description: Benchmark of the cache blocked Qwen2-VL patch shuffle against the per-row strided scatter.
+ * @Version: 1.0
+ * @Date: 2025-10-18 10:00:00
+ * @LastEditors: dev
+ * @LastEditTime: 2025-10-18 10:00:00
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "operator/fusion/qwen_transpose_reference.h"
+
+namespace {
+using namespace acclib::accdata::test;
+
+constexpr int DEFAULT_LOOPS = 20;
+
+template <typename F> double AverageMs(F &&run, int loops)
+{
+    run(); // warm up, the first pass also faults the output pages in
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; i++) {
+        run();
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / loops;
+}
+} // namespace
+
+/**
+ * Usage: accdata_benchmark [loops]
+ * Prints the average time of both shuffles for the smart resize targets of common frame sizes, and fails when the
+ * blocked result differs from the reference.
+ */
+int main(int argc, char *argv[])
+{
+    int loops = argc > 1 ? std::atoi(argv[1]) : DEFAULT_LOOPS;
+    if (loops <= 0) {
+        std::cerr << "loops must be > 0" << std::endl;
+        return EXIT_FAILURE;
+    }
+    // (height, width) after the smart resize of 640 x 480, 1280 x 720 and 1920 x 1080 with the default max pixels
+    const std::vector<std::pair<int64_t, int64_t>> sizes = {{476, 644}, {728, 1288}, {728, 1316}};
+    for (const auto &size : sizes) {
+        QwenTransposeInput input;
+        input.Prepare(size.first, size.second);
+        std::vector<float> expect(input.OutputSize());
+        std::vector<float> result(input.OutputSize());
+        double reference = AverageMs([&]() { ReferenceTranspose(input.mChw, expect, input.mHeight, input.mWidth); },
+                                     loops);
+        double blocked = AverageMs([&]() { input.BlockedTranspose(result); }, loops);
+        if (expect != result) {
+            std::cerr << "Blocked transpose differs from the reference at " << size.first << "x" << size.second
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << "Qwen transpose " << size.first << "x" << size.second << ": reference " << reference
+                  << " ms, blocked " << blocked << " ms, speedup " << reference / blocked << "x" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * @Description: Per thread bump allocator for kernel temporaries.
+ * @Version: 1.0
+ * @Date: 2025-10-20 10:00:00
+ * @LastEditors: dev
+ * @LastEditTime: 2025-10-20 10:00:00
+ */
+#include <cstdint>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "accdata_scratch_arena.h"
+#include "common/thread_pool.h"
+#include "common/utility.h"
+
+namespace acclib {
+namespace accdata {
+namespace {
+constexpr int64_t SMALL_COUNT = 100;
+constexpr int64_t LARGE_COUNT = 1024 * 1024;
+}
+
+TEST(TestScratchArena, TestAllocateIsAlignedAndRewound)
+{
+    ScratchArena arena;
+    auto *a = arena.Allocate<uint8_t>(1);
+    auto *b = arena.Allocate<float>(SMALL_COUNT);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % ACCDATA_ALIGN_SIZE, 0U);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % ACCDATA_ALIGN_SIZE, 0U);
+    EXPECT_NE(static_cast<void *>(a), static_cast<void *>(b));
+
+    auto mark = arena.GetMark();
+    auto *c = arena.Allocate<int>(SMALL_COUNT);
+    arena.Rewind(mark);
+    EXPECT_EQ(arena.Allocate<int>(SMALL_COUNT), c);
+    EXPECT_EQ(arena.Allocate<int>(-1), nullptr);
+    EXPECT_EQ(arena.Allocate<double>(SIZE_MAX / 4), nullptr);
+}
+
+TEST(TestScratchArena, TestResetMergesChunks)
+{
+    ScratchArena arena;
+    ASSERT_NE(arena.Allocate<uint8_t>(SMALL_COUNT), nullptr);
+    // larger than the first chunk, the arena grows a second one
+    ASSERT_NE(arena.Allocate<double>(LARGE_COUNT), nullptr);
+    size_t capacity = arena.Capacity();
+    arena.Reset();
+    EXPECT_EQ(arena.Capacity(), capacity);
+
+    // the same round fits in the merged chunk without growing
+    auto *first = arena.Allocate<uint8_t>(SMALL_COUNT);
+    ASSERT_NE(arena.Allocate<double>(LARGE_COUNT), nullptr);
+    EXPECT_EQ(arena.Capacity(), capacity);
+    arena.Reset();
+    EXPECT_EQ(arena.Allocate<uint8_t>(SMALL_COUNT), first);
+}
+
+TEST(TestScratchArena, TestScopeRewindsThreadArena)
+{
+    auto &arena = ScratchArena::ThreadLocal();
+    void *outer = nullptr;
+    {
+        ScratchScope scope;
+        outer = scope.Arena().Allocate<float>(SMALL_COUNT);
+        {
+            ScratchScope inner;
+            EXPECT_NE(inner.Arena().Allocate<float>(SMALL_COUNT), outer);
+        }
+        EXPECT_NE(arena.Allocate<float>(SMALL_COUNT), outer);
+    }
+    EXPECT_EQ(arena.Allocate<float>(SMALL_COUNT), outer);
+    arena.Reset();
+}
+
+TEST(TestScratchArena, TestThreadPoolResetsArenaAfterTask)
+{
+    ThreadPool pool(1, false, "scratch");
+    void *first = nullptr;
+    void *second = nullptr;
+    pool.AddTask([&first](int, AccDataErrorCode &errCode) {
+        first = ScratchArena::ThreadLocal().Allocate<float>(SMALL_COUNT);
+        errCode = AccDataErrorCode::H_OK;
+    });
+    ASSERT_EQ(pool.RunAll(), AccDataErrorCode::H_OK);
+    pool.AddTask([&second](int, AccDataErrorCode &errCode) {
+        second = ScratchArena::ThreadLocal().Allocate<float>(SMALL_COUNT);
+        errCode = AccDataErrorCode::H_OK;
+    });
+    ASSERT_EQ(pool.RunAll(), AccDataErrorCode::H_OK);
+    EXPECT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+}
+} // namespace accdata
+} // namespace acclib
@@ -0,0 +1,138 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * @Description: Reference patch shuffle and tile setup shared by the transpose test and benchmark.
+ * @Version: 1.0
+ * @Date: 2025-10-18 10:00:00
+ * @LastEditors: dev
+ * @LastEditTime: 2025-10-18 10:00:00
+ */
+
+#ifndef ACCDATA_TEST_QWEN_TRANSPOSE_REFERENCE_H
+#define ACCDATA_TEST_QWEN_TRANSPOSE_REFERENCE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "operator/fusion/qwen_fusion_ops.h"
+
+namespace acclib {
+namespace accdata {
+namespace test {
+constexpr int64_t QWEN_CHANNELS = 3;
+constexpr int64_t QWEN_PATCH_SIZE = 14;
+constexpr int64_t QWEN_MERGE_SIZE = 2;
+constexpr int64_t QWEN_TEMPORAL_PATCH_SIZE = 2;
+
+/**
+ * Per-row scatter with strided scalar writes, the layout every Qwen2-VL output must match.
+ */
+inline void ReferenceTranspose(const std::vector<float> &chw, std::vector<float> &out, int64_t height, int64_t width)
+{
+    int64_t hdim[3] = {QWEN_PATCH_SIZE, QWEN_MERGE_SIZE, height / (QWEN_PATCH_SIZE * QWEN_MERGE_SIZE)};
+    int64_t wdim[3] = {QWEN_PATCH_SIZE, QWEN_MERGE_SIZE, width / (QWEN_PATCH_SIZE * QWEN_MERGE_SIZE)};
+    int64_t b = QWEN_TEMPORAL_PATCH_SIZE;
+    int64_t hstride1 = wdim[0] * wdim[1] * hdim[0] * b * QWEN_CHANNELS;
+    int64_t hstride2 = hdim[0] * hdim[1] * width * b * QWEN_CHANNELS;
+    int64_t bstride = hdim[0] * wdim[0];
+    int64_t cstride = bstride * b;
+    int64_t wstride1 = cstride * QWEN_CHANNELS;
+    int64_t wstride2 = wstride1 * wdim[1] * hdim[1];
+    for (int64_t c = 0; c < QWEN_CHANNELS; c++) {
+        for (int64_t h = 0; h < height; h++) {
+            int64_t h0 = h % hdim[0];
+            int64_t h1 = (h / hdim[0]) % hdim[1];
+            int64_t h2 = h / (hdim[0] * hdim[1]);
+            for (int64_t j = 0; j < b; j++) {
+                const float *sp = chw.data() + (c * height + h) * width;
+                float *dp = out.data() + h0 * wdim[0] + h1 * hstride1 + h2 * hstride2 + c * cstride + j * bstride;
+                for (int64_t w2 = 0; w2 < wdim[2]; w2++) {
+                    for (int64_t w1 = 0; w1 < wdim[1]; w1++) {
+                        for (int64_t w0 = 0; w0 < wdim[0]; w0++) {
+                            dp[w2 * wstride2 + w1 * wstride1 + w0] = *sp++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * A random CHW image together with the per block tiles the vertical resize pass hands to Tranpose.
+ */
+class QwenTransposeInput {
+public:
+    void Prepare(int64_t height, int64_t width)
+    {
+        mHeight = height;
+        mWidth = width;
+        mChw.resize(QWEN_CHANNELS * height * width);
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<float> dis(-2.0f, 2.0f);
+        for (auto &v : mChw) {
+            v = dis(gen);
+        }
+
+        int64_t blockRows = QWEN_PATCH_SIZE * QWEN_MERGE_SIZE;
+        mNumBlocks = height / blockRows;
+        mTileSize = blockRows * width * QWEN_CHANNELS;
+        mTiles.resize(mNumBlocks * mTileSize);
+        for (int64_t blk = 0; blk < mNumBlocks; blk++) {
+            for (int64_t c = 0; c < QWEN_CHANNELS; c++) {
+                for (int64_t r = 0; r < blockRows; r++) {
+                    const float *src = mChw.data() + (c * height + blk * blockRows + r) * width;
+                    float *dst = mTiles.data() + blk * mTileSize + (c * blockRows + r) * width;
+                    std::copy(src, src + width, dst);
+                }
+            }
+        }
+    }
+
+    Tranpose MakeTranspose() const
+    {
+        int64_t hdim[3] = {QWEN_PATCH_SIZE, QWEN_MERGE_SIZE, mHeight / (QWEN_PATCH_SIZE * QWEN_MERGE_SIZE)};
+        int64_t wdim[3] = {QWEN_PATCH_SIZE, QWEN_MERGE_SIZE, mWidth / (QWEN_PATCH_SIZE * QWEN_MERGE_SIZE)};
+        return Tranpose(hdim, wdim, QWEN_TEMPORAL_PATCH_SIZE);
+    }
+
+    void BlockedTranspose(std::vector<float> &out, int64_t tBegin = 0) const
+    {
+        Tranpose transpose = MakeTranspose();
+        for (int64_t blk = 0; blk < mNumBlocks; blk++) {
+            transpose.ApplyBlock(mTiles.data() + blk * mTileSize, out.data(), blk, tBegin, QWEN_TEMPORAL_PATCH_SIZE);
+        }
+    }
+
+    size_t OutputSize() const
+    {
+        return mChw.size() * QWEN_TEMPORAL_PATCH_SIZE;
+    }
+
+    int64_t mHeight = 0;
+    int64_t mWidth = 0;
+    int64_t mNumBlocks = 0;
+    int64_t mTileSize = 0;
+    std::vector<float> mChw;
+    std::vector<float> mTiles;
+};
+} // namespace test
+} // namespace accdata
+} // namespace acclib
+
+#endif // ACCDATA_TEST_QWEN_TRANSPOSE_REFERENCE_H
@@ -315,6 +315,30 @@ TEST_F(TestQwenFusedOp, TestRunWithTemporalPatchSize)
     EXPECT_EQ(fusedOp.Run(*workspace), AccDataErrorCode::H_COMMON_OPERATOR_ERROR);
 }
 
+TEST_F(TestQwenFusedOp, TestRunWithExplicitResize)
+{
+    PrepareOpSpec();
+    opSpec->AddArg<int64_t>("resize_h", 224);
+    opSpec->AddArg<int64_t>("resize_w", 448);
+    QwenFusionOp fusedOp(*opSpec);
+    EXPECT_EQ(fusedOp.Run(*workspace), AccDataErrorCode::H_OK);
+    AccDataErrorCode errCode = AccDataErrorCode::H_OK;
+    auto &output = workspace->GetOutput(0, errCode);
+    EXPECT_EQ(errCode, AccDataErrorCode::H_OK);
+    TensorShape expectShape = {static_cast<size_t>((224 / patchSize) * (448 / patchSize)),
+                               static_cast<size_t>(3 * temporalPatchSzie * patchSize * patchSize)};
+    EXPECT_EQ(output[0].Shape(), expectShape);
+}
+
+TEST_F(TestQwenFusedOp, TestRunWithUnalignedResize)
+{
+    PrepareOpSpec();
+    opSpec->AddArg<int64_t>("resize_h", 224);
+    opSpec->AddArg<int64_t>("resize_w", 450);
+    QwenFusionOp fusedOp(*opSpec);
+    EXPECT_EQ(fusedOp.Run(*workspace), AccDataErrorCode::H_COMMON_OPERATOR_ERROR);
+}
+
 TEST_F(TestQwenFusedOp, TestRunWithSmallInput)
 {
     PrepareOpSpec();
@@ -361,6 +385,36 @@ TEST_F(TestQwenFusedOp, TestRunWithBigInput)
     EXPECT_NE(fusedOp.Run(*workspace), AccDataErrorCode::H_OK);
 }
 
+TEST_F(TestQwenFusedOp, TestRunWithHalfPrecisionOutput)
+{
+    PrepareOpSpec();
+    opSpec->AddArg<int64_t>("resize_h", 224);
+    opSpec->AddArg<int64_t>("resize_w", 448);
+    AccDataErrorCode errCode = AccDataErrorCode::H_OK;
+    QwenFusionOp fusedOp(*opSpec);
+    ASSERT_EQ(fusedOp.Run(*workspace), AccDataErrorCode::H_OK);
+    auto &output = workspace->GetOutput(0, errCode);
+    const float *floatResult = output[0].RawDataPtr<float>();
+    std::vector<float> expect(floatResult, floatResult + NumElements(output[0].Shape()));
+
+    auto runWithDataType = [&](TensorDataType dataType, auto zero, float tolerance) {
+        using T = decltype(zero);
+        opSpec->AddArg<int64_t>("dtype", static_cast<int64_t>(dataType));
+        QwenFusionOp halfOp(*opSpec);
+        ASSERT_EQ(halfOp.Run(*workspace), AccDataErrorCode::H_OK);
+        auto &halfOutput = workspace->GetOutput(0, errCode);
+        ASSERT_EQ(halfOutput[0].DataType(), dataType);
+        ASSERT_EQ(halfOutput[0].Shape(), output[0].Shape());
+        const T *result = halfOutput[0].RawDataPtr<T>();
+        for (size_t i = 0; i < expect.size(); ++i) {
+            ASSERT_NEAR(static_cast<float>(result[i]), expect[i], tolerance) << "index " << i;
+        }
+    };
+    // the normalized values lie in [-1, 1]
+    runWithDataType(TensorDataType::FP16, Float16(), 1e-3f);
+    runWithDataType(TensorDataType::BF16, BFloat16(), 8e-3f);
+}
+
 TEST_F(TestQwenFusedOp, TestRunSuccess)
 {
     PrepareOpSpec();
@@ -408,16 +462,17 @@ TEST_F(TestQwenFusedOp, TestInvalidChannel)
     EXPECT_NE(fusedOp.Run(*workspace), AccDataErrorCode::H_OK);
 }
 
-TEST_F(TestQwenFusedOp, TestInvalidNumSamples)
+TEST_F(TestQwenFusedOp, TestRunWithOddNumFrames)
 {
     PrepareOpSpec();
     workspace->Clear();
-    size_t tensorSize = 3 * 3 * originImageSize.first * originImageSize.second;
+    size_t numFrames = 3;
+    size_t tensorSize = numFrames * 3 * originImageSize.first * originImageSize.second;
     std::vector<uint8_t> datas(tensorSize);
     GenerateTensorDatas<uint8_t>(tensorSize, datas);
 
     auto mInputTensor = std::make_shared<TensorList>(1);
-    TensorShape tensorShape = {3, originImageSize.first, originImageSize.second, 3};
+    TensorShape tensorShape = {numFrames, originImageSize.first, originImageSize.second, 3};
     mInputTensor->operator[](0).Copy<uint8_t>(datas.data(), tensorShape);
     mInputTensor->operator[](0).SetLayout(TensorLayout::NHWC);
     auto mOutputTensor = std::make_shared<TensorList>(1);
@@ -428,7 +483,104 @@ TEST_F(TestQwenFusedOp, TestInvalidNumSamples)
     workspace->AddOutput(mOutputTensor);
 
     QwenFusionOp fusedOp(*opSpec);
-    EXPECT_NE(fusedOp.Run(*workspace), AccDataErrorCode::H_OK);
+    EXPECT_EQ(fusedOp.Run(*workspace), AccDataErrorCode::H_OK);
+    auto outputShape = (*mOutputTensor)[0].Shape();
+    ASSERT_EQ(outputShape.size(), 2);
+    // 3 frames are padded to 4, which gives 2 temporal groups
+    EXPECT_EQ(outputShape[0] % 2, 0);
+    EXPECT_EQ(outputShape[1], static_cast<size_t>(3 * temporalPatchSzie * patchSize * patchSize));
 }
 
-}
\ No newline at end of file
+TEST_F(TestQwenFusedOp, TestRunFramesInterleavedByTemporalSlot)
+{
+    PrepareOpSpec();
+    size_t frameSize = 3 * originImageSize.first * originImageSize.second;
+    std::vector<uint8_t> datas(2 * frameSize);
+    GenerateTensorDatas<uint8_t>(datas.size(), datas);
+    auto mThreadPool = std::make_shared<ThreadPool>(8, true, "AccData");
+
+    auto runFrames = [&](size_t numFrames, std::shared_ptr<TensorList> &output) {
+        workspace->Clear();
+        auto input = std::make_shared<TensorList>(1);
+        TensorShape tensorShape = {numFrames, originImageSize.first, originImageSize.second, 3};
+        input->operator[](0).Copy<uint8_t>(datas.data(), tensorShape);
+        input->operator[](0).SetLayout(TensorLayout::NHWC);
+        output = std::make_shared<TensorList>(1);
+        workspace->SetThreadPool(mThreadPool);
+        workspace->AddInput(input);
+        workspace->AddOutput(output);
+        QwenFusionOp fusedOp(*opSpec);
+        return fusedOp.Run(*workspace);
+    };
+
+    std::shared_ptr<TensorList> single;
+    std::shared_ptr<TensorList> pair;
+    ASSERT_EQ(runFrames(1, single), AccDataErrorCode::H_OK);
+    ASSERT_EQ(runFrames(2, pair), AccDataErrorCode::H_OK);
+    ASSERT_EQ((*single)[0].Shape(), (*pair)[0].Shape());
+
+    // the first frame fills temporal slot 0 of every patch in both runs
+    auto rows = (*pair)[0].Shape()[0];
+    auto cols = (*pair)[0].Shape()[1];
+    auto slot = static_cast<size_t>(patchSize * patchSize);
+    const float *singleData = (*single)[0].RawDataPtr<float>();
+    const float *pairData = (*pair)[0].RawDataPtr<float>();
+    for (size_t r = 0; r < rows; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            size_t offset = r * cols + c * temporalPatchSzie * slot;
+            for (size_t k = 0; k < slot; ++k) {
+                ASSERT_FLOAT_EQ(singleData[offset + k], pairData[offset + k]);
+            }
+        }
+    }
+}
+
+TEST_F(TestQwenFusedOp, TestRunMergedFramesMatchStackedFrames)
+{
+    size_t frameSize = 3 * originImageSize.first * originImageSize.second;
+    std::vector<uint8_t> datas(3 * frameSize);
+    GenerateTensorDatas<uint8_t>(datas.size(), datas);
+    auto mThreadPool = std::make_shared<ThreadPool>(8, true, "AccData");
+
+    auto run = [&](std::shared_ptr<TensorList> input, std::shared_ptr<TensorList> &output) {
+        workspace->Clear();
+        output = std::make_shared<TensorList>(1);
+        workspace->SetThreadPool(mThreadPool);
+        workspace->AddInput(input);
+        workspace->AddOutput(output);
+        QwenFusionOp fusedOp(*opSpec);
+        return fusedOp.Run(*workspace);
+    };
+
+    PrepareOpSpec();
+    auto stacked = std::make_shared<TensorList>(1);
+    stacked->operator[](0).Copy<uint8_t>(datas.data(), {3, originImageSize.first, originImageSize.second, 3});
+    stacked->operator[](0).SetLayout(TensorLayout::NHWC);
+    std::shared_ptr<TensorList> expect;
+    ASSERT_EQ(run(stacked, expect), AccDataErrorCode::H_OK);
+
+    // each frame is its own tensor, the kernel reads them in place instead of from a stacked copy
+    opSpec->AddArg<bool>("merge_frames", true);
+    auto frames = std::make_shared<TensorList>(3);
+    for (size_t i = 0; i < 3; ++i) {
+        frames->operator[](i).Copy<uint8_t>(datas.data() + i * frameSize,
+                                            {1, originImageSize.first, originImageSize.second, 3});
+        frames->operator[](i).SetLayout(TensorLayout::NHWC);
+    }
+    std::shared_ptr<TensorList> result;
+    ASSERT_EQ(run(frames, result), AccDataErrorCode::H_OK);
+    ASSERT_EQ((*expect)[0].Shape(), (*result)[0].Shape());
+    size_t count = (*expect)[0].Shape()[0] * (*expect)[0].Shape()[1];
+    const float *expectData = (*expect)[0].RawDataPtr<float>();
+    const float *resultData = (*result)[0].RawDataPtr<float>();
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_FLOAT_EQ(expectData[i], resultData[i]);
+    }
+
+    // frames of different sizes cannot share one patch grid
+    frames->operator[](2).Copy<uint8_t>(datas.data(), {1, originImageSize.second, originImageSize.first, 3});
+    frames->operator[](2).SetLayout(TensorLayout::NHWC);
+    EXPECT_NE(run(frames, result), AccDataErrorCode::H_OK);
+}
+
+}
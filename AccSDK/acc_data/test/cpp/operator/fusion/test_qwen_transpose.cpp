@@ -0,0 +1,73 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * @Description: Correctness of the Qwen2-VL patch shuffle, isolated from the resize stage.
+ * @Version: 1.0
+ * @Date: 2025-10-18 10:00:00
+ * @LastEditors: dev
+ * @LastEditTime: 2025-10-18 10:00:00
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "qwen_transpose_reference.h"
+
+namespace {
+using namespace acclib::accdata;
+using namespace acclib::accdata::test;
+
+class TestQwenTranspose : public ::testing::Test {
+protected:
+    QwenTransposeInput mInput;
+};
+
+TEST_F(TestQwenTranspose, TestBlockedTransposeMatchesReference)
+{
+    mInput.Prepare(224, 448);
+    std::vector<float> expect(mInput.OutputSize());
+    std::vector<float> result(mInput.OutputSize());
+    ReferenceTranspose(mInput.mChw, expect, mInput.mHeight, mInput.mWidth);
+    mInput.BlockedTranspose(result);
+    EXPECT_EQ(expect, result);
+}
+
+TEST_F(TestQwenTranspose, TestBlockedTransposeSingleTemporalSlot)
+{
+    mInput.Prepare(56, 84);
+    std::vector<float> result(mInput.OutputSize(), 0.0f);
+    mInput.BlockedTranspose(result, 1);
+    // slot 0 of every patch is left untouched for the previous frame
+    int64_t patchArea = QWEN_PATCH_SIZE * QWEN_PATCH_SIZE;
+    for (size_t i = 0; i < result.size(); i += static_cast<size_t>(patchArea * QWEN_TEMPORAL_PATCH_SIZE)) {
+        for (int64_t k = 0; k < patchArea; k++) {
+            ASSERT_FLOAT_EQ(result[i + k], 0.0f);
+        }
+    }
+}
+
+TEST_F(TestQwenTranspose, TestBlockedTransposeFullFrameMatchesReference)
+{
+    // 1288 x 728 is the smart resize of a 1920 x 1080 frame with the default max pixels.
+    mInput.Prepare(728, 1288);
+    std::vector<float> expect(mInput.OutputSize());
+    std::vector<float> result(mInput.OutputSize());
+    ReferenceTranspose(mInput.mChw, expect, mInput.mHeight, mInput.mWidth);
+    mInput.BlockedTranspose(result);
+    EXPECT_EQ(expect, result);
+}
+} // namespace
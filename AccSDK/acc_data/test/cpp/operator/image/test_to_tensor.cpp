@@ -164,6 +164,52 @@ TEST_F(TestToTensor, RunSuccessNCHWToNCHW)
     EXPECT_EQ(output[0].Layout(), TensorLayout::NCHW);
 }
 
+template<typename T>
+void ExpectHalfOutputMatches(OpSpec &opSpec, Workspace &workspace, TensorDataType dataType, float tolerance)
+{
+    auto errCode = AccDataErrorCode::H_OK;
+    ToTensor toTensor(opSpec);
+    ASSERT_EQ(toTensor.Run(workspace), AccDataErrorCode::H_OK);
+    auto &output = workspace.GetOutput(0, errCode);
+    const float *floatResult = output[0].RawDataPtr<float>();
+    std::vector<float> expect(floatResult, floatResult + NumElements(output[0].Shape()));
+
+    opSpec.AddArg<int64_t>("dtype", static_cast<int64_t>(dataType));
+    ToTensor halfToTensor(opSpec);
+    ASSERT_EQ(halfToTensor.Run(workspace), AccDataErrorCode::H_OK);
+    auto &halfOutput = workspace.GetOutput(0, errCode);
+    ASSERT_EQ(halfOutput[0].DataType(), dataType);
+    ASSERT_EQ(halfOutput[0].Shape(), output[0].Shape());
+    const T *result = halfOutput[0].RawDataPtr<T>();
+    for (size_t i = 0; i < expect.size(); ++i) {
+        ASSERT_NEAR(static_cast<float>(result[i]), expect[i], tolerance) << "index " << i;
+    }
+}
+
+TEST_F(TestToTensor, RunSuccessNHWCToNCHWFloat16)
+{
+    PrepareOpSpec(TensorLayout::NCHW);
+    PrepareWorkSpace<uint8_t>(TensorLayout::NHWC);
+    ExpectHalfOutputMatches<Float16>(*opSpec, *workspace, TensorDataType::FP16, 5e-4f);
+}
+
+TEST_F(TestToTensor, RunSuccessNHWCToNHWCBFloat16)
+{
+    PrepareOpSpec(TensorLayout::NHWC);
+    PrepareWorkSpace<uint8_t>(TensorLayout::NHWC);
+    ExpectHalfOutputMatches<BFloat16>(*opSpec, *workspace, TensorDataType::BF16, 4e-3f);
+}
+
+TEST_F(TestToTensor, RunWithInvalidOutputDataType)
+{
+    PrepareOpSpec(TensorLayout::NCHW);
+    opSpec->AddArg<int64_t>("dtype", static_cast<int64_t>(TensorDataType::UINT8));
+    PrepareWorkSpace<uint8_t>(TensorLayout::NHWC);
+
+    ToTensor toTensor(*opSpec);
+    EXPECT_NE(toTensor.Run(*workspace), AccDataErrorCode::H_OK);
+}
+
 TEST_F(TestToTensor, RunWithInconsistentOutputs)
 {
     PrepareOpSpec(TensorLayout::NCHW, false);
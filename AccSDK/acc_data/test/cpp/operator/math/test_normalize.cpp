@@ -19,6 +19,8 @@
  * Create: 2025-03-29
  */
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 #include <sstream>
 
@@ -148,6 +150,66 @@ TEST_P(ParamTestNormalize, TestRunSuccess)
     EXPECT_EQ(output[0].Layout(), tensorLayout);
 }
 
+TEST_P(ParamTestNormalize, TestRunUint8Input)
+{
+    workspace->Clear();
+    delete workspace;
+    PrepareWorkSpace<uint8_t>();
+    auto errCode = AccDataErrorCode::H_OK;
+    auto &input = workspace->GetInput(0, errCode);
+    const uint8_t *pixels = input[0].RawDataPtr<uint8_t>();
+    int64_t numElements = NumElements(input[0].Shape());
+    std::vector<float> expect(numElements);
+    constexpr float mean = 0.458f;
+    constexpr float stddev = 0.229f;
+    for (int64_t i = 0; i < numElements; ++i) {
+        expect[i] = (pixels[i] / 255.0f - mean) / stddev * scale;
+    }
+
+    Normalize normalize(*opSpec);
+    ASSERT_EQ(normalize.Run(*workspace), AccDataErrorCode::H_OK);
+    auto &output = workspace->GetOutput(0, errCode);
+    ASSERT_EQ(output[0].DataType(), TensorDataType::FP32);
+    EXPECT_EQ(output[0].Layout(), tensorLayout);
+    const float *result = output[0].RawDataPtr<float>();
+    for (int64_t i = 0; i < numElements; ++i) {
+        ASSERT_NEAR(result[i], expect[i], 1e-5f * std::max(1.0f, std::abs(expect[i]))) << "index " << i;
+    }
+}
+
+template<typename T>
+void ExpectHalfOutputMatches(OpSpec &opSpec, Workspace &workspace, TensorDataType dataType, float tolerance)
+{
+    auto errCode = AccDataErrorCode::H_OK;
+    Normalize normalize(opSpec);
+    ASSERT_EQ(normalize.Run(workspace), AccDataErrorCode::H_OK);
+    auto &output = workspace.GetOutput(0, errCode);
+    const float *floatResult = output[0].RawDataPtr<float>();
+    std::vector<float> expect(floatResult, floatResult + NumElements(output[0].Shape()));
+
+    opSpec.AddArg<int64_t>("dtype", static_cast<int64_t>(dataType));
+    Normalize halfNormalize(opSpec);
+    ASSERT_EQ(halfNormalize.Run(workspace), AccDataErrorCode::H_OK);
+    auto &halfOutput = workspace.GetOutput(0, errCode);
+    ASSERT_EQ(halfOutput[0].DataType(), dataType);
+    ASSERT_EQ(NumElements(halfOutput[0].Shape()), static_cast<int64_t>(expect.size()));
+    const T *result = halfOutput[0].RawDataPtr<T>();
+    for (size_t i = 0; i < expect.size(); ++i) {
+        ASSERT_NEAR(static_cast<float>(result[i]), expect[i], tolerance * std::max(1.0f, std::abs(expect[i])))
+            << "index " << i;
+    }
+}
+
+TEST_P(ParamTestNormalize, TestRunHalfPrecisionOutput)
+{
+    ExpectHalfOutputMatches<Float16>(*opSpec, *workspace, TensorDataType::FP16, 1e-3f);
+}
+
+TEST_P(ParamTestNormalize, TestRunBFloat16Output)
+{
+    ExpectHalfOutputMatches<BFloat16>(*opSpec, *workspace, TensorDataType::BF16, 8e-3f);
+}
+
 class TestNormalize : public ::testing::Test, public BaseTestNormalize {
 public:
     void SetUp()
@@ -175,6 +237,15 @@ public:
     std::streambuf *sbuf;
 };
 
+TEST_F(TestNormalize, TestRunInvalidOutputDataType) // 输出数据类型仅支持FP32/FP16/BF16
+{
+    PrepareOpSpec();
+    opSpec->AddArg<int64_t>("dtype", static_cast<int64_t>(TensorDataType::UINT8));
+    PrepareWorkSpace<float>();
+    Normalize normalize(*opSpec);
+    EXPECT_EQ(normalize.Run(*workspace), AccDataErrorCode::H_COMMON_INVALID_PARAM);
+}
+
 TEST_F(TestNormalize, TestRunOpSpecOutputError) // opSpec NumOutput与workspace NumOutput不一致
 {
     PrepareOpSpec(false);
@@ -183,10 +254,10 @@ TEST_F(TestNormalize, TestRunOpSpecOutputError) // opSpec NumOutput与workspace
     EXPECT_EQ(normalize.Run(*workspace), AccDataErrorCode::H_SINGLEOP_ERROR);
 }
 
-TEST_F(TestNormalize, TestRunInputTypeError) // 输入数据类型非FP32
+TEST_F(TestNormalize, TestRunInputTypeError) // 输入数据类型非FP32/UINT8
 {
     PrepareOpSpec();
-    PrepareWorkSpace<uint8_t>();
+    PrepareWorkSpace<Float16>();
     Normalize normalize(*opSpec);
     EXPECT_EQ(normalize.Run(*workspace), AccDataErrorCode::H_SINGLEOP_ERROR);
 }
@@ -704,6 +704,43 @@ TEST_F(TestPipelineRun, RunWithOutput) // RunWithOutput
     }
 }
 
+TEST_F(TestPipelineRun, RunIntoOutputBuffer) // RunIntoOutputBuffer
+{
+    AccDataErrorCode errCode;
+    auto inputTensorUint8 = SetupInputTensorList<uint8_t>({ 1, 64, 48, 3 }, TensorLayout::NHWC);
+
+    auto pipe = AccDataPipeline::Create(MIN_BATCH_SIZE, MIN_THREAD_NUM, MIN_QUEUE_DEPTH, false);
+    auto externalInput = OpsExternalSource();
+    auto toTensor = OpsToTensor(externalInput.outputName, TensorLayout::NCHW);
+
+    errCode = pipe->Build({ externalInput.spec, toTensor.spec }, { toTensor.outputName });
+    EXPECT_EQ(errCode, AccDataErrorCode::H_OK);
+
+    std::vector<float> data(1 * 3 * 64 * 48, -1.0f); // output shape 1, 3, 64, 48
+    auto outputBuffer = AccDataTensorList::Create(1);
+    std::shared_ptr<void> dataPtr(data.data(), [](void *) {});
+    errCode = outputBuffer->operator[](0).ShareData(dataPtr, { 1, 3, 64, 48 }, TensorDataType::FP32);
+    EXPECT_EQ(errCode, AccDataErrorCode::H_OK);
+
+    std::vector<std::shared_ptr<AccDataTensorList>> outputs;
+    errCode = pipe->RunInto({ { externalInput.outputName, inputTensorUint8 } }, outputs, false, { outputBuffer });
+    EXPECT_EQ(errCode, AccDataErrorCode::H_OK);
+    ASSERT_EQ(outputs.size(), 1);
+    EXPECT_EQ(outputs[0]->operator[](0).RawDataPtr().get(), data.data());
+    EXPECT_EQ(data[0], 0.0f);
+    outputs[0]->operator[](0).Reset();
+
+    // a buffer too small for the result is left alone
+    std::vector<float> small(1, -1.0f);
+    std::shared_ptr<void> smallPtr(small.data(), [](void *) {});
+    errCode = outputBuffer->operator[](0).ShareData(smallPtr, { 1 }, TensorDataType::FP32);
+    EXPECT_EQ(errCode, AccDataErrorCode::H_OK);
+    errCode = pipe->RunInto({ { externalInput.outputName, inputTensorUint8 } }, outputs, false, { outputBuffer });
+    EXPECT_EQ(errCode, AccDataErrorCode::H_OK);
+    EXPECT_NE(outputs[0]->operator[](0).RawDataPtr().get(), small.data());
+    EXPECT_EQ(small[0], -1.0f);
+}
+
 TEST_F(TestPipelineRun, GetoutputRunError) // GetoutputRunError
 {
     AccDataErrorCode errCode;
@@ -0,0 +1,95 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * @Description: Half precision conversion of the result rows.
+ * @Version: 1.0
+ * @Date: 2025-10-20 10:00:00
+ * @LastEditors: dev
+ * @LastEditTime: 2025-10-20 10:00:00
+ */
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tensor/tensor.h"
+
+namespace {
+
+using namespace acclib::accdata;
+
+TEST(TestFloat16, TestScalarRoundTrip)
+{
+    EXPECT_EQ(Float16(1.0f).bits, 0x3C00);
+    EXPECT_EQ(Float16(-2.0f).bits, 0xC000);
+    EXPECT_EQ(Float16(65504.0f).bits, 0x7BFF);
+    EXPECT_EQ(Float16(65520.0f).bits, 0x7C00);  // rounds to inf
+    EXPECT_EQ(Float16(5.9604644775390625e-8f).bits, 0x0001);  // smallest subnormal
+    EXPECT_EQ(Float16(1.0f + 1.0f / 2048).bits, 0x3C00);  // tie to even
+    EXPECT_TRUE(std::isnan(static_cast<float>(Float16(std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_FLOAT_EQ(static_cast<float>(Float16(0.5f)), 0.5f);
+    EXPECT_FLOAT_EQ(static_cast<float>(Float16::ToFloat(0x0001)), 5.9604644775390625e-8f);
+}
+
+TEST(TestFloat16, TestBFloat16RoundTrip)
+{
+    EXPECT_EQ(BFloat16(1.0f).bits, 0x3F80);
+    EXPECT_EQ(BFloat16(-2.0f).bits, 0xC000);
+    EXPECT_EQ(BFloat16(1.0f + 1.0f / 256).bits, 0x3F80);  // tie to even
+    EXPECT_EQ(BFloat16(1.0f + 3.0f / 256).bits, 0x3F82);  // tie to even, rounds up
+    EXPECT_TRUE(std::isnan(static_cast<float>(BFloat16(std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_FLOAT_EQ(static_cast<float>(BFloat16(0.5f)), 0.5f);
+}
+
+TEST(TestFloat16, TestConvertRowMatchesScalar)
+{
+    // odd length so that both the vector body and the scalar tail are covered
+    constexpr int64_t length = 1037;
+    std::vector<float> src(length);
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dis(-3.0f, 3.0f);
+    for (auto &v : src) {
+        v = dis(gen);
+    }
+    src[0] = 1e-6f;
+    src[1] = 70000.0f;
+
+    std::vector<Float16> half(length);
+    std::vector<BFloat16> bhalf(length);
+    ConvertFloatRow(src.data(), half.data(), length);
+    ConvertFloatRow(src.data(), bhalf.data(), length);
+    for (int64_t i = 0; i < length; ++i) {
+        ASSERT_EQ(half[i].bits, Float16::FromFloat(src[i])) << "index " << i;
+        ASSERT_EQ(bhalf[i].bits, BFloat16::FromFloat(src[i])) << "index " << i;
+    }
+}
+
+TEST(TestFloat16, TestTensorDataType)
+{
+    EXPECT_EQ(TensorDataTypeEnum<Float16>(), TensorDataType::FP16);
+    EXPECT_EQ(TensorDataTypeEnum<BFloat16>(), TensorDataType::BF16);
+    EXPECT_EQ(TensorDataTypeSize(TensorDataType::FP16), 2);
+    EXPECT_EQ(TensorDataTypeSize(TensorDataType::BF16), 2);
+
+    Tensor tensor;
+    tensor.Resize<Float16>({2, 3});
+    EXPECT_EQ(tensor.DataType(), TensorDataType::FP16);
+    EXPECT_EQ(tensor.GetSize(), 2 * 3 * sizeof(uint16_t));
+}
+
+} // namespace
@@ -88,6 +88,38 @@ TEST_F(TestTensor, TestResize)
     ASSERT_EQ(originTensor.GetSize(), mBytes720p);
 }
 
+size_t g_allocatedBytes = 0;
+std::shared_ptr<void> CountingAllocator(size_t numBytes)
+{
+    g_allocatedBytes += numBytes;
+    return std::shared_ptr<void>(::operator new(numBytes, std::align_val_t(ACCDATA_ALIGN_SIZE)),
+        [](void *ptr) { ::operator delete(ptr, std::align_val_t(ACCDATA_ALIGN_SIZE)); });
+}
+
+std::shared_ptr<void> FailingAllocator(size_t)
+{
+    return nullptr;
+}
+
+TEST_F(TestTensor, TestResizeWithAllocator)
+{
+    g_allocatedBytes = 0;
+    SetTensorAllocator(CountingAllocator);
+    Tensor tensor;
+    tensor.Resize(mShapeNchw360p, TensorDataType::FP32);
+    tensor.Resize(mShapeNchw360p, TensorDataType::UINT8);
+    EXPECT_EQ(g_allocatedBytes, mBytes360p);
+
+    SetTensorAllocator(FailingAllocator);
+    EXPECT_THROW(tensor.Resize(mShapeNchw720p, TensorDataType::FP32), std::bad_alloc);
+    EXPECT_EQ(tensor.GetSize(), mBytes360p);
+
+    SetTensorAllocator(nullptr);
+    tensor.Resize(mShapeNchw720p, TensorDataType::FP32);
+    EXPECT_EQ(tensor.GetSize(), mBytes720p);
+    EXPECT_EQ(g_allocatedBytes, mBytes360p);
+}
+
 TEST_F(TestTensor, TestCopy)
 {
     Tensor originTensor;
@@ -107,6 +107,8 @@ mkdir -p "${OUTPUT_DIR}/lib"
 mkdir -p "${OUTPUT_DIR}/opensource/libjpeg-turbo"
 mkdir -p "${OUTPUT_DIR}/opensource/FFmpeg"
 mkdir -p "${OUTPUT_DIR}/opensource/soxr"
+mkdir -p "${OUTPUT_DIR}/opensource/libpng"
+mkdir -p "${OUTPUT_DIR}/opensource/libwebp"
 
 # 拷贝 AccData 头文件
 if compgen -G "${ACC_INCLUDE_SRC_DIR}/*.h" > /dev/null; then
@@ -166,6 +168,8 @@ copy_opensource_outputs() {
 copy_opensource_outputs libjpeg-turbo
 copy_opensource_outputs FFmpeg
 copy_opensource_outputs soxr
+copy_opensource_outputs libpng
+copy_opensource_outputs libwebp
 
 TAR_NAME="acc_sdk_linux-aarch64.tar.gz"
 tar -czvf "${OUTPUT_DIR}/${TAR_NAME}" --exclude="${TAR_NAME}" -C "${OUTPUT_DIR}" $(ls -A "${OUTPUT_DIR}")
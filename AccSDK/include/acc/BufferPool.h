@@ -0,0 +1,108 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: Buffer pool header file.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include "acc/ErrorCode.h"
+
+namespace Acc {
+/**
+ * @brief Memory source of the buffer pool, implement it to hand the SDK memory from a user-provided allocator
+ *
+ * Both methods may be called from several threads at once.
+ */
+class BufferAllocator {
+public:
+    virtual ~BufferAllocator() = default;
+    /**
+     * @brief Allocate memory for a buffer
+     *
+     * @param bytes Number of bytes, a multiple of 64
+     * @return void* Memory aligned to at least 64 bytes, nullptr when out of memory
+     */
+    virtual void* Allocate(size_t bytes) = 0;
+    /**
+     * @brief Free memory returned by Allocate
+     *
+     * @param ptr Memory returned by Allocate
+     * @param bytes Number of bytes passed to Allocate
+     */
+    virtual void Deallocate(void* ptr, size_t bytes) = 0;
+};
+
+enum class BufferAllocatorType {
+    DEFAULT = 0,   // operator new with 64 byte alignment
+    HUGE_PAGE = 1, // 2MB aligned memory advised for transparent huge pages, for buffers of 2MB and more
+};
+
+/**
+ * @brief Counters of the buffer pool, bytes are counted by size class
+ */
+struct BufferPoolStats {
+    size_t requests = 0;       // buffers handed out
+    size_t hits = 0;           // buffers handed out from the cache
+    size_t inUseBytes = 0;     // bytes handed out and not released yet
+    size_t cachedBytes = 0;    // bytes kept for reuse
+    size_t capacity = 0;       // limit of cachedBytes
+};
+
+/**
+ * @brief Select a built-in allocator for the buffers of every Image and Tensor the SDK creates
+ *
+ * The cached buffers of the previous allocator are freed, buffers still in use go back to the allocator that
+ * created them.
+ *
+ * @param type allocator type
+ * @return ErrorCode
+ */
+ErrorCode SetBufferAllocator(BufferAllocatorType type);
+
+/**
+ * @brief Use a user-provided allocator for the buffers of every Image and Tensor the SDK creates
+ *
+ * @param allocator user-provided allocator, kept alive until its last buffer is released
+ * @return ErrorCode
+ */
+ErrorCode SetBufferAllocator(std::shared_ptr<BufferAllocator> allocator);
+
+/**
+ * @brief Set the limit of bytes kept for reuse, released buffers beyond it are freed at once. 0 disables reuse
+ *
+ * @param bytes limit in bytes
+ */
+void SetBufferPoolCapacity(size_t bytes);
+
+/**
+ * @brief Get the counters of the buffer pool
+ *
+ * @return BufferPoolStats
+ */
+BufferPoolStats GetBufferPoolStats();
+
+/**
+ * @brief Free every buffer kept for reuse
+ */
+void TrimBufferPool();
+} // namespace Acc
+#endif // BUFFER_POOL_H
@@ -71,6 +71,9 @@ enum class SubErrorCode : uint32_t {
     LIBJPEG_INIT_FAILURE = OPENSOURCE_ERROR_BEGIN + 2,
     LIBJPEG_READ_FILE_FAILURE = OPENSOURCE_ERROR_BEGIN + 3,
     FFMPEG_COMMON_FAILURE = OPENSOURCE_ERROR_BEGIN + 4,
+    LIBPNG_READ_FILE_FAILURE = OPENSOURCE_ERROR_BEGIN + 5,
+    LIBWEBP_READ_FILE_FAILURE = OPENSOURCE_ERROR_BEGIN + 6,
+    LIBJPEG_ENCODE_FAILURE = OPENSOURCE_ERROR_BEGIN + 7,
     OPENSOURCE_ERROR_END,
 
     // THIRD_PARTY_ERROR 3000~3999
@@ -131,5 +134,11 @@ constexpr ErrorCode ERR_LIBJPEG_READ_FILE_FAILURE =
     MakeErrorCode(ModuleID::ACC, ErrorType::OPENSOURCE_ERROR, SubErrorCode::LIBJPEG_READ_FILE_FAILURE);
 constexpr ErrorCode ERR_FFMPEG_COMMON_FAILURE =
     MakeErrorCode(ModuleID::ACC, ErrorType::OPENSOURCE_ERROR, SubErrorCode::FFMPEG_COMMON_FAILURE);
+constexpr ErrorCode ERR_LIBPNG_READ_FILE_FAILURE =
+    MakeErrorCode(ModuleID::ACC, ErrorType::OPENSOURCE_ERROR, SubErrorCode::LIBPNG_READ_FILE_FAILURE);
+constexpr ErrorCode ERR_LIBWEBP_READ_FILE_FAILURE =
+    MakeErrorCode(ModuleID::ACC, ErrorType::OPENSOURCE_ERROR, SubErrorCode::LIBWEBP_READ_FILE_FAILURE);
+constexpr ErrorCode ERR_LIBJPEG_ENCODE_FAILURE =
+    MakeErrorCode(ModuleID::ACC, ErrorType::OPENSOURCE_ERROR, SubErrorCode::LIBJPEG_ENCODE_FAILURE);
 } // namespace Acc
 #endif // ERROR_CODE_H
\ No newline at end of file
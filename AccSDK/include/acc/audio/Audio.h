@@ -39,6 +39,17 @@ ErrorCode LoadAudioSingle(const std::string path, Tensor& result, int& originalS
  * @param sr: Optional target sample rate. If not specified, the audio will not be resampled.
  * @return ErrorCode
  */
+ErrorCode LoadAudioFromBuffer(const uint8_t* data, size_t size, Tensor& result, int& originalSr,
+                              std::optional<int> sr = std::nullopt);
+/**
+ * @brief Loads WAV audio already held in memory, e.g. an HTTP body, and optionally resamples it.
+ * @param data: Encoded WAV bytes, only read during the call.
+ * @param size: Number of bytes.
+ * @param result: Output tensor that stores the decoded (and resampled) mono audio data.
+ * @param original_sr: Sample rate of the original audio before resampling.
+ * @param sr: Optional target sample rate. If not specified, the audio will not be resampled.
+ * @return ErrorCode
+ */
 ErrorCode LoadAudioBatch(const std::vector<std::string> wavFiles, std::vector<Tensor>& results,
                          std::vector<int>& originalSrs, std::optional<int> sr = std::nullopt);
 /**
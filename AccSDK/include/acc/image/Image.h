@@ -22,12 +22,15 @@
 #ifndef IMAGE_H
 #define IMAGE_H
 
+#include <cstdint>
+#include <string>
 #include <vector>
 #include "acc/tensor/Tensor.h"
 #include "acc/ErrorCode.h"
 #include "acc/image/ImageFormat.h"
 
 namespace Acc {
+constexpr int DEFAULT_JPEG_QUALITY = 95;
 
 class Image {
 public:
@@ -62,7 +65,7 @@ public:
      *
      * @param data user input data
      * @param imSize Image size
-     * @param imFormat image format, range is RGB, BGR, RGB_PLANAR, BGR_PLANAR
+     * @param imFormat image format, range is RGB, BGR, RGB_PLANAR, BGR_PLANAR, NV12, YUV420P
      * @param dataType data type, Only support UINT8
      * @param device device str, range is cpu
      */
@@ -74,7 +77,7 @@ public:
      *
      * @param data user input data
      * @param imSize Image size
-     * @param imFormat image format, range is RGB, BGR, RGB_PLANAR, BGR_PLANAR
+     * @param imFormat image format, range is RGB, BGR, RGB_PLANAR, BGR_PLANAR, NV12, YUV420P
      * @param dataType data type, Only support UINT8
      * @param device device str, range is cpu
      */
@@ -84,17 +87,46 @@ public:
     /**
      * @brief Construct a new Image object from given path
      *
+     * The file is decoded to RGB by the decoder matching its magic bytes, jpg, jpeg, png and webp are supported.
+     *
      * @param path user input path
      * @param device device str, range is cpu
      */
     Image(const char* path, const char* device);
+
+    /**
+     * @brief Construct a new Image object by decoding jpeg, png or webp bytes held in memory, no file is touched
+     *
+     * @param data encoded image bytes, only read during construction
+     * @param size number of bytes
+     * @param device device str, range is cpu
+     */
+    Image(const uint8_t* data, size_t size, const char* device = "cpu");
     /**
-     * @brief Image deep copy
+     * @brief Image copy, copy-on-write like Tensor::Clone
      *
      * @param Image dst Image
      * @return ErrorCode
      */
     ErrorCode Clone(Image& other) const;
+    /**
+     * @brief Give the image a private copy of its pixels if they are shared, call it before writing in place
+     *
+     * @return ErrorCode
+     */
+    ErrorCode MakeUnique();
+
+    /**
+     * @brief Encode the image to jpeg bytes in memory, safe to call from several threads at once
+     *
+     * Every thread reuses its own TurboJPEG compressor. Only RGB and BGR images are supported, chroma is
+     * subsampled 4:2:0.
+     *
+     * @param encoded Output jpeg bytes
+     * @param quality jpeg quality, range is [1, 100]
+     * @return ErrorCode
+     */
+    ErrorCode EncodeJpeg(std::vector<uint8_t>& encoded, int quality = DEFAULT_JPEG_QUALITY) const;
 
     /**
      * @brief Get size property
@@ -135,9 +167,9 @@ public:
     /**
      * @brief Get device property
      *
-     * @return std::unique_ptr<char[]>
+     * @return const char*
      */
-    std::unique_ptr<char[]> Device() const;
+    const char* Device() const;
     /**
      * @brief Get raw ptr
      *
@@ -157,5 +189,107 @@ private:
     ImageFormat format_ = ImageFormat::UNDEFINED;
     std::vector<size_t> size_ = {};
 };
+
+/**
+ * @brief Size of an image file, read from its header only
+ */
+struct ImageProbeInfo {
+    ErrorCode status = SUCCESS; // Result of probing this image
+    size_t width = 0;
+    size_t height = 0;
+};
+
+/**
+ * @brief Read the size of a jpeg image from its header without decoding any pixels
+ *
+ * @param path Input jpeg image path
+ * @param info Output image size, info.status is set to the returned error code
+ * @return ErrorCode
+ */
+ErrorCode ProbeImage(const char* path, ImageProbeInfo& info);
+
+/**
+ * @brief Read the size of many jpeg images concurrently, see ProbeImage
+ *
+ * Every item carries its own status, so one broken file does not hide the others.
+ *
+ * @param paths Input jpeg image paths
+ * @param infos Output image sizes, one entry per path
+ * @return ErrorCode SUCCESS when every image is probed, otherwise the error of the first failed image
+ */
+ErrorCode ProbeImages(const std::vector<std::string>& paths, std::vector<ImageProbeInfo>& infos);
+
+/**
+ * @brief Encoded jpeg, png or webp bytes owned by the caller
+ */
+struct ImageBuffer {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
+/**
+ * @brief Options shared by every image of DecodeImages
+ */
+struct ImageDecodeOptions {
+    size_t resizeWidth = 0;  // Bicubic resize target, 0 together with resizeHeight keeps the original size
+    size_t resizeHeight = 0;
+};
+
+/**
+ * @brief Decode many jpeg, png or webp images concurrently on the SDK thread pool
+ *
+ * The decoder of every item is picked from its magic bytes, so a batch may mix formats. Every worker reuses the
+ * jpeg decompressor of its own thread. Every item carries its own status, so one broken file does not fail the
+ * others, the image of a failed item is left empty.
+ * With a resize target every image is decoded and resized in one pass, see ImageDecodeResize.
+ *
+ * @param paths Input image paths
+ * @param images Output RGB images, one entry per path
+ * @param statuses Output decode result of every image
+ * @param options Decode options
+ * @return ErrorCode SUCCESS when every image is decoded, otherwise the error of the first failed image
+ */
+ErrorCode DecodeImages(const std::vector<std::string>& paths, std::vector<Image>& images,
+                       std::vector<ErrorCode>& statuses, const ImageDecodeOptions& options = {});
+
+/**
+ * @brief Decode many in-memory images concurrently, see DecodeImages above
+ *
+ * @param buffers Input encoded image bytes, kept alive by the caller until the call returns
+ * @param images Output RGB images, one entry per buffer
+ * @param statuses Output decode result of every image
+ * @param options Decode options
+ * @return ErrorCode SUCCESS when every image is decoded, otherwise the error of the first failed image
+ */
+ErrorCode DecodeImages(const std::vector<ImageBuffer>& buffers, std::vector<Image>& images,
+                       std::vector<ErrorCode>& statuses, const ImageDecodeOptions& options = {});
+
+/**
+ * @brief Decode a base64 encoded jpeg, png or webp image, as sent in json payloads and data urls
+ *
+ * The base64 text is decoded with SIMD into a buffer reused by the calling thread, which is handed to the image
+ * decoder directly. A "data:image/jpeg;base64," prefix is accepted.
+ *
+ * @param text Input base64 text, not null terminated
+ * @param length Input text length in bytes
+ * @param image Output RGB image
+ * @return ErrorCode
+ */
+ErrorCode DecodeImageBase64(const char* text, size_t length, Image& image);
+
+/**
+ * @brief Encode many images to jpeg concurrently on the SDK thread pool, see Image::EncodeJpeg
+ *
+ * Every item carries its own status, so one unsupported image does not fail the others, the bytes of a failed
+ * item are left empty.
+ *
+ * @param images Input RGB or BGR images
+ * @param encoded Output jpeg bytes, one entry per image
+ * @param statuses Output encode result of every image
+ * @param quality jpeg quality, range is [1, 100]
+ * @return ErrorCode SUCCESS when every image is encoded, otherwise the error of the first failed image
+ */
+ErrorCode EncodeJpegs(const std::vector<Image>& images, std::vector<std::vector<uint8_t>>& encoded,
+                      std::vector<ErrorCode>& statuses, int quality = DEFAULT_JPEG_QUALITY);
 } // namespace Acc
 #endif // IMAGE_H
@@ -23,7 +23,19 @@
 #define IMAGE_FORMAT_H
 
 namespace Acc {
-enum class ImageFormat { UNDEFINED = -1, RGB = 12, BGR = 13, RGB_PLANAR = 69, BGR_PLANAR = 70 };
+/**
+ * NV12 and YUV420P hold a 4:2:0 frame as a full resolution Y plane followed by the half resolution chroma, the
+ * interleaved UV plane for NV12 and the U plane then the V plane for YUV420P. Width and height must be even.
+ */
+enum class ImageFormat {
+    UNDEFINED = -1,
+    NV12 = 1,
+    RGB = 12,
+    BGR = 13,
+    RGB_PLANAR = 69,
+    BGR_PLANAR = 70,
+    YUV420P = 1000
+};
 
 } // namespace Acc
 #endif
\ No newline at end of file
@@ -50,6 +50,67 @@ ErrorCode ImageCrop(const Image& src, Image& dst, uint32_t top, uint32_t left, u
  */
 ErrorCode ImageResize(const Image& src, Image& dst, size_t resizeW, size_t resizeH,
                       Interpolation interpolation = Interpolation::BICUBIC, DeviceMode deviceMode = DeviceMode::CPU);
+
+/**
+ * @description: Decode only a crop rectangle of a jpeg file, equivalent to decoding it and running ImageCrop.
+ * Rows outside the region are skipped and only the MCU columns covering it are decompressed.
+ * @param path: Input jpeg image path.
+ * @param dst: Output RGB image of the crop size.
+ * @param top: Top boundary position of the crop.
+ * @param left: Left boundary position of the crop.
+ * @param height: Crop height.
+ * @param width: Crop width.
+ */
+ErrorCode ImageDecodeCrop(const char* path, Image& dst, uint32_t top, uint32_t left, uint32_t height, uint32_t width);
+
+/**
+ * @description: Decode a jpeg, png or webp file and resize it in one step.
+ * A jpeg file is decoded at the smallest 1/2, 1/4 or 1/8 DCT scale that is still at least the target size, the
+ * remaining ratio is done by the bicubic resize band by band while decoding, so the decoded image is never held
+ * in full. Much cheaper than a full decode when the target is a few times smaller. Png and webp files are decoded
+ * in full and resized with the same kernel.
+ * @param path: Input jpg, jpeg, png or webp image path.
+ * @param dst: Output RGB image of the target size.
+ * @param resizeW: resize width.
+ * @param resizeH: resized height.
+ * @param interpolation: interpolation algorithm.
+ * @param deviceMode: The mode for running operator.
+ */
+ErrorCode ImageDecodeResize(const char* path, Image& dst, size_t resizeW, size_t resizeH,
+                            Interpolation interpolation = Interpolation::BICUBIC,
+                            DeviceMode deviceMode = DeviceMode::CPU);
+
+/**
+ * @description: Convert a NV12 or YUV420P image to RGB and resize it in one step.
+ * Chroma is upsampled straight to the target size and the color conversion runs on output pixels only, so the
+ * full resolution RGB image is never produced. BT.601 limited range is assumed.
+ * @param src: Input NV12 or YUV420P image.
+ * @param dst: Output RGB image of the target size.
+ * @param resizeW: resize width.
+ * @param resizeH: resized height.
+ * @param interpolation: interpolation algorithm.
+ * @param deviceMode: The mode for running operator.
+ */
+ErrorCode ImageYuvToRgbResize(const Image& src, Image& dst, size_t resizeW, size_t resizeH,
+                              Interpolation interpolation = Interpolation::BICUBIC,
+                              DeviceMode deviceMode = DeviceMode::CPU);
+
+/**
+ * @description: ImageYuvToRgbResize followed by to tensor and normalize, fused into one pass.
+ * Each output value is (rgb / 255 - mean) / std in float32.
+ * @param src: Input NV12 or YUV420P image.
+ * @param dst: Output float32 tensor of shape [1, 3, resizeH, resizeW] for NCHW or [1, resizeH, resizeW, 3] for NHWC.
+ * @param resizeW: resize width.
+ * @param resizeH: resized height.
+ * @param mean: Per channel mean, 3 values in RGB order.
+ * @param std: Per channel standard deviation, 3 non zero values in RGB order.
+ * @param format: Output tensor format, NCHW or NHWC.
+ * @param deviceMode: The mode for running operator.
+ */
+ErrorCode ImageYuvToRgbResizeNormalize(const Image& src, Tensor& dst, size_t resizeW, size_t resizeH,
+                                       const std::vector<float>& mean, const std::vector<float>& std,
+                                       TensorFormat format = TensorFormat::NCHW,
+                                       DeviceMode deviceMode = DeviceMode::CPU);
 } // namespace Acc
 
 #endif // IMAGE_OPS_H
\ No newline at end of file
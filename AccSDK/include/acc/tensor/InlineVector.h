@@ -0,0 +1,199 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: Fixed capacity vector for tensor metadata.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#ifndef INLINE_VECTOR_H
+#define INLINE_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace Acc {
+constexpr size_t MAX_TENSOR_DIMS = 8;
+
+/**
+ * @brief Vector with its elements stored inline, used for shapes and strides so that creating and copying
+ * a tensor does not touch the heap
+ *
+ * @tparam T element type
+ * @tparam N capacity, growing past it throws std::runtime_error
+ */
+template <typename T, size_t N>
+class InlineVector {
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    InlineVector() = default;
+
+    InlineVector(std::initializer_list<T> values)
+    {
+        assign(values.begin(), values.end());
+    }
+
+    InlineVector(const std::vector<T>& values)
+    {
+        assign(values.begin(), values.end());
+    }
+
+    operator std::vector<T>() const
+    {
+        return std::vector<T>(begin(), end());
+    }
+
+    template <typename It>
+    void assign(It first, It last)
+    {
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        CheckCapacity(count);
+        std::copy(first, last, data_);
+        size_ = count;
+    }
+
+    void push_back(const T& value)
+    {
+        CheckCapacity(size_ + 1);
+        data_[size_++] = value;
+    }
+
+    void resize(size_t count, const T& value = T())
+    {
+        CheckCapacity(count);
+        if (count > size_) {
+            std::fill(data_ + size_, data_ + count, value);
+        }
+        size_ = count;
+    }
+
+    void clear()
+    {
+        size_ = 0;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    static constexpr size_t capacity()
+    {
+        return N;
+    }
+
+    T* data()
+    {
+        return data_;
+    }
+
+    const T* data() const
+    {
+        return data_;
+    }
+
+    iterator begin()
+    {
+        return data_;
+    }
+
+    iterator end()
+    {
+        return data_ + size_;
+    }
+
+    const_iterator begin() const
+    {
+        return data_;
+    }
+
+    const_iterator end() const
+    {
+        return data_ + size_;
+    }
+
+    T& operator[](size_t i)
+    {
+        return data_[i];
+    }
+
+    const T& operator[](size_t i) const
+    {
+        return data_[i];
+    }
+
+    T& front()
+    {
+        return data_[0];
+    }
+
+    const T& front() const
+    {
+        return data_[0];
+    }
+
+    T& back()
+    {
+        return data_[size_ - 1];
+    }
+
+    const T& back() const
+    {
+        return data_[size_ - 1];
+    }
+
+    friend bool operator==(const InlineVector& lhs, const InlineVector& rhs)
+    {
+        return lhs.size_ == rhs.size_ && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator!=(const InlineVector& lhs, const InlineVector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    static void CheckCapacity(size_t count)
+    {
+        if (count > N) {
+            throw std::runtime_error("The number of dimensions exceeds the maximum supported.");
+        }
+    }
+
+    T data_[N] = {};
+    size_t size_ = 0;
+};
+
+using TensorDims = InlineVector<size_t, MAX_TENSOR_DIMS>;
+using TensorStrides = InlineVector<uint32_t, MAX_TENSOR_DIMS>;
+} // namespace Acc
+#endif // INLINE_VECTOR_H
@@ -29,19 +29,22 @@
 #include "acc/tensor/TensorDataType.h"
 
 constexpr size_t ONE_BYTE = 1;
+constexpr size_t TWO_BYTE = 2;
 constexpr size_t FOUR_BYTE = 4;
 
 namespace Acc {
 /**
  * @brief Get the Byte Size object
  *
- * @param type data type, range is FLOAT32, INT8, UINT8
+ * @param type data type, range is FLOAT32, FLOAT16, BFLOAT16, INT8, UINT8
  * @return constexpr size_t Number of bytes corresponding to the type
  */
 constexpr size_t GetByteSize(DataType type)
 {
     if (type == DataType::INT8 || type == DataType::UINT8) {
         return ONE_BYTE;
+    } else if (type == DataType::FLOAT16 || type == DataType::BFLOAT16) {
+        return TWO_BYTE;
     } else if (type == DataType::FLOAT32) {
         return FOUR_BYTE;
     }
@@ -76,32 +79,44 @@ public:
     /**
      * @brief Construct a new Tensor object
      *
-     * @param dataPtr user input data
-     * @param shape tensor shape
-     * @param dataType data type, range is FLOAT32, INT8, UINT8
+     * @param dataPtr user input data, the tensor and its clones keep it alive through the shared ptr
+     * @param shape tensor shape, at most MAX_TENSOR_DIMS dimensions
+     * @param dataType data type, range is FLOAT32, FLOAT16, BFLOAT16, INT8, UINT8
      * @param format layout format, range is ND, NHWC, NCHW
      * @param device device str, range is cpu
      */
-    Tensor(std::shared_ptr<void> dataPtr, const std::vector<size_t>& shape, DataType dataType = DataType::FLOAT32,
+    Tensor(std::shared_ptr<void> dataPtr, const TensorDims& shape, DataType dataType = DataType::FLOAT32,
            TensorFormat format = TensorFormat::ND, const char* device = "cpu");
     /**
      * @brief Construct a new Tensor object
      *
      * @param data user input data
-     * @param shape tensor shape
-     * @param dataType data type, range is FLOAT32, INT8, UINT8
+     * @param shape tensor shape, at most MAX_TENSOR_DIMS dimensions
+     * @param dataType data type, range is FLOAT32, FLOAT16, BFLOAT16, INT8, UINT8
      * @param format layout format, range is ND, NHWC, NCHW
      * @param device device str, range is cpu
      */
-    Tensor(void* data, const std::vector<size_t>& shape, DataType dataType = DataType::FLOAT32,
+    Tensor(void* data, const TensorDims& shape, DataType dataType = DataType::FLOAT32,
            TensorFormat format = TensorFormat::ND, const char* device = "cpu");
     /**
-     * @brief Tensor deep copy to a new tensor
+     * @brief Copy to a new tensor, copy-on-write
+     *
+     * The clone shares the data buffer with this tensor when this tensor owns it, the bytes are copied later by
+     * MakeUnique on whichever side is written first. Tensors wrapping user memory are deep copied right away.
      *
      * @param tensor dst tensor
      * @return ErrorCode
      */
     ErrorCode Clone(Tensor& tensor) const;
+    /**
+     * @brief Make sure no other tensor or image sees the data buffer, call it before writing in place
+     *
+     * Copies the data into a new buffer when the current one is shared, otherwise does nothing. Tensors wrapping
+     * user memory are left alone, the memory is written in place.
+     *
+     * @return ErrorCode
+     */
+    ErrorCode MakeUnique();
     /**
      * @brief Set the format
      *
@@ -112,9 +127,9 @@ public:
     /**
      * @brief Get shape property
      *
-     * @return const std::vector<size_t>&
+     * @return const TensorDims&
      */
-    const std::vector<size_t>& Shape() const;
+    const TensorDims& Shape() const;
     /**
      * @brief Get data type property
      *
@@ -124,9 +139,9 @@ public:
     /**
      * @brief Get device property
      *
-     * @return std::unique_ptr<char[]>
+     * @return const char*, a static string that stays valid for the lifetime of the program
      */
-    std::unique_ptr<char[]> Device() const;
+    const char* Device() const;
     /**
      * @brief Get format property
      *
@@ -154,9 +169,9 @@ public:
     /**
      * @brief Get auxinfo property
      *
-     * @return TensorAuxInfo
+     * @return const TensorAuxInfo&
      */
-    TensorAuxInfo AuxInfo() const;
+    const TensorAuxInfo& AuxInfo() const;
 
 private:
     /**
@@ -164,19 +179,28 @@ private:
      *
      */
     void FillAuxInfo();
+    /**
+     * @brief Copy the data into a new buffer from the buffer pool
+     *
+     * @param dstPtr output buffer
+     * @return ErrorCode
+     */
+    ErrorCode CopyData(std::shared_ptr<void>& dstPtr) const;
     /**
      * @brief check params in tensor constructor
      *
+     * @param device device str passed to the constructor
      */
-    void CheckTensorParams();
+    void CheckTensorParams(const char* device);
 
 private:
     int32_t deviceId_ = -1;
-    std::vector<size_t> shape_ = {};
+    TensorDims shape_ = {};
     DataType dataType_ = DataType::FLOAT32;
     TensorFormat format_ = TensorFormat::ND;
     std::shared_ptr<void> dataPtr_ = nullptr;
-    std::string device_ = "cpu";
+    bool ownsData_ = false; // false when constructed from a raw pointer, the memory then belongs to the user
+    DeviceMode device_ = DeviceMode::CPU;
     TensorAuxInfo auxInfo_ = {};
 };
 } // namespace Acc
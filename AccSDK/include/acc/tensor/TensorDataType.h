@@ -23,9 +23,9 @@
 #define TENSOR_DATA_TYPE_H
 #include <cstddef>   // size_t
 #include <cstdint>   // uint32_t
-#include <vector>
+#include "acc/tensor/InlineVector.h"
 namespace Acc {
-enum class DataType { INT8 = 2, UINT8 = 4, FLOAT32 = 0 };
+enum class DataType { INT8 = 2, UINT8 = 4, FLOAT32 = 0, FLOAT16 = 1, BFLOAT16 = 27 };
 
 enum class TensorFormat {
     ND = 2,
@@ -38,8 +38,8 @@ struct TensorAuxInfo {
     size_t elementNums;
     size_t perElementBytes;
     size_t totalBytes;
-    std::vector<uint32_t> memoryStrides;
-    std::vector<uint32_t> logicalStrides;
+    TensorStrides memoryStrides;
+    TensorStrides logicalStrides;
 };
 
 enum class Interpolation {
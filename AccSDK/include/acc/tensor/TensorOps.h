@@ -56,15 +56,17 @@ ErrorCode TensorResize(const Tensor& src, Tensor& dst, size_t resizedH, size_t r
 /**
  * @brief Normalizes input tensor using mean and standard deviation values.
  *        Applies the formula: output = (input - mean) / std for each channel.
+ *        UINT8 input is scaled by 1/255 first, in the same per-channel multiply-add.
  * @param src Input tensor to be normalized.
  * @param dst Output tensor to store the normalized result.
  * @param mean Vector of mean values for normalization, one value per channel.
  * @param std Vector of standard deviation values for normalization, one value per channel.
  * @param deviceMode Specifies the device mode for computation (CPU, NPU, DVPP, etc). Default is CPU.
+ * @param outputType Data type of dst, supports [FLOAT32/FLOAT16/BFLOAT16]. Default is FLOAT32.
  * @return ErrorCode
  */
 ErrorCode TensorNormalize(const Tensor& src, Tensor& dst, const std::vector<float>& mean, const std::vector<float>& std,
-                          DeviceMode deviceMode = DeviceMode::CPU);
+                          DeviceMode deviceMode = DeviceMode::CPU, DataType outputType = DataType::FLOAT32);
 
 /**
  * @brief Converts a tensor from one format to another, equivalent to torchvision.transforms.ToTensor
@@ -72,10 +74,11 @@ ErrorCode TensorNormalize(const Tensor& src, Tensor& dst, const std::vector<floa
  * @param dst  Output tensor to store the result.
  * @param format The target tensor format specifying the desired layout and supports [NHWC/NCHW]
  * @param deviceMode Specifies the device mode for computation (CPU, NPU, DVPP, etc). Default is CPU.
+ * @param outputType Data type of dst, supports [FLOAT32/FLOAT16/BFLOAT16]. Default is FLOAT32.
  * @return ErrorCode
  */
 ErrorCode TensorToTensor(const Tensor& src, Tensor& dst, TensorFormat format,
-                         DeviceMode deviceMode = DeviceMode::CPU);
+                         DeviceMode deviceMode = DeviceMode::CPU, DataType outputType = DataType::FLOAT32);
 } // namespace Acc
 
 #endif // TENSOR_OPS_H
@@ -25,6 +25,7 @@
 
 #include <vector>
 #include <set>
+#include <string>
 #include "acc/image/Image.h"
 
 namespace Acc {
@@ -38,6 +39,33 @@ namespace Acc {
  */
 ErrorCode VideoDecode(const char* path, const char* device, std::vector<Image>& frames,
                       const std::set<uint32_t>& frameIndices = std::set<uint32_t>{}, int sampleNum = -1);
+
+/**
+ * @brief Geometry and timing of a video file, read from its container metadata only
+ */
+struct VideoProbeInfo {
+    ErrorCode status = SUCCESS; // Result of probing this video
+    size_t width = 0;
+    size_t height = 0;
+    double fps = 0;
+    double duration = 0; // In seconds
+    int64_t totalFrames = 0;
+};
+
+/**
+ * @brief Read resolution, fps, duration and frame count of a mp4 video from its moov box without decoding
+ * @param path: video file path.
+ * @param info: result info, info.status is set to the returned error code.
+ */
+ErrorCode ProbeVideo(const char* path, VideoProbeInfo& info);
+
+/**
+ * @brief Probe many mp4 videos concurrently, see ProbeVideo. Every item carries its own status.
+ * @param paths: video file paths.
+ * @param infos: result infos, one entry per path.
+ * @return SUCCESS when every video is probed, otherwise the error of the first failed video.
+ */
+ErrorCode ProbeVideos(const std::vector<std::string>& paths, std::vector<VideoProbeInfo>& infos);
 } // namespace Acc
 
 #endif // VIDEO_H
\ No newline at end of file
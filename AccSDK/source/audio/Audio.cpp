@@ -31,6 +31,7 @@
 #include "acc/utils/LogImpl.h"
 #include "acc/utils/ErrorCodeUtils.h"
 #include "acc/utils/ThreadPool.h"
+#include "acc/utils/FilePrefetcher.h"
 #include "acc/tensor/Tensor.h"
 #include "securec.h"
 
@@ -41,12 +42,8 @@
 namespace {
 using namespace Acc;
 
-ErrorCode LoadAudioData(const char* path, Acc::AudioData& audioData)
+ErrorCode CheckAudioData(const Acc::AudioData& audioData)
 {
-    ErrorCode ret = Acc::AudioDecode(path, audioData);
-    if (ret != SUCCESS) {
-        return ret;
-    }
     if (audioData.samples.empty() || audioData.numChannels <= 0 || audioData.sampleRate <= 0) {
         LogError << "Invalid audio data: empty samples, zero channels or zero sample rate."
                  << GetErrorInfo(ERR_INVALID_PARAM);
@@ -55,6 +52,18 @@ ErrorCode LoadAudioData(const char* path, Acc::AudioData& audioData)
     return SUCCESS;
 }
 
+ErrorCode LoadAudioData(const char* path, Acc::AudioData& audioData)
+{
+    ErrorCode ret = Acc::AudioDecode(path, audioData);
+    return ret != SUCCESS ? ret : CheckAudioData(audioData);
+}
+
+ErrorCode LoadAudioData(const uint8_t* data, size_t size, Acc::AudioData& audioData)
+{
+    ErrorCode ret = Acc::AudioDecode(data, size, audioData);
+    return ret != SUCCESS ? ret : CheckAudioData(audioData);
+}
+
 ErrorCode ProcessAudioChannels(const Acc::AudioData& audioData, std::vector<float>& monoAudio)
 {
     const size_t numSamplesPerChannel = audioData.samples.size() / audioData.numChannels;
@@ -170,22 +179,11 @@ ErrorCode ClearAudioBuffer(Tensor& buffer)
 
     return SUCCESS;
 }
-} // namespace
-
-namespace Acc {
-
-ErrorCode LoadAudio(const char* path, Tensor& result, int& originalSr, std::optional<int> sr)
+ErrorCode ConvertAudioData(const Acc::AudioData& audioData, Tensor& result, std::optional<int> sr)
 {
-    Acc::AudioData audioData;
-    ErrorCode ret = LoadAudioData(path, audioData);
-    originalSr = audioData.sampleRate;
-    if (ret != SUCCESS) {
-        LogError << "Load audio data failed" << GetErrorInfo(ret);
-        return ret;
-    }
-
+    int originalSr = static_cast<int>(audioData.sampleRate);
     std::vector<float> monoAudio;
-    ret = ProcessAudioChannels(audioData, monoAudio);
+    ErrorCode ret = ProcessAudioChannels(audioData, monoAudio);
     if (ret != SUCCESS) {
         LogError << "Process audio channels failed" << GetErrorInfo(ret);
         return ret;
@@ -215,6 +213,38 @@ ErrorCode LoadAudio(const char* path, Tensor& result, int& originalSr, std::opti
     return SUCCESS;
 }
 
+ErrorCode DecodeAudio(const uint8_t* data, size_t size, Tensor& result, int& originalSr, std::optional<int> sr)
+{
+    Acc::AudioData audioData;
+    ErrorCode ret = LoadAudioData(data, size, audioData);
+    originalSr = static_cast<int>(audioData.sampleRate);
+    if (ret != SUCCESS) {
+        LogError << "Decode audio data failed" << GetErrorInfo(ret);
+        return ret;
+    }
+    ret = ConvertAudioData(audioData, result, sr);
+    if (ret != SUCCESS) {
+        LogError << "Convert audio data failed" << GetErrorInfo(ret);
+        return ret;
+    }
+    return SUCCESS;
+}
+} // namespace
+
+namespace Acc {
+
+ErrorCode LoadAudio(const char* path, Tensor& result, int& originalSr, std::optional<int> sr)
+{
+    Acc::AudioData audioData;
+    ErrorCode ret = LoadAudioData(path, audioData);
+    originalSr = audioData.sampleRate;
+    if (ret != SUCCESS) {
+        LogError << "Load audio data failed" << GetErrorInfo(ret);
+        return ret;
+    }
+    return ConvertAudioData(audioData, result, sr);
+}
+
 ErrorCode LoadAudioSingle(const std::string path, Tensor& result, int& originalSr, std::optional<int> sr)
 {
     ErrorCode ret = CheckSingleAudioInputs(path.c_str(), sr);
@@ -230,6 +260,17 @@ ErrorCode LoadAudioSingle(const std::string path, Tensor& result, int& originalS
     return SUCCESS;
 }
 
+ErrorCode LoadAudioFromBuffer(const uint8_t* data, size_t size, Tensor& result, int& originalSr,
+                              std::optional<int> sr)
+{
+    ErrorCode ret = CheckAudioBufferInputs(data, size, sr);
+    if (ret != SUCCESS) {
+        LogError << "Check audio inputs failed" << GetErrorInfo(ret);
+        return ret;
+    }
+    return DecodeAudio(data, size, result, originalSr, sr);
+}
+
 ErrorCode LoadAudioBatch(const std::vector<std::string> wavFiles, std::vector<Tensor>& results,
                          std::vector<int>& originalSrs, std::optional<int> sr)
 {
@@ -252,6 +293,10 @@ ErrorCode LoadAudioBatch(const std::vector<std::string> wavFiles, std::vector<Te
     results.resize(batchSize);
     originalSrs.resize(batchSize);
 
+    // the files are read ahead on the I/O thread pool, so the pool workers only decode and resample
+    FilePrefetcher prefetcher(wavFiles, [](const char* path, MappedFile& file) {
+        return MapAudioFile(path, file, true);
+    });
     auto& pool = Acc::ThreadPool::GetInstance();
     std::atomic<bool> errorOccurred(false);
     std::vector<std::future<void>> futures(batchSize);
@@ -260,9 +305,12 @@ ErrorCode LoadAudioBatch(const std::vector<std::string> wavFiles, std::vector<Te
         if (errorOccurred.load()) {
             break;
         }
-        const std::string wavPath = wavFiles[i];
-        futures[i] = pool.Submit([wavPath, i, &results, &originalSrs, sr, &errorOccurred]() {
-            ErrorCode ret = LoadAudio(wavPath.c_str(), results[i], originalSrs[i], sr);
+        futures[i] = pool.Submit([i, &prefetcher, &results, &originalSrs, sr, &errorOccurred]() {
+            MappedFile file;
+            ErrorCode ret = prefetcher.Take(static_cast<size_t>(i), file);
+            if (ret == SUCCESS) {
+                ret = DecodeAudio(file.Data(), file.Size(), results[i], originalSrs[i], sr);
+            }
             if (ret != SUCCESS) {
                 errorOccurred.store(true);
                 throw std::runtime_error("LoadAudio failed with code: " + std::to_string(ret));
@@ -27,6 +27,9 @@ CPUAccelerator::CPUAccelerator()
 {
     operatorMap_[OperatorId::CROP] = CreateOperatorFunc<CropContext>(CPUAccelerator::Crop);
     operatorMap_[OperatorId::QWENFUSION] = CreateOperatorFunc<QwenFusionContext>(CPUAccelerator::QwenFusionOperator);
+    operatorMap_[OperatorId::INTERNVL2FUSION] =
+        CreateOperatorFunc<InternVL2FusionContext>(CPUAccelerator::InternVL2FusionOperator);
+    operatorMap_[OperatorId::CLIPFUSION] = CreateOperatorFunc<ClipFusionContext>(CPUAccelerator::ClipFusionOperator);
     operatorMap_[OperatorId::TOTENSOR] = CreateOperatorFunc<ToTensorContext>(CPUAccelerator::ToTensor);
     operatorMap_[OperatorId::NORMALIZE] = CreateOperatorFunc<NormalizeContext>(CPUAccelerator::Normalize);
     operatorMap_[OperatorId::RESIZE] = CreateOperatorFunc<ResizeContext>(CPUAccelerator::Resize);
@@ -0,0 +1,130 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: ClipFusionOperator op on cpu.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+
+#include <algorithm>
+#include <future>
+#include <vector>
+#include "acc/core/framework/CPUAccelerator.h"
+#include "acc/tensor/TensorOps.h"
+#include "acc/utils/LogImpl.h"
+#include "acc/utils/ThreadPool.h"
+#include "acc/utils/ErrorCodeUtils.h"
+
+namespace {
+using namespace Acc;
+constexpr size_t RGB_CHANNELS = 3;
+constexpr size_t CROP_ROW_BAND = 64; // rows of one crop handled by a single thread pool task
+constexpr float PIXEL_MAX_VALUE = 255.0f;
+
+struct CropTask {
+    const uint8_t* src;  // first pixel of the crop inside the HWC resized image
+    size_t srcRowStride; // bytes per row of the HWC resized image
+    float* dst;          // first element of the image inside the NCHW output
+    size_t rowStart;
+    size_t rowEnd;
+};
+
+/**
+ * @brief Convert rows [rowStart, rowEnd) of one HWC uint8 crop into normalized CHW float planes.
+ *        out = pixel * scale[c] + bias[c], equivalent to (pixel / 255 - mean[c]) / std[c].
+ */
+void NormalizeCropRows(const CropTask& task, size_t cropH, size_t cropW, const float* scale, const float* bias)
+{
+    const size_t planeSize = cropH * cropW;
+    float* dstR = task.dst;
+    float* dstG = task.dst + planeSize;
+    float* dstB = task.dst + planeSize * (RGB_CHANNELS - 1);
+    for (size_t y = task.rowStart; y < task.rowEnd; ++y) {
+        const uint8_t* srcRow = task.src + y * task.srcRowStride;
+        size_t rowOffset = y * cropW;
+        for (size_t x = 0; x < cropW; ++x) {
+            const uint8_t* px = srcRow + x * RGB_CHANNELS;
+            dstR[rowOffset + x] = static_cast<float>(px[0]) * scale[0] + bias[0];
+            dstG[rowOffset + x] = static_cast<float>(px[1]) * scale[1] + bias[1];
+            dstB[rowOffset + x] = static_cast<float>(px[2]) * scale[2] + bias[2];
+        }
+    }
+}
+} // namespace
+
+namespace Acc {
+ErrorCode CPUAccelerator::ClipFusionOperator(ClipFusionContext& opCtx)
+{
+    const size_t numInputs = opCtx.inputTensorRefs.size();
+    const size_t cropH = static_cast<size_t>(opCtx.cropH);
+    const size_t cropW = static_cast<size_t>(opCtx.cropW);
+    const size_t imageElements = RGB_CHANNELS * cropH * cropW;
+    auto* dstPtr = static_cast<float*>(opCtx.outputTensorRefs[0].get().Ptr());
+
+    float scale[RGB_CHANNELS];
+    float bias[RGB_CHANNELS];
+    for (size_t c = 0; c < RGB_CHANNELS; ++c) {
+        scale[c] = 1.0f / (PIXEL_MAX_VALUE * opCtx.std[c]);
+        bias[c] = -opCtx.mean[c] / opCtx.std[c];
+    }
+
+    // The resize of every input is already split across the thread pool, the crops of an input are normalized
+    // in the background while the next input is being resized.
+    std::vector<Tensor> resized(numInputs);
+    std::vector<CropTask> tasks;
+    tasks.reserve(numInputs * ((cropH + CROP_ROW_BAND - 1) / CROP_ROW_BAND));
+    std::vector<std::future<void>> futures;
+    futures.reserve(tasks.capacity());
+    ErrorCode ret = SUCCESS;
+    try {
+        auto& pool = ThreadPool::GetInstance();
+        for (size_t i = 0; i < numInputs && ret == SUCCESS; ++i) {
+            auto size = opCtx.ResizedSizeOf(i);
+            ret = TensorResize(opCtx.inputTensorRefs[i].get(), resized[i], size.first, size.second,
+                               Interpolation::BICUBIC, opCtx.deviceMode);
+            if (ret != SUCCESS) {
+                LogError << "Tensor resize failed for input " << i << GetErrorInfo(ret);
+                break;
+            }
+            // same as transformers center_crop, the extra row or column goes to the bottom and right
+            const size_t srcRowStride = size.second * RGB_CHANNELS;
+            const uint8_t* cropSrc = static_cast<const uint8_t*>(resized[i].Ptr()) +
+                                     (size.first - cropH) / 2 * srcRowStride + (size.second - cropW) / 2 * RGB_CHANNELS;
+            for (size_t rowStart = 0; rowStart < cropH; rowStart += CROP_ROW_BAND) {
+                tasks.push_back({cropSrc, srcRowStride, dstPtr + i * imageElements, rowStart,
+                                 std::min(rowStart + CROP_ROW_BAND, cropH)});
+                const CropTask* task = &tasks.back();
+                futures.push_back(pool.Submit([task, cropH, cropW, &scale, &bias]() {
+                    NormalizeCropRows(*task, cropH, cropW, scale, bias);
+                }));
+            }
+        }
+        pool.WaitAll(futures);
+    } catch (const std::exception& e) {
+        // the submitted tasks still read the resized images and the coefficients on this stack
+        for (auto& future : futures) {
+            if (future.valid()) {
+                future.wait();
+            }
+        }
+        LogDebug << "There is a problem with the thread pool used in ClipFusionOperator."
+                 << GetErrorInfo(ERR_INVALID_THREAD_POOL_STATUST);
+        return ERR_INVALID_THREAD_POOL_STATUST;
+    }
+    return ret;
+}
+} // namespace Acc
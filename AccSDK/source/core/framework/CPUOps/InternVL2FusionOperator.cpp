@@ -0,0 +1,144 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: InternVL2FusionOperator op on cpu.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+
+#include <algorithm>
+#include <future>
+#include <vector>
+#include "acc/core/framework/CPUAccelerator.h"
+#include "acc/tensor/TensorOps.h"
+#include "acc/utils/LogImpl.h"
+#include "acc/utils/ThreadPool.h"
+#include "acc/utils/ErrorCodeUtils.h"
+
+namespace {
+using namespace Acc;
+constexpr size_t RGB_CHANNELS = 3;
+constexpr size_t TILE_ROW_BAND = 64; // rows of one tile handled by a single thread pool task
+constexpr float PIXEL_MAX_VALUE = 255.0f;
+
+struct TileTask {
+    const uint8_t* src;  // first pixel of the tile inside the HWC source image
+    size_t srcRowStride; // bytes per row of the HWC source image
+    float* dst;          // first element of the tile inside the NCHW output
+    size_t rowStart;
+    size_t rowEnd;
+};
+
+/**
+ * @brief Convert rows [rowStart, rowEnd) of one HWC uint8 tile into normalized CHW float planes.
+ *        out = pixel * scale[c] + bias[c], equivalent to (pixel / 255 - mean[c]) / std[c].
+ */
+void NormalizeTileRows(const TileTask& task, size_t tileSize, const float* scale, const float* bias)
+{
+    const size_t planeSize = tileSize * tileSize;
+    float* dstR = task.dst;
+    float* dstG = task.dst + planeSize;
+    float* dstB = task.dst + planeSize * (RGB_CHANNELS - 1);
+    for (size_t y = task.rowStart; y < task.rowEnd; ++y) {
+        const uint8_t* srcRow = task.src + y * task.srcRowStride;
+        size_t rowOffset = y * tileSize;
+        for (size_t x = 0; x < tileSize; ++x) {
+            const uint8_t* px = srcRow + x * RGB_CHANNELS;
+            dstR[rowOffset + x] = static_cast<float>(px[0]) * scale[0] + bias[0];
+            dstG[rowOffset + x] = static_cast<float>(px[1]) * scale[1] + bias[1];
+            dstB[rowOffset + x] = static_cast<float>(px[2]) * scale[2] + bias[2];
+        }
+    }
+}
+
+void AppendTileTasks(const Tensor& src, size_t tileTop, size_t tileLeft, size_t tileSize, float* dst,
+                     std::vector<TileTask>& tasks)
+{
+    const size_t srcRowStride = src.Shape()[2] * RGB_CHANNELS;
+    const uint8_t* tileSrc = static_cast<const uint8_t*>(src.Ptr()) + tileTop * srcRowStride + tileLeft * RGB_CHANNELS;
+    for (size_t rowStart = 0; rowStart < tileSize; rowStart += TILE_ROW_BAND) {
+        size_t rowEnd = std::min(rowStart + TILE_ROW_BAND, tileSize);
+        tasks.push_back({tileSrc, srcRowStride, dst, rowStart, rowEnd});
+    }
+}
+} // namespace
+
+namespace Acc {
+ErrorCode CPUAccelerator::InternVL2FusionOperator(InternVL2FusionContext& opCtx)
+{
+    const Tensor& src = opCtx.inputTensorRefs[0].get();
+    Tensor& dst = opCtx.outputTensorRefs[0].get();
+    const size_t tileSize = static_cast<size_t>(opCtx.inputSize);
+    const size_t gridW = static_cast<size_t>(opCtx.gridW);
+    const size_t gridH = static_cast<size_t>(opCtx.gridH);
+    const size_t blocks = gridW * gridH;
+
+    // Resize once to the whole tile grid, every tile is then a view into this image
+    Tensor resized;
+    ErrorCode ret = TensorResize(src, resized, gridH * tileSize, gridW * tileSize, Interpolation::BICUBIC,
+                                 opCtx.deviceMode);
+    if (ret != SUCCESS) {
+        LogError << "Tensor resize to the tile grid failed." << GetErrorInfo(ret);
+        return ret;
+    }
+    Tensor thumbnail;
+    bool withThumbnail = opCtx.NumTiles() != blocks;
+    if (withThumbnail) {
+        ret = TensorResize(src, thumbnail, tileSize, tileSize, Interpolation::BICUBIC, opCtx.deviceMode);
+        if (ret != SUCCESS) {
+            LogError << "Tensor resize to the thumbnail failed." << GetErrorInfo(ret);
+            return ret;
+        }
+    }
+
+    float scale[RGB_CHANNELS];
+    float bias[RGB_CHANNELS];
+    for (size_t c = 0; c < RGB_CHANNELS; ++c) {
+        scale[c] = 1.0f / (PIXEL_MAX_VALUE * opCtx.std[c]);
+        bias[c] = -opCtx.mean[c] / opCtx.std[c];
+    }
+
+    const size_t tileElements = RGB_CHANNELS * tileSize * tileSize;
+    auto* dstPtr = static_cast<float*>(dst.Ptr());
+    std::vector<TileTask> tasks;
+    tasks.reserve(opCtx.NumTiles() * ((tileSize + TILE_ROW_BAND - 1) / TILE_ROW_BAND));
+    for (size_t i = 0; i < blocks; ++i) {
+        AppendTileTasks(resized, (i / gridW) * tileSize, (i % gridW) * tileSize, tileSize,
+                        dstPtr + i * tileElements, tasks);
+    }
+    if (withThumbnail) {
+        AppendTileTasks(thumbnail, 0, 0, tileSize, dstPtr + blocks * tileElements, tasks);
+    }
+
+    try {
+        auto& pool = ThreadPool::GetInstance();
+        std::vector<std::future<void>> futures;
+        futures.reserve(tasks.size());
+        for (const auto& task : tasks) {
+            futures.push_back(pool.Submit([&task, tileSize, &scale, &bias]() {
+                NormalizeTileRows(task, tileSize, scale, bias);
+            }));
+        }
+        pool.WaitAll(futures);
+    } catch (const std::exception& e) {
+        LogDebug << "There is a problem with the thread pool used in InternVL2FusionOperator."
+                 << GetErrorInfo(ERR_INVALID_THREAD_POOL_STATUST);
+        return ERR_INVALID_THREAD_POOL_STATUST;
+    }
+    return SUCCESS;
+}
+} // namespace Acc
@@ -22,6 +22,7 @@
 
 #include "acc/core/framework/CPUAccelerator.h"
 #include "acc/core/framework/Pipeline.h"
+#include "acc/utils/TensorUtils.h"
 #include "acc/utils/LogImpl.h"
 #include "acc/utils/ErrorCodeUtils.h"
 #include "accdata_tensor.h"
@@ -52,6 +53,7 @@ ErrorCode CPUAccelerator::Normalize(NormalizeContext& opCtx)
     normalize->AddInput("ExternalSourceOutput", "cpu");
     normalize->AddArg("mean", opCtx.mean);
     normalize->AddArg("stddev", opCtx.stddev);
+    normalize->AddArg("dtype", static_cast<int64_t>(ToTensorDataType(opCtx.outputType)));
     normalize->AddOutput("NormalizeOutput", "cpu");
 
     ErrorCode ret = pipeline.Build({externalInput, normalize}, "NormalizeOutput");
@@ -20,12 +20,18 @@
  * History: NA
  */
 
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <thread>
+
 #include "acc/core/framework/CPUAccelerator.h"
 #include "acc/core/framework/Pipeline.h"
 #include "acc/tensor/TensorOps.h"
 #include "acc/utils/LogImpl.h"
 #include "acc/utils/ErrorCodeUtils.h"
 #include "acc/utils/TensorUtils.h"
+#include "acc/utils/ThreadPool.h"
 #include "accdata_tensor.h"
 #include "accdata_op_spec.h"
 
@@ -36,10 +42,11 @@ using namespace Acc;
 /**
  * @brief Build preprocessing pipeline for QwenFusion
  *
- * Constructs ToTensor -> Normalize sequence
+ * Normalize reads the resized uint8 NHWC image directly and folds the 1/255 scale into its per-channel
+ * multiply-add, a ToTensor op is only inserted in front of it when the layout has to change to NCHW.
  */
 ErrorCode BuildPreprocessQwenPipeline(Pipeline& pipeline, const std::vector<float>& mean, const std::vector<float>& std,
-                                      TensorFormat layout)
+                                      TensorFormat layout, DataType outputType)
 {
     auto externalInput = acclib::accdata::AccDataOpSpec::Create("ExternalSource");
     if (!externalInput) {
@@ -48,17 +55,23 @@ ErrorCode BuildPreprocessQwenPipeline(Pipeline& pipeline, const std::vector<floa
         return ERR_ACC_DATA_EXECUTE_FAILURE;
     }
     externalInput->AddOutput("ExternalSourceOutput", "cpu");
+    std::vector<std::shared_ptr<acclib::accdata::AccDataOpSpec>> specs = {externalInput};
+    std::string normalizeInput = "ExternalSourceOutput";
 
-    auto toTensorOp = acclib::accdata::AccDataOpSpec::Create("ToTensor");
-    if (!toTensorOp) {
-        LogDebug << "Create ToTensor Operator specification failed, please set correct operator name in acc data."
-                 << GetErrorInfo(ERR_ACC_DATA_EXECUTE_FAILURE);
-        return ERR_ACC_DATA_EXECUTE_FAILURE;
+    if (layout != TensorFormat::NHWC) {
+        auto toTensorOp = acclib::accdata::AccDataOpSpec::Create("ToTensor");
+        if (!toTensorOp) {
+            LogDebug << "Create ToTensor Operator specification failed, please set correct operator name in acc data."
+                     << GetErrorInfo(ERR_ACC_DATA_EXECUTE_FAILURE);
+            return ERR_ACC_DATA_EXECUTE_FAILURE;
+        }
+        TensorLayout tensorLayout = ToTensorLayout(layout);
+        toTensorOp->AddInput("ExternalSourceOutput", "cpu");
+        toTensorOp->AddArg("layout", static_cast<int64_t>(tensorLayout));
+        toTensorOp->AddOutput("TensorOutput", "cpu");
+        specs.push_back(toTensorOp);
+        normalizeInput = "TensorOutput";
     }
-    TensorLayout tensorLayout = ToTensorLayout(layout);
-    toTensorOp->AddInput("ExternalSourceOutput", "cpu");
-    toTensorOp->AddArg("layout", static_cast<int64_t>(tensorLayout));
-    toTensorOp->AddOutput("TensorOutput", "cpu");
 
     auto normalizeOp = acclib::accdata::AccDataOpSpec::Create("Normalize");
     if (!normalizeOp) {
@@ -66,36 +79,188 @@ ErrorCode BuildPreprocessQwenPipeline(Pipeline& pipeline, const std::vector<floa
                  << GetErrorInfo(ERR_ACC_DATA_EXECUTE_FAILURE);
         return ERR_ACC_DATA_EXECUTE_FAILURE;
     }
-    normalizeOp->AddInput("TensorOutput", "cpu");
+    normalizeOp->AddInput(normalizeInput, "cpu");
     normalizeOp->AddArg("mean", mean);
     normalizeOp->AddArg("stddev", std);
+    normalizeOp->AddArg("dtype", static_cast<int64_t>(ToTensorDataType(outputType)));
     normalizeOp->AddOutput("NormalizedOutput", "cpu");
+    specs.push_back(normalizeOp);
 
-    return pipeline.Build({externalInput, toTensorOp, normalizeOp}, "NormalizedOutput");
+    return pipeline.Build(specs, "NormalizedOutput");
 }
-} // namespace
-namespace Acc {
-ErrorCode CPUAccelerator::QwenFusionOperator(QwenFusionContext& opCtx)
+
+/**
+ * @brief Build patch pipeline for QwenFusion
+ *
+ * Runs the fused acc data Qwen2-VL operator (Resize + ToTensor + Normalize + patch flatten) with the
+ * resize target fixed by the caller, so the output is already (gridH * gridW, C * T * P * P).
+ */
+ErrorCode BuildQwenPatchPipeline(Pipeline& pipeline, const QwenFusionContext& opCtx, int resizeH, int resizeW)
+{
+    auto externalInput = acclib::accdata::AccDataOpSpec::Create("ExternalSource");
+    if (!externalInput) {
+        LogDebug << "Create ExternalSource specification failed, please set correct operator name in acc data."
+                 << GetErrorInfo(ERR_ACC_DATA_EXECUTE_FAILURE);
+        return ERR_ACC_DATA_EXECUTE_FAILURE;
+    }
+    externalInput->AddOutput("ExternalSourceOutput", "cpu");
+
+    auto qwenOp = acclib::accdata::AccDataOpSpec::Create("QwenFusionOp");
+    if (!qwenOp) {
+        LogDebug << "Create QwenFusionOp specification failed, please set correct operator name in acc data."
+                 << GetErrorInfo(ERR_ACC_DATA_EXECUTE_FAILURE);
+        return ERR_ACC_DATA_EXECUTE_FAILURE;
+    }
+    qwenOp->AddInput("ExternalSourceOutput", "cpu");
+    qwenOp->AddArg("mean", opCtx.mean);
+    qwenOp->AddArg("stddev", opCtx.std);
+    qwenOp->AddArg("patch_size", static_cast<int64_t>(opCtx.patchSize));
+    qwenOp->AddArg("temporal_patch_size", static_cast<int64_t>(opCtx.temporalPatchSize));
+    qwenOp->AddArg("merge_size", static_cast<int64_t>(opCtx.mergeSize));
+    qwenOp->AddArg("resize_h", static_cast<int64_t>(resizeH));
+    qwenOp->AddArg("resize_w", static_cast<int64_t>(resizeW));
+    qwenOp->AddArg("dtype", static_cast<int64_t>(ToTensorDataType(opCtx.outputType)));
+    qwenOp->AddArg("merge_frames", opCtx.mergeFrames);
+    qwenOp->AddOutput("PatchOutput", "cpu");
+
+    return pipeline.Build({externalInput, qwenOp}, "PatchOutput");
+}
+
+/**
+ * @brief Inputs handled by one worker of QwenFusionOperator
+ *
+ * The inputs of a group run one after another, numThreads is the thread count of the group's own
+ * pipeline and splits the rows of each input.
+ */
+struct QwenWorkGroup {
+    std::vector<size_t> inputs;
+    size_t numThreads = 1;
+};
+
+/**
+ * @brief Split the inputs into work groups that share the thread budget by output pixels
+ *
+ * An input owning at least one share of the pixels gets its own group with a proportional number of
+ * threads, smaller inputs are packed together until a group reaches one share and run on one thread.
+ */
+std::vector<QwenWorkGroup> PlanQwenWorkGroups(const QwenFusionContext& opCtx, size_t threadBudget)
+{
+    size_t numInputs = opCtx.inputTensorRefs.size();
+    std::vector<size_t> costs(numInputs);
+    for (size_t i = 0; i < numInputs; ++i) {
+        const auto& shape = opCtx.inputTensorRefs[i].get().Shape();
+        size_t numSamples = shape.empty() ? 1 : std::max<size_t>(shape[0], 1);
+        costs[i] = static_cast<size_t>(opCtx.ResizeHOf(i)) * static_cast<size_t>(opCtx.ResizeWOf(i)) * numSamples;
+    }
+    size_t totalCost = std::max<size_t>(std::accumulate(costs.begin(), costs.end(), static_cast<size_t>(0)), 1);
+    size_t share = (totalCost + threadBudget - 1) / threadBudget;
+
+    std::vector<size_t> order(numInputs);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&costs](size_t lhs, size_t rhs) { return costs[lhs] > costs[rhs]; });
+
+    std::vector<QwenWorkGroup> groups;
+    size_t packIndex = 0;
+    size_t packedCost = share;
+    for (size_t index : order) {
+        if (costs[index] >= share) {
+            size_t numThreads = (costs[index] * threadBudget + totalCost / 2) / totalCost;
+            groups.push_back({{index}, std::min(std::max<size_t>(numThreads, 1), threadBudget)});
+            continue;
+        }
+        if (packedCost + costs[index] > share) {
+            groups.push_back({{}, 1});
+            packIndex = groups.size() - 1;
+            packedCost = 0;
+        }
+        groups[packIndex].inputs.push_back(index);
+        packedCost += costs[index];
+    }
+    return groups;
+}
+
+/**
+ * @brief Run a patch pipeline, a preallocated output (e.g. one image's rows of a batch patch matrix) is
+ * written in place
+ */
+ErrorCode RunQwenPatchPipeline(Pipeline& pipeline, const std::vector<Tensor>& inputs, Tensor& output)
+{
+    std::unordered_map<std::string, std::vector<Tensor>> pipelineInputs;
+    pipelineInputs["ExternalSourceOutput"] = inputs;
+    return output.Ptr() != nullptr ? pipeline.RunInto(pipelineInputs, output, false) :
+                                     pipeline.Run(pipelineInputs, output, false);
+}
+
+ErrorCode RunQwenPatches(const QwenWorkGroup& group, QwenFusionContext& opCtx)
+{
+    std::unique_ptr<Pipeline> pipeline;
+    std::pair<int, int> builtSize = {0, 0};
+    for (size_t i : group.inputs) {
+        std::pair<int, int> size = {opCtx.ResizeHOf(i), opCtx.ResizeWOf(i)};
+        // the resize target is an operator argument, so a new size needs its own pipeline
+        if (pipeline == nullptr || size != builtSize) {
+            pipeline = std::make_unique<Pipeline>(static_cast<int>(group.numThreads));
+            ErrorCode ret = BuildQwenPatchPipeline(*pipeline, opCtx, size.first, size.second);
+            if (ret != SUCCESS) {
+                LogError << "Failed to build patch pipeline" << GetErrorInfo(ret);
+                return ret;
+            }
+            builtSize = size;
+        }
+        ErrorCode ret = RunQwenPatchPipeline(*pipeline, {opCtx.inputTensorRefs[i].get()},
+                                             opCtx.outputTensorRefs[i].get());
+        if (ret != SUCCESS) {
+            LogError << "Patch pipeline run failed for input " << i << GetErrorInfo(ret);
+            return ret;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Patch the frames of one video in a single run, the frame tensors are read where they are
+ */
+ErrorCode RunQwenVideo(QwenFusionContext& opCtx, size_t threadBudget)
+{
+    Pipeline pipeline(static_cast<int>(threadBudget));
+    ErrorCode ret = BuildQwenPatchPipeline(pipeline, opCtx, opCtx.resizeH, opCtx.resizeW);
+    if (ret != SUCCESS) {
+        LogError << "Failed to build patch pipeline" << GetErrorInfo(ret);
+        return ret;
+    }
+    std::vector<Tensor> frames;
+    frames.reserve(opCtx.inputTensorRefs.size());
+    for (const auto& frame : opCtx.inputTensorRefs) {
+        frames.push_back(frame.get());
+    }
+    ret = RunQwenPatchPipeline(pipeline, frames, opCtx.outputTensorRefs[0].get());
+    if (ret != SUCCESS) {
+        LogError << "Patch pipeline run failed for the video frames" << GetErrorInfo(ret);
+    }
+    return ret;
+}
+
+ErrorCode RunQwenImages(const QwenWorkGroup& group, QwenFusionContext& opCtx)
 {
-    Pipeline pipeline(DEFAULT_QWEN_FUSION_THREAD_NUM);
-    ErrorCode ret = BuildPreprocessQwenPipeline(pipeline, opCtx.mean, opCtx.std, opCtx.layout);
+    Pipeline pipeline(static_cast<int>(group.numThreads));
+    ErrorCode ret = BuildPreprocessQwenPipeline(pipeline, opCtx.mean, opCtx.std, opCtx.layout, opCtx.outputType);
     if (ret != SUCCESS) {
         LogError << "Failed to build preprocessing pipeline" << GetErrorInfo(ret);
         return ret;
     }
-    size_t numInputs = opCtx.inputTensorRefs.size();
-    for (size_t i = 0; i < numInputs; ++i) {
+    for (size_t i : group.inputs) {
         const Tensor& src = opCtx.inputTensorRefs[i].get();
         Tensor& dst = opCtx.outputTensorRefs[i].get();
 
         // Resize tensor
-        ret = TensorResize(src, dst, opCtx.resizeH, opCtx.resizeW, Interpolation::BICUBIC, opCtx.deviceMode);
+        ret = TensorResize(src, dst, opCtx.ResizeHOf(i), opCtx.ResizeWOf(i), Interpolation::BICUBIC,
+                           opCtx.deviceMode);
         if (ret != SUCCESS) {
             LogError << "Tensor resize failed for input " << i << GetErrorInfo(ret);
             return ret;
         }
 
-        // Run pipeline (ToTensor + Normalize)
+        // Run pipeline (Normalize, with ToTensor in front for NCHW)
         std::unordered_map<std::string, std::vector<Tensor>> inputs;
         inputs["ExternalSourceOutput"].push_back(dst);
         ret = pipeline.Run(inputs, dst, true);
@@ -104,7 +269,49 @@ ErrorCode CPUAccelerator::QwenFusionOperator(QwenFusionContext& opCtx)
             return ret;
         }
     }
+    return SUCCESS;
+}
+
+ErrorCode RunQwenWorkGroup(const QwenWorkGroup& group, QwenFusionContext& opCtx)
+{
+    return opCtx.flattenPatches ? RunQwenPatches(group, opCtx) : RunQwenImages(group, opCtx);
+}
+} // namespace
+namespace Acc {
+ErrorCode CPUAccelerator::QwenFusionOperator(QwenFusionContext& opCtx)
+{
+    size_t threadBudget = std::min<size_t>(DEFAULT_QWEN_FUSION_THREAD_NUM,
+                                           std::max<unsigned int>(std::thread::hardware_concurrency(), 1));
+    if (opCtx.mergeFrames) {
+        return RunQwenVideo(opCtx, threadBudget);
+    }
+    std::vector<QwenWorkGroup> groups = PlanQwenWorkGroups(opCtx, threadBudget);
+    if (groups.size() == 1) {
+        return RunQwenWorkGroup(groups[0], opCtx);
+    }
 
+    // every group writes its own outputs, so the groups run concurrently without synchronization
+    std::vector<ErrorCode> results(groups.size(), SUCCESS);
+    try {
+        auto& pool = ThreadPool::GetInstance();
+        std::vector<std::future<void>> futures;
+        futures.reserve(groups.size());
+        for (size_t g = 0; g < groups.size(); ++g) {
+            futures.push_back(pool.Submit([&groups, &results, &opCtx, g]() {
+                results[g] = RunQwenWorkGroup(groups[g], opCtx);
+            }));
+        }
+        pool.WaitAll(futures);
+    } catch (const std::exception& e) {
+        LogDebug << "There is a problem with the thread pool used in QwenFusionOperator."
+                 << GetErrorInfo(ERR_INVALID_THREAD_POOL_STATUST);
+        return ERR_INVALID_THREAD_POOL_STATUST;
+    }
+    for (ErrorCode ret : results) {
+        if (ret != SUCCESS) {
+            return ret;
+        }
+    }
     return SUCCESS;
 }
 } // namespace Acc
\ No newline at end of file
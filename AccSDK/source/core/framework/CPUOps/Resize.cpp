@@ -24,16 +24,19 @@
 #include <cmath>
 #include <thread>
 #include "acc/core/framework/CPUAccelerator.h"
+#include "acc/core/framework/BicubicRowResizer.h"
 #include "acc/ErrorCode.h"
 #include "acc/utils/LogImpl.h"
 #include "acc/utils/ThreadPool.h"
 #include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/ScratchArena.h"
 using namespace Acc;
 
 namespace {
 constexpr size_t INDEX_ZERO = 0;
 constexpr size_t INDEX_ONE = 1;
 constexpr size_t INDEX_TWO = 2;
+constexpr size_t RGB_CHANNELS = 3;
 constexpr double BICUBICPARAM_A = -0.5;
 constexpr int PRECISION_BITS = 22;
 constexpr int INT_TWO = 2;
@@ -131,20 +134,22 @@ inline double BicubicFilter(double x)
     return 0.0;
 }
 
+// total kernel size, each dst pixel needs kernelSize interpolation coefficients.
+size_t KernelSize(size_t srcSize, size_t dstSize)
+{
+    double resizeRatio = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+    double filterScale = resizeRatio >= 1.0 ? resizeRatio : 1.0;
+    return static_cast<size_t>(std::ceil(DOUBLE_TWO * filterScale)) * SIZE_T_TWO + 1;
+}
+
 // Calculate the boundary values and pixel weights needed for interpolation
-void PreComputeCoefficient(size_t srcSize, size_t dstSize, size_t& kernelSize, std::vector<int>& bounds,
-                           std::vector<double>& kernelCoefficient)
+// bounds holds {xmin, xmax} for each output pixel，xmin：left bound of kernel，xmax：right bound of kernel
+void PreComputeCoefficient(size_t srcSize, size_t dstSize, size_t kernelSize, int* bounds, double* kernelCoefficient)
 {
     double resizeRatio = static_cast<double>(srcSize) / static_cast<double>(dstSize);
     double filterScale = resizeRatio >= 1.0 ? resizeRatio : 1.0;
     // half of the kernelSize
     double radius = DOUBLE_TWO * filterScale;
-    // total kernel size
-    kernelSize = static_cast<size_t>(std::ceil(radius)) * SIZE_T_TWO + 1;
-    // {xmin, xmax} for each output pixel，xmin：left bound of kernel，xmax：right bound of kernel
-    bounds.resize(dstSize * SIZE_T_TWO);
-    // each dst pixel needs kernelSize interpolation coefficients.
-    kernelCoefficient.resize(dstSize * kernelSize, 0.0);
     for (size_t xx = 0; xx < dstSize; ++xx) {
         double center = (xx + DOUBLE_HALF) * resizeRatio;
         double inverseScale = 1.0 / filterScale;
@@ -180,11 +185,9 @@ void PreComputeCoefficient(size_t srcSize, size_t dstSize, size_t& kernelSize, s
 }
 
 // cast double to long accelerate CPU compute
-void NormalizeCoefficientVector(const std::vector<double>& kernelCoeIn, std::vector<long>& kernelCoeOut)
+void NormalizeCoefficient(const double* kernelCoeIn, size_t count, long* kernelCoeOut)
 {
-    kernelCoeOut.resize(kernelCoeIn.size());
-
-    for (size_t x = 0; x < kernelCoeIn.size(); x++) {
+    for (size_t x = 0; x < count; x++) {
         // Add or subtract 0.5 to round off
         if (kernelCoeIn[x] < 0.0) {
             kernelCoeOut[x] = static_cast<long>(DOUBLE_HALF_NEGATIVE + kernelCoeIn[x] * (DOUBLE_SCALE));
@@ -194,7 +197,7 @@ void NormalizeCoefficientVector(const std::vector<double>& kernelCoeIn, std::vec
     }
 }
 
-void ComputeHorizontalSum(int widthBoundsEnd, const std::vector<long>& kernelCoeHorizNormalized, int& coeIndexHorizBase,
+void ComputeHorizontalSum(int widthBoundsEnd, const long* kernelCoeHorizNormalized, int& coeIndexHorizBase,
                           int& srcIndexBase, uint8_t* srcPtr, int& ss0, int& ss1, int& ss2)
 {
     for (int x = 0; x < widthBoundsEnd; x++) {
@@ -207,8 +210,8 @@ void ComputeHorizontalSum(int widthBoundsEnd, const std::vector<long>& kernelCoe
     }
 }
 
-void Process(const std::vector<int>& boundsVert, const std::vector<int>& boundsHoriz, uint8_t* dstPtr, uint8_t* srcPtr,
-             const std::vector<long>& kernelCoeHorizNormalized, const std::vector<long>& kernelCoeVertNormalized,
+void Process(const int* boundsVert, const int* boundsHoriz, uint8_t* dstPtr, uint8_t* srcPtr,
+             const long* kernelCoeHorizNormalized, const long* kernelCoeVertNormalized,
              size_t srcWidth, size_t dstWidth, int kernelSizeH, int kernelSizeW, int startRow, int endRow)
 {
     // Iterate through each target point and calculate the pixel value
@@ -247,56 +250,161 @@ void Process(const std::vector<int>& boundsVert, const std::vector<int>& boundsH
     }
 };
 
-void ResizeCalculate(const Tensor& src, Tensor& dst, int kernelSizeH, int kernelSizeW,
-                     const std::vector<int>& boundsHoriz, const std::vector<double>& kernelCoefficientHoriz,
-                     const std::vector<int>& boundsVert, const std::vector<double>& kernelCoefficientVert)
+// Bounds and fixed point coefficients of one axis, the double weights are only needed while converting
+bool PrepareAxis(ScratchArena& arena, size_t srcSize, size_t dstSize, size_t& kernelSize, int*& bounds,
+                 long*& kernelCoeNormalized)
+{
+    kernelSize = KernelSize(srcSize, dstSize);
+    bounds = arena.Allocate<int>(dstSize * SIZE_T_TWO);
+    kernelCoeNormalized = arena.Allocate<long>(dstSize * kernelSize);
+    if (bounds == nullptr || kernelCoeNormalized == nullptr) {
+        return false;
+    }
+    ScratchArena::Mark mark = arena.GetMark();
+    double* kernelCoefficient = arena.Allocate<double>(dstSize * kernelSize);
+    if (kernelCoefficient == nullptr) {
+        return false;
+    }
+    PreComputeCoefficient(srcSize, dstSize, kernelSize, bounds, kernelCoefficient);
+    NormalizeCoefficient(kernelCoefficient, dstSize * kernelSize, kernelCoeNormalized);
+    arena.Rewind(mark);
+    return true;
+}
+
+void ResizeCalculate(const Tensor& src, Tensor& dst, int kernelSizeH, int kernelSizeW, const int* boundsHoriz,
+                     const long* kernelCoeHorizNormalized, const int* boundsVert, const long* kernelCoeVertNormalized)
 {
     auto srcShape = src.Shape();
     auto srcWidth = srcShape[INDEX_TWO];
     auto dstShape = dst.Shape();
     auto dstWidth = dstShape[INDEX_TWO];
     auto dstHeight = dstShape[INDEX_ONE];
-    std::vector<long> kernelCoeHorizNormalized;
-    NormalizeCoefficientVector(kernelCoefficientHoriz, kernelCoeHorizNormalized);
-    std::vector<long> kernelCoeVertNormalized;
-    NormalizeCoefficientVector(kernelCoefficientVert, kernelCoeVertNormalized);
     auto* dstPtr = static_cast<uint8_t*>(dst.Ptr());
     auto* srcPtr = static_cast<uint8_t*>(src.Ptr());
+    if (ThreadPool::InWorkerThread()) {
+        // already inside a pool task (e.g. one image group of a fused operator), fan out at one level only
+        Process(boundsVert, boundsHoriz, dstPtr, srcPtr, kernelCoeHorizNormalized, kernelCoeVertNormalized, srcWidth,
+                dstWidth, kernelSizeH, kernelSizeW, 0, static_cast<int>(dstHeight));
+        return;
+    }
     auto threadNum = RESIZE_DEFAULT_THREAD_NUMS;
     std::vector<std::future<void>> futures;
+    futures.reserve(threadNum);
     int rowsPerThread = static_cast<int>(dstHeight) / static_cast<int>(threadNum);
     int extraRows = static_cast<int>(dstHeight) % static_cast<int>(threadNum);
     auto& instance = ThreadPool::GetInstance();
-    for (size_t t = 0; t < threadNum; ++t) {
-        int startRow = static_cast<int>(t) * rowsPerThread;
-        int endRow = (t == threadNum - 1) ? (startRow + rowsPerThread + extraRows) : (startRow + rowsPerThread);
-        futures.push_back(instance.Submit(Process, boundsVert, boundsHoriz, dstPtr, srcPtr, kernelCoeHorizNormalized,
-                                          kernelCoeVertNormalized, srcWidth, dstWidth, kernelSizeH, kernelSizeW,
-                                          startRow, endRow));
+    try {
+        for (size_t t = 0; t < threadNum; ++t) {
+            int startRow = static_cast<int>(t) * rowsPerThread;
+            int endRow = (t == threadNum - 1) ? (startRow + rowsPerThread + extraRows) : (startRow + rowsPerThread);
+            futures.push_back(instance.Submit(Process, boundsVert, boundsHoriz, dstPtr, srcPtr,
+                                              kernelCoeHorizNormalized, kernelCoeVertNormalized, srcWidth, dstWidth,
+                                              kernelSizeH, kernelSizeW, startRow, endRow));
+        }
+    } catch (...) {
+        // the submitted rows read the coefficient tables of the caller, finish them before the tables go away
+        instance.WaitAll(futures);
+        throw;
     }
     instance.WaitAll(futures);
 }
 } // namespace
 
 namespace Acc {
+BicubicRowResizer::BicubicRowResizer(size_t srcWidth, size_t srcHeight, size_t dstWidth, size_t dstHeight,
+                                     size_t channels)
+    : dstWidth_(dstWidth), channels_(channels)
+{
+    kernelSizeH_ = KernelSize(srcHeight, dstHeight);
+    kernelSizeW_ = KernelSize(srcWidth, dstWidth);
+    std::vector<double> coefficientHoriz(dstWidth * kernelSizeW_);
+    std::vector<double> coefficientVert(dstHeight * kernelSizeH_);
+    boundsVert_.resize(dstHeight * SIZE_T_TWO);
+    boundsHoriz_.resize(dstWidth * SIZE_T_TWO);
+    coeHoriz_.resize(coefficientHoriz.size());
+    coeVert_.resize(coefficientVert.size());
+    PreComputeCoefficient(srcHeight, dstHeight, kernelSizeH_, boundsVert_.data(), coefficientVert.data());
+    PreComputeCoefficient(srcWidth, dstWidth, kernelSizeW_, boundsHoriz_.data(), coefficientHoriz.data());
+    NormalizeCoefficient(coefficientHoriz.data(), coefficientHoriz.size(), coeHoriz_.data());
+    NormalizeCoefficient(coefficientVert.data(), coefficientVert.size(), coeVert_.data());
+}
+
+void BicubicRowResizer::HorizontalPass(const uint8_t* srcRow, uint8_t* dstRow) const
+{
+    const int initialBias = 1 << (PRECISION_BITS - 1);
+    if (channels_ != RGB_CHANNELS) {
+        for (size_t xx = 0; xx < dstWidth_; xx++) {
+            int widthBoundsStart = boundsHoriz_[xx * INT_TWO + 0];
+            int widthBoundsEnd = boundsHoriz_[xx * INT_TWO + 1];
+            const long* k = &coeHoriz_[xx * kernelSizeW_];
+            const uint8_t* src = srcRow + widthBoundsStart * channels_;
+            for (size_t c = 0; c < channels_; c++) {
+                int ss = initialBias;
+                for (int x = 0; x < widthBoundsEnd; x++) {
+                    ss += src[x * channels_ + c] * k[x];
+                }
+                dstRow[xx * channels_ + c] = ClampToUint8(ss);
+            }
+        }
+        return;
+    }
+    for (size_t xx = 0; xx < dstWidth_; xx++) {
+        int widthBoundsStart = boundsHoriz_[xx * INT_TWO + 0];
+        int widthBoundsEnd = boundsHoriz_[xx * INT_TWO + 1];
+        const long* k = &coeHoriz_[xx * kernelSizeW_];
+        const uint8_t* src = srcRow + widthBoundsStart * INT_THREE;
+        int ss0 = initialBias;
+        int ss1 = initialBias;
+        int ss2 = initialBias;
+        for (int x = 0; x < widthBoundsEnd; x++) {
+            ss0 += src[x * INT_THREE + INDEX_ZERO] * k[x];
+            ss1 += src[x * INT_THREE + INDEX_ONE] * k[x];
+            ss2 += src[x * INT_THREE + INDEX_TWO] * k[x];
+        }
+        dstRow[xx * INT_THREE + INDEX_ZERO] = ClampToUint8(ss0);
+        dstRow[xx * INT_THREE + INDEX_ONE] = ClampToUint8(ss1);
+        dstRow[xx * INT_THREE + INDEX_TWO] = ClampToUint8(ss2);
+    }
+}
+
+void BicubicRowResizer::VerticalPass(const uint8_t* const* rows, size_t dstRow, uint8_t* dstPtr) const
+{
+    const int initialBias = 1 << (PRECISION_BITS - 1);
+    size_t numRows = NumSrcRows(dstRow);
+    const long* k = &coeVert_[dstRow * kernelSizeH_];
+    for (size_t i = 0; i < dstWidth_ * channels_; i++) {
+        int t = initialBias;
+        for (size_t y = 0; y < numRows; y++) {
+            t += rows[y][i] * k[y];
+        }
+        dstPtr[i] = ClampToUint8(t);
+    }
+}
+
 ErrorCode CPUAccelerator::Resize(ResizeContext& opCtx)
 {
-    std::vector<int> boundsHoriz;
-    std::vector<double> kernelCoefficientHoriz;
-    std::vector<int> boundsVert;
-    std::vector<double> kernelCoefficientVert;
-    size_t kernelSizeH = 0;
-    size_t kernelSizeW = 0;
     const Tensor& src = opCtx.inputTensorRefs[0].get();
     Tensor& dst = opCtx.outputTensorRefs[0].get();
     auto srcShape = src.Shape();
 
+    // the coefficient tables stay in the scratch arena of this thread until the row tasks are done
+    ScratchScope scratch;
+    size_t kernelSizeH = 0;
+    size_t kernelSizeW = 0;
+    int* boundsVert = nullptr;
+    int* boundsHoriz = nullptr;
+    long* kernelCoeVert = nullptr;
+    long* kernelCoeHoriz = nullptr;
+    if (!PrepareAxis(scratch.Arena(), srcShape[INDEX_ONE], opCtx.resizedH, kernelSizeH, boundsVert, kernelCoeVert) ||
+        !PrepareAxis(scratch.Arena(), srcShape[INDEX_TWO], opCtx.resizedW, kernelSizeW, boundsHoriz,
+                     kernelCoeHoriz)) {
+        LogError << "Failed to malloc for resize coefficients." << GetErrorInfo(ERR_BAD_ALLOC);
+        return ERR_BAD_ALLOC;
+    }
+
     ErrorCode ret = SUCCESS;
     try {
-        PreComputeCoefficient(srcShape[INDEX_ONE], opCtx.resizedH, kernelSizeH, boundsVert, kernelCoefficientVert);
-        PreComputeCoefficient(srcShape[INDEX_TWO], opCtx.resizedW, kernelSizeW, boundsHoriz, kernelCoefficientHoriz);
-        ResizeCalculate(src, dst, kernelSizeH, kernelSizeW, boundsHoriz, kernelCoefficientHoriz, boundsVert,
-                        kernelCoefficientVert);
+        ResizeCalculate(src, dst, kernelSizeH, kernelSizeW, boundsHoriz, kernelCoeHoriz, boundsVert, kernelCoeVert);
     } catch (const std::exception& e) {
         LogDebug << "There is a problem with the thread pool used in ResizeOnCpu."
                  << GetErrorInfo(ERR_INVALID_THREAD_POOL_STATUST);
@@ -53,6 +53,7 @@ ErrorCode CPUAccelerator::ToTensor(ToTensorContext& opCtx)
     toTensor->AddInput("ExternalSourceOutput", "cpu");
     TensorLayout tensorLayout = ToTensorLayout(opCtx.format);
     toTensor->AddArg("layout", static_cast<int64_t>(tensorLayout));
+    toTensor->AddArg("dtype", static_cast<int64_t>(ToTensorDataType(opCtx.outputType)));
     toTensor->AddOutput("ToTensorOutput", "cpu");
 
     ErrorCode ret = pipeline.Build({externalInput, toTensor}, "ToTensorOutput");
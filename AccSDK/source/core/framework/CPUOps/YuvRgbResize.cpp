@@ -0,0 +1,183 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: Fused yuv420 to RGB conversion and resize op on cpu.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+
+#include <algorithm>
+#include "acc/core/framework/YuvRgbResizer.h"
+
+namespace {
+using namespace Acc;
+constexpr size_t INDEX_ZERO = 0;
+constexpr size_t INDEX_ONE = 1;
+constexpr size_t INDEX_TWO = 2;
+constexpr size_t RGB_CHANNELS = 3;
+constexpr size_t CHROMA_SUBSAMPLE = 2;
+constexpr size_t LUMA_CHANNELS = 1;
+constexpr size_t NV12_CHROMA_CHANNELS = 2;
+constexpr size_t PLANAR_CHROMA_CHANNELS = 1;
+constexpr int MAX_PIXEL = 255;
+constexpr float MAX_PIXEL_FLOAT = 255.0f;
+
+// BT.601 limited range coefficients in 8 bit fixed point
+constexpr int LUMA_OFFSET = 16;
+constexpr int CHROMA_OFFSET = 128;
+constexpr int COE_Y = 298;
+constexpr int COE_RV = 409;
+constexpr int COE_GU = 100;
+constexpr int COE_GV = 208;
+constexpr int COE_BU = 516;
+constexpr int ROUND_BIAS = 128;
+constexpr int COE_SHIFT = 8;
+
+inline uint8_t ClampPixel(int value)
+{
+    return static_cast<uint8_t>(std::min(std::max(value, 0), MAX_PIXEL));
+}
+
+inline void YuvToRgb(int y, int u, int v, uint8_t* rgb)
+{
+    int c = COE_Y * (y - LUMA_OFFSET) + ROUND_BIAS;
+    int d = u - CHROMA_OFFSET;
+    int e = v - CHROMA_OFFSET;
+    rgb[INDEX_ZERO] = ClampPixel((c + COE_RV * e) >> COE_SHIFT);
+    rgb[INDEX_ONE] = ClampPixel((c - COE_GU * d - COE_GV * e) >> COE_SHIFT);
+    rgb[INDEX_TWO] = ClampPixel((c + COE_BU * d) >> COE_SHIFT);
+}
+
+// Feeds one plane through a resizer, every source row is horizontally resized once and kept in a ring
+class PlaneStream {
+public:
+    PlaneStream(const BicubicRowResizer& resizer, const uint8_t* plane, size_t stride, size_t startRow)
+        : resizer_(resizer),
+          plane_(plane),
+          stride_(stride),
+          nextSrcRow_(resizer.FirstSrcRow(startRow)),
+          ring_(resizer.MaxSrcRows() * resizer.RowBytes()),
+          rows_(resizer.MaxSrcRows()),
+          out_(resizer.RowBytes())
+    {
+    }
+
+    const uint8_t* Row(size_t dstRow)
+    {
+        size_t first = resizer_.FirstSrcRow(dstRow);
+        size_t numRows = resizer_.NumSrcRows(dstRow);
+        size_t ringSize = resizer_.MaxSrcRows();
+        size_t rowBytes = resizer_.RowBytes();
+        for (; nextSrcRow_ < first + numRows; nextSrcRow_++) {
+            resizer_.HorizontalPass(plane_ + nextSrcRow_ * stride_, &ring_[(nextSrcRow_ % ringSize) * rowBytes]);
+        }
+        for (size_t i = 0; i < numRows; i++) {
+            rows_[i] = &ring_[((first + i) % ringSize) * rowBytes];
+        }
+        resizer_.VerticalPass(rows_.data(), dstRow, out_.data());
+        return out_.data();
+    }
+
+private:
+    const BicubicRowResizer& resizer_;
+    const uint8_t* plane_;
+    size_t stride_;
+    size_t nextSrcRow_;
+    std::vector<uint8_t> ring_;
+    std::vector<const uint8_t*> rows_;
+    std::vector<uint8_t> out_;
+};
+} // namespace
+
+namespace Acc {
+YuvRgbResizer::YuvRgbResizer(ImageFormat format, size_t srcWidth, size_t srcHeight, size_t dstWidth,
+                             size_t dstHeight)
+    : format_(format),
+      srcWidth_(srcWidth),
+      srcHeight_(srcHeight),
+      dstWidth_(dstWidth),
+      dstHeight_(dstHeight),
+      lumaResizer_(srcWidth, srcHeight, dstWidth, dstHeight, LUMA_CHANNELS),
+      chromaResizer_(srcWidth / CHROMA_SUBSAMPLE, srcHeight / CHROMA_SUBSAMPLE, dstWidth, dstHeight,
+                     format == ImageFormat::NV12 ? NV12_CHROMA_CHANNELS : PLANAR_CHROMA_CHANNELS)
+{
+}
+
+template <typename Sink>
+void YuvRgbResizer::ForEachRow(const uint8_t* src, size_t startRow, size_t endRow, Sink&& sink) const
+{
+    const uint8_t* chroma = src + srcWidth_ * srcHeight_;
+    PlaneStream luma(lumaResizer_, src, srcWidth_, startRow);
+    if (format_ == ImageFormat::NV12) {
+        // interleaved UV rows are as wide as the luma rows
+        PlaneStream uv(chromaResizer_, chroma, srcWidth_, startRow);
+        for (size_t yy = startRow; yy < endRow; yy++) {
+            const uint8_t* uvRow = uv.Row(yy);
+            sink(yy, luma.Row(yy), uvRow, uvRow + INDEX_ONE, NV12_CHROMA_CHANNELS);
+        }
+        return;
+    }
+    size_t chromaWidth = srcWidth_ / CHROMA_SUBSAMPLE;
+    size_t chromaHeight = srcHeight_ / CHROMA_SUBSAMPLE;
+    PlaneStream u(chromaResizer_, chroma, chromaWidth, startRow);
+    PlaneStream v(chromaResizer_, chroma + chromaWidth * chromaHeight, chromaWidth, startRow);
+    for (size_t yy = startRow; yy < endRow; yy++) {
+        const uint8_t* yRow = luma.Row(yy);
+        const uint8_t* uRow = u.Row(yy);
+        sink(yy, yRow, uRow, v.Row(yy), PLANAR_CHROMA_CHANNELS);
+    }
+}
+
+void YuvRgbResizer::Run(const uint8_t* src, size_t startRow, size_t endRow, uint8_t* dst) const
+{
+    ForEachRow(src, startRow, endRow,
+               [this, dst](size_t yy, const uint8_t* yRow, const uint8_t* uRow, const uint8_t* vRow, size_t step) {
+                   uint8_t* rgb = dst + yy * dstWidth_ * RGB_CHANNELS;
+                   for (size_t xx = 0; xx < dstWidth_; xx++) {
+                       YuvToRgb(yRow[xx], uRow[xx * step], vRow[xx * step], rgb + xx * RGB_CHANNELS);
+                   }
+               });
+}
+
+void YuvRgbResizer::RunNormalize(const uint8_t* src, size_t startRow, size_t endRow, const std::vector<float>& mean,
+                                 const std::vector<float>& std, bool planar, float* dst) const
+{
+    float scale[RGB_CHANNELS];
+    float bias[RGB_CHANNELS];
+    for (size_t c = 0; c < RGB_CHANNELS; c++) {
+        scale[c] = 1.0f / (MAX_PIXEL_FLOAT * std[c]);
+        bias[c] = -mean[c] / std[c];
+    }
+    size_t planeSize = dstWidth_ * dstHeight_;
+    ForEachRow(src, startRow, endRow,
+               [&](size_t yy, const uint8_t* yRow, const uint8_t* uRow, const uint8_t* vRow, size_t step) {
+                   uint8_t rgb[RGB_CHANNELS];
+                   for (size_t xx = 0; xx < dstWidth_; xx++) {
+                       YuvToRgb(yRow[xx], uRow[xx * step], vRow[xx * step], rgb);
+                       size_t pixel = yy * dstWidth_ + xx;
+                       for (size_t c = 0; c < RGB_CHANNELS; c++) {
+                           float value = rgb[c] * scale[c] + bias[c];
+                           if (planar) {
+                               dst[c * planeSize + pixel] = value;
+                           } else {
+                               dst[pixel * RGB_CHANNELS + c] = value;
+                           }
+                       }
+                   }
+               });
+}
+} // namespace Acc
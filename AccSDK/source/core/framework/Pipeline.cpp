@@ -25,9 +25,11 @@
 #include <unistd.h>
 #include <map>
 
+#include "securec.h"
 #include "acc/utils/TensorUtils.h"
 #include "acc/utils/LogImpl.h"
 #include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/BufferPoolImpl.h"
 using namespace acclib::accdata;
 namespace {
 using namespace Acc;
@@ -36,6 +38,47 @@ constexpr int MIN_THREAD_NUM = 1;
 constexpr int DEFAULT_PIPELINE_DEPTH = 2;
 constexpr int SINGLE_INPUT_SIZE = 1;
 constexpr int SINGLE_OUTPUT_SIZE = 1;
+
+// Whether the output buffer lies in one of the input tensors, which the pipeline shares instead of copying
+bool IsInputBuffer(const void* data, size_t numBytes, const std::vector<Tensor>& inputs)
+{
+    auto begin = static_cast<const char*>(data);
+    for (const auto& input : inputs) {
+        auto inputBegin = static_cast<const char*>(input.Ptr());
+        if (inputBegin != nullptr && begin < inputBegin + input.NumBytes() && inputBegin < begin + numBytes) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The result of a run into the caller's output must match it, and normally already lies in its memory
+ErrorCode CopyIntoOutput(const Tensor& result, Tensor& output)
+{
+    if (result.Shape() != output.Shape() || result.DType() != output.DType()) {
+        LogDebug << "Pipeline run into output failed, the result shape or data type does not match the output tensor."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (result.Ptr() == output.Ptr()) {
+        return SUCCESS;
+    }
+    if (memcpy_s(output.Ptr(), output.NumBytes(), result.Ptr(), result.NumBytes()) != EOK) {
+        LogDebug << "Copy the pipeline result into the output tensor failed." << GetErrorInfo(ERR_BAD_COPY);
+        return ERR_BAD_COPY;
+    }
+    return SUCCESS;
+}
+
+// Intermediate and output tensors of the pipelines come from the buffer pool like the tensors of the core operators
+std::shared_ptr<void> AllocatePipelineTensor(size_t numBytes)
+{
+    std::shared_ptr<void> buffer;
+    if (AllocateBuffer(numBytes, buffer) != SUCCESS) {
+        return nullptr;
+    }
+    return buffer;
+}
 } // namespace
 
 namespace Acc {
@@ -56,6 +99,7 @@ Pipeline::Pipeline(int numThreads, bool enableFusion)
         LogDebug << msg;
         throw std::runtime_error(msg);
     }
+    SetTensorAllocator(AllocatePipelineTensor);
     pipeline_ = AccDataPipeline::Create(DEFAULT_PIPELINE_BATCH_SIZE, numThreads, DEFAULT_PIPELINE_DEPTH, enableFusion);
     if (!pipeline_) {
         std::string msg = "Pipeline construct failed, because create acc data pipeline resulted in nullptr. "
@@ -80,6 +124,23 @@ ErrorCode Pipeline::Build(const std::vector<std::shared_ptr<AccDataOpSpec>>& spe
 }
 
 ErrorCode Pipeline::Run(const std::unordered_map<std::string, std::vector<Tensor>>& inputs, Tensor& output, bool copy)
+{
+    return Execute(inputs, output, copy, false);
+}
+
+ErrorCode Pipeline::RunInto(const std::unordered_map<std::string, std::vector<Tensor>>& inputs, Tensor& output,
+                            bool copy)
+{
+    if (output.Ptr() == nullptr) {
+        LogDebug << "Pipeline run into output failed, the output tensor has no memory."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    return Execute(inputs, output, copy, true);
+}
+
+ErrorCode Pipeline::Execute(const std::unordered_map<std::string, std::vector<Tensor>>& inputs, Tensor& output,
+                            bool copy, bool intoOutput)
 {
     // Currently only supports unordered map inputs of size 1.
     if (inputs.size() != SINGLE_INPUT_SIZE) {
@@ -119,8 +180,22 @@ ErrorCode Pipeline::Run(const std::unordered_map<std::string, std::vector<Tensor
         }
         accDataInputs.insert(std::make_pair(input->first, tensorList));
 
+        // the caller's output memory is handed to the pipeline output, an operator writes into it when it fits
+        std::vector<std::shared_ptr<AccDataTensorList>> outputBuffers;
+        if (intoOutput) {
+            auto outputBuffer = AccDataTensorList::Create(SINGLE_OUTPUT_SIZE);
+            std::shared_ptr<void> outputSharedPtr(output.Ptr(), [](void*) {});
+            if (outputBuffer == nullptr || outputBuffer->operator[](0).ShareData(outputSharedPtr, output.Shape(),
+                Acc::ToTensorDataType(output.DType())) != H_OK) {
+                LogDebug << "Share the output tensor to AccDataTensorList failed."
+                         << GetErrorInfo(ERR_ACC_DATA_EXECUTE_FAILURE);
+                return ERR_ACC_DATA_EXECUTE_FAILURE;
+            }
+            outputBuffers.push_back(outputBuffer);
+        }
+
         std::vector<std::shared_ptr<AccDataTensorList>> accDataOutputs;
-        accDataRet = pipeline_->Run(accDataInputs, accDataOutputs, copy);
+        accDataRet = pipeline_->RunInto(accDataInputs, accDataOutputs, copy, outputBuffers);
         if (accDataRet != H_OK) {
             LogDebug << "Pipeline run failed." << GetErrorInfo(ERR_ACC_DATA_EXECUTE_FAILURE);
             return ERR_ACC_DATA_EXECUTE_FAILURE;
@@ -131,12 +206,23 @@ ErrorCode Pipeline::Run(const std::unordered_map<std::string, std::vector<Tensor
                 << GetErrorInfo(ERR_ACC_DATA_EXECUTE_FAILURE);
             return ERR_ACC_DATA_EXECUTE_FAILURE;
         }
-        // convert accDataOutputs to output, current only support single output
-        auto tensorDataType = Acc::ToDataType(accDataOutputs[0]->operator[](0).DataType());
-        auto tensorFormat = Acc::ToTensorFormat(accDataOutputs[0]->operator[](0).Layout());
-        Tensor tensor(accDataOutputs[0]->operator[](0).RawDataPtr(), accDataOutputs[0]->operator[](0).Shape(),
-                      tensorDataType, tensorFormat, "cpu");
-        ret = tensor.Clone(output);
+        // convert accDataOutputs to output, current only support single output. The output takes the buffer over
+        // instead of copying it, the pipeline allocates a new one on the next run. A buffer shared from the inputs
+        // belongs to the caller and is copied.
+        auto& accDataOutput = accDataOutputs[0]->operator[](0);
+        auto tensorDataType = Acc::ToDataType(accDataOutput.DataType());
+        auto tensorFormat = Acc::ToTensorFormat(accDataOutput.Layout());
+        auto outputPtr = accDataOutput.RawDataPtr();
+        Tensor tensor(outputPtr.get(), accDataOutput.Shape(), tensorDataType, tensorFormat, "cpu");
+        if (intoOutput) {
+            ret = CopyIntoOutput(tensor, output);
+            accDataOutput.Reset();
+        } else if (IsInputBuffer(outputPtr.get(), tensor.NumBytes(), input->second)) {
+            ret = tensor.Clone(output);
+        } else {
+            output = Tensor(outputPtr, accDataOutput.Shape(), tensorDataType, tensorFormat, "cpu");
+            accDataOutput.Reset();
+        }
     } catch (const std::exception& e) {
         LogDebug << "Properties conversion between Multimodal SDK and acc_data tensors failed: " << e.what()
             << GetErrorInfo(ERR_ACC_DATA_PROPERTY_CONVERT_FAILURE);
@@ -24,8 +24,11 @@
 
 #include "acc/tensor/TensorOps.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <limits>
+#include <numeric>
 #include <vector>
 
 #include "acc/ErrorCode.h"
@@ -38,7 +41,242 @@
 #include "acc/tensor/OpsCustomChecker.h"
 #include "acc/tensor/OpsBaseChecker.h"
 #include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/BufferPoolImpl.h"
+namespace {
+using namespace Acc;
+constexpr int MAX_INTERNVL2_TILE_NUM = 32;
+constexpr size_t NHWC_DIM_NUM = 4;
+constexpr size_t QWEN_CHANNEL_NUM = 3;
+constexpr double HALF_AREA_RATIO = 0.5;
+constexpr double MAX_QWEN_ASPECT_RATIO = 200.0;
+
+/**
+ * @brief Enumerate every (w, h) tile grid with minNum <= w * h <= maxNum, ordered by tile count.
+ */
+std::vector<std::pair<int, int>> GetTargetRatios(int minNum, int maxNum)
+{
+    std::vector<std::pair<int, int>> targetRatios;
+    for (int i = 1; i <= maxNum; ++i) {
+        for (int j = 1; j <= maxNum; ++j) {
+            if (i * j >= minNum && i * j <= maxNum) {
+                targetRatios.emplace_back(i, j);
+            }
+        }
+    }
+    std::stable_sort(targetRatios.begin(), targetRatios.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first * lhs.second < rhs.first * rhs.second;
+    });
+    return targetRatios;
+}
+
+/**
+ * @brief Same rule as InternVL2 find_closest_aspect_ratio: the closest aspect ratio wins, ties go to the
+ *        larger grid when the image covers more than half of its area.
+ */
+std::pair<int, int> FindClosestAspectRatio(size_t width, size_t height, int inputSize,
+                                           const std::vector<std::pair<int, int>>& targetRatios)
+{
+    double aspectRatio = static_cast<double>(width) / static_cast<double>(height);
+    double bestRatioDiff = std::numeric_limits<double>::infinity();
+    std::pair<int, int> bestRatio = {1, 1};
+    double area = static_cast<double>(width) * static_cast<double>(height);
+    for (const auto& ratio : targetRatios) {
+        double targetAspectRatio = static_cast<double>(ratio.first) / static_cast<double>(ratio.second);
+        double ratioDiff = std::abs(aspectRatio - targetAspectRatio);
+        if (ratioDiff < bestRatioDiff) {
+            bestRatioDiff = ratioDiff;
+            bestRatio = ratio;
+        } else if (std::abs(ratioDiff - bestRatioDiff) <= std::numeric_limits<double>::epsilon()) {
+            if (area > HALF_AREA_RATIO * inputSize * inputSize * ratio.first * ratio.second) {
+                bestRatio = ratio;
+            }
+        }
+    }
+    return bestRatio;
+}
+
+/**
+ * @brief Collect the frame tensors of a video for the fused operator
+ *
+ * Frames of the same size are read where they are. When the sizes differ every frame is resized to
+ * (resizeH, resizeW) first, a bicubic resize to the same size is an exact copy, so the fused operator gives the
+ * same result as resizing every frame itself.
+ */
+ErrorCode CollectFrames(const std::vector<std::shared_ptr<Image>>& frames, int resizeH, int resizeW,
+                        std::vector<Tensor>& tensors)
+{
+    if (frames.empty() || frames[0] == nullptr || frames[0]->GetTensor().Shape().size() != NHWC_DIM_NUM) {
+        LogError << "Input frames should not be empty!" << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    const Tensor& first = frames[0]->GetTensor();
+    bool sameSize = true;
+    for (const auto& frame : frames) {
+        if (frame == nullptr || frame->GetTensor().DType() != first.DType() ||
+            frame->GetTensor().Format() != first.Format()) {
+            LogError << "All frames of a video should have the same data type and format."
+                     << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+        sameSize = sameSize && frame->GetTensor().Shape() == first.Shape();
+    }
+    if (!sameSize && (resizeH <= 0 || resizeW <= 0)) {
+        LogError << "The resize height and width should be > 0." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    tensors.clear();
+    tensors.reserve(frames.size());
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (sameSize) {
+            tensors.push_back(frames[i]->GetTensor());
+            continue;
+        }
+        Tensor resized;
+        ErrorCode ret = TensorResize(frames[i]->GetTensor(), resized, resizeH, resizeW, Interpolation::BICUBIC,
+                                     DeviceMode::CPU);
+        if (ret != SUCCESS) {
+            LogError << "Failed to resize frame " << i << "." << GetErrorInfo(ret);
+            return ret;
+        }
+        tensors.push_back(std::move(resized));
+    }
+    return SUCCESS;
+}
+} // namespace
+
 namespace Acc {
+ErrorCode FusionOperator::Qwen2VLSmartResize(size_t height, size_t width, const QwenPreprocessConfig& config,
+                                             int& resizeH, int& resizeW)
+{
+    if (config.patchSize <= 0 || config.mergeSize <= 0) {
+        LogError << "The patch size and merge size must be > 0, but get " << config.patchSize << " and "
+                 << config.mergeSize << "." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (config.minPixels <= 0 || config.minPixels > config.maxPixels) {
+        LogError << "The pixels must satisfy 0 < minPixels <= maxPixels, but get minPixels " << config.minPixels
+                 << " and maxPixels " << config.maxPixels << "." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    auto factor = static_cast<double>(config.patchSize * config.mergeSize);
+    auto h = static_cast<double>(height);
+    auto w = static_cast<double>(width);
+    if (h < factor || w < factor) {
+        LogError << "The image height " << height << " and width " << width << " must be larger than "
+                 << "patch size * merge size (" << factor << ")." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (std::max(h, w) / std::min(h, w) > MAX_QWEN_ASPECT_RATIO) {
+        LogError << "The absolute aspect ratio of the image must be smaller than " << MAX_QWEN_ASPECT_RATIO
+                 << ", but get height " << height << " and width " << width << "." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    // nearbyint rounds half to even, the same as the Python round used by the reference implementation
+    double hBar = std::nearbyint(h / factor) * factor;
+    double wBar = std::nearbyint(w / factor) * factor;
+    if (hBar * wBar > config.maxPixels) {
+        double beta = std::sqrt(h * w / config.maxPixels);
+        hBar = std::floor(h / beta / factor) * factor;
+        wBar = std::floor(w / beta / factor) * factor;
+    } else if (hBar * wBar < config.minPixels) {
+        double beta = std::sqrt(config.minPixels / (h * w));
+        hBar = std::ceil(h * beta / factor) * factor;
+        wBar = std::ceil(w * beta / factor) * factor;
+    }
+    resizeH = static_cast<int>(hBar);
+    resizeW = static_cast<int>(wBar);
+    return SUCCESS;
+}
+
+ErrorCode FusionOperator::Qwen2VLResolveResizeSizes(const std::vector<std::shared_ptr<Image>>& images,
+                                                    const QwenPreprocessConfig& config,
+                                                    std::vector<std::pair<int, int>>& sizes)
+{
+    sizes.clear();
+    if (!config.resizeSizes.empty()) {
+        if (config.resizeSizes.size() != images.size()) {
+            LogError << "The number of resize sizes " << config.resizeSizes.size() << " should be equal to the "
+                     << "number of images " << images.size() << "." << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+        sizes = config.resizeSizes;
+        return SUCCESS;
+    }
+    if (config.resizeH != 0 || config.resizeW != 0) {
+        return SUCCESS;
+    }
+    sizes.resize(images.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (images[i] == nullptr) {
+            LogError << "Input image " << i << " should not be empty!" << GetErrorInfo(ERR_INVALID_PARAM);
+            sizes.clear();
+            return ERR_INVALID_PARAM;
+        }
+        ErrorCode ret = Qwen2VLSmartResize(images[i]->Height(), images[i]->Width(), config, sizes[i].first,
+                                           sizes[i].second);
+        if (ret != SUCCESS) {
+            LogError << "Failed to compute the resize size of image " << i << "." << GetErrorInfo(ret);
+            sizes.clear();
+            return ret;
+        }
+    }
+    return SUCCESS;
+}
+
+ErrorCode FusionOperator::Qwen2VLEstimateTokens(size_t height, size_t width, size_t numFrames,
+                                                const QwenPreprocessConfig& config, std::vector<size_t>& gridThw,
+                                                size_t& numTokens)
+{
+    if (numFrames == 0 || config.temporalPatchSize <= 0) {
+        LogError << "The number of frames and the temporal patch size must be > 0, but get " << numFrames
+                 << " and " << config.temporalPatchSize << "." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    int resizeH = config.resizeH;
+    int resizeW = config.resizeW;
+    if (resizeH == 0 && resizeW == 0) {
+        ErrorCode ret = Qwen2VLSmartResize(height, width, config, resizeH, resizeW);
+        if (ret != SUCCESS) {
+            return ret;
+        }
+    }
+    int factor = config.patchSize * config.mergeSize;
+    if (factor <= 0 || resizeH <= 0 || resizeW <= 0 || resizeH % factor != 0 || resizeW % factor != 0) {
+        LogError << "The resize height " << resizeH << " and width " << resizeW << " must be positive multiples "
+                 << "of patch size * merge size (" << factor << ")." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    auto temporal = static_cast<size_t>(config.temporalPatchSize);
+    gridThw = {(numFrames + temporal - 1) / temporal, static_cast<size_t>(resizeH / config.patchSize),
+               static_cast<size_t>(resizeW / config.patchSize)};
+    auto mergeArea = static_cast<size_t>(config.mergeSize * config.mergeSize);
+    numTokens = gridThw[0] * gridThw[1] * gridThw[2] / mergeArea;
+    return SUCCESS;
+}
+
+ErrorCode FusionOperator::InternVL2EstimateTokens(size_t height, size_t width, const InternVL2PreprocessConfig& config,
+                                                  size_t tokensPerTile, size_t& numTiles, size_t& numTokens)
+{
+    if (config.minNum < 1 || config.minNum > config.maxNum || config.maxNum > MAX_INTERNVL2_TILE_NUM) {
+        LogError << "The tile number must satisfy 1 <= minNum <= maxNum <= " << MAX_INTERNVL2_TILE_NUM
+                 << ", but get minNum " << config.minNum << " and maxNum " << config.maxNum << "."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (width == 0 || height == 0) {
+        LogError << "Input image size should not be 0." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    auto bestRatio = FindClosestAspectRatio(width, height, config.inputSize,
+                                            GetTargetRatios(config.minNum, config.maxNum));
+    numTiles = static_cast<size_t>(bestRatio.first * bestRatio.second);
+    if (config.useThumbnail && numTiles != 1) {
+        numTiles++;
+    }
+    numTokens = numTiles * tokensPerTile;
+    return SUCCESS;
+}
+
 ErrorCode FusionOperator::Qwen2VLImagePreprocess(const std::vector<std::shared_ptr<Image>>& images,
                                                  const QwenPreprocessConfig& config, std::vector<Tensor>& outputTensors)
 {
@@ -54,14 +292,188 @@ ErrorCode FusionOperator::Qwen2VLImagePreprocess(const std::vector<std::shared_p
     outputRefs.reserve(images.size());
 
     for (size_t i = 0; i < images.size(); ++i) {
+        if (images[i] == nullptr) {
+            LogError << "Input image " << i << " should not be empty!" << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
         inputRefs.push_back(std::cref(images[i]->GetTensor()));
         outputRefs.push_back(std::ref(outputTensors[i]));
     }
 
-    QwenFusionContext opCtx(inputRefs, outputRefs, config.mean, config.std, config.resizeH, config.resizeW,
-                            TensorFormat::NHWC, DeviceMode::CPU);
+    std::vector<std::pair<int, int>> resizeSizes;
+    ErrorCode ret = Qwen2VLResolveResizeSizes(images, config, resizeSizes);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    int resizeH = resizeSizes.empty() ? config.resizeH : resizeSizes[0].first;
+    int resizeW = resizeSizes.empty() ? config.resizeW : resizeSizes[0].second;
+
+    QwenFusionContext opCtx(inputRefs, outputRefs, config.mean, config.std, resizeH, resizeW, TensorFormat::NHWC,
+                            DeviceMode::CPU);
+    opCtx.flattenPatches = config.flattenPatches;
+    opCtx.patchSize = config.patchSize;
+    opCtx.temporalPatchSize = config.temporalPatchSize;
+    opCtx.mergeSize = config.mergeSize;
+    opCtx.resizeSizes = std::move(resizeSizes);
+    opCtx.outputType = config.outputType;
+
+    ret = QwenFusionChecker(OperatorId::QWENFUSION).CheckAndImplicitMalloc(opCtx);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+
+    auto accelerator = Acc::GetAccelerator(opCtx.deviceMode);
+    return accelerator.ExecuteOperator(OperatorId::QWENFUSION, opCtx);
+}
+
+ErrorCode FusionOperator::Qwen2VLImagePatches(const std::vector<std::shared_ptr<Image>>& images,
+                                              const QwenPreprocessConfig& config, Tensor& pixelValues,
+                                              std::vector<size_t>& gridThw)
+{
+    if (images.empty()) {
+        LogError << "Input images should not be empty!" << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (config.patchSize <= 0 || config.temporalPatchSize <= 0) {
+        LogError << "The patch size and temporal patch size must be > 0, but get " << config.patchSize << " and "
+                 << config.temporalPatchSize << "." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    QwenPreprocessConfig patchConfig = config;
+    patchConfig.flattenPatches = true;
+    ErrorCode ret = Qwen2VLResolveResizeSizes(images, config, patchConfig.resizeSizes);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    if (patchConfig.resizeSizes.empty()) {
+        patchConfig.resizeSizes.assign(images.size(), {config.resizeH, config.resizeW});
+    }
+
+    auto patch = static_cast<size_t>(config.patchSize);
+    size_t rowSize = QWEN_CHANNEL_NUM * static_cast<size_t>(config.temporalPatchSize) * patch * patch;
+    size_t rowBytes = rowSize * GetByteSize(config.outputType);
+    std::vector<size_t> rows(images.size());
+    gridThw.clear();
+    gridThw.reserve(images.size() * 3); // 3 is (t, h, w)
+    for (size_t i = 0; i < images.size(); ++i) {
+        const auto& size = patchConfig.resizeSizes[i];
+        if (size.first <= 0 || size.second <= 0) {
+            LogError << "The resize height " << size.first << " and width " << size.second << " of image " << i
+                     << " must be > 0." << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+        size_t gridH = static_cast<size_t>(size.first) / patch;
+        size_t gridW = static_cast<size_t>(size.second) / patch;
+        rows[i] = gridH * gridW;
+        gridThw.insert(gridThw.end(), {1, gridH, gridW});
+    }
+    size_t totalRows = std::accumulate(rows.begin(), rows.end(), static_cast<size_t>(0));
+    std::shared_ptr<void> dataPtr;
+    if (AllocateBuffer(totalRows * rowBytes, dataPtr) != SUCCESS) {
+        LogError << "Failed to malloc for patches." << GetErrorInfo(ERR_BAD_ALLOC);
+        return ERR_BAD_ALLOC;
+    }
+    // every image writes its rows through a view at its offset of the shared buffer
+    std::vector<Tensor> views;
+    views.reserve(images.size());
+    char* data = static_cast<char*>(dataPtr.get());
+    for (size_t i = 0; i < images.size(); ++i) {
+        views.emplace_back(static_cast<void*>(data), std::vector<size_t>{rows[i], rowSize}, config.outputType,
+                           TensorFormat::ND, "cpu");
+        data += rows[i] * rowBytes;
+    }
+    ret = Qwen2VLImagePreprocess(images, patchConfig, views);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    pixelValues = Tensor(dataPtr, {totalRows, rowSize}, config.outputType, TensorFormat::ND, "cpu");
+    return SUCCESS;
+}
+
+ErrorCode FusionOperator::InternVL2ImagePreprocess(const std::shared_ptr<Image>& image,
+                                                   const InternVL2PreprocessConfig& config, Tensor& outputTensor)
+{
+    if (image == nullptr) {
+        LogError << "Input image should not be empty!" << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (config.minNum < 1 || config.minNum > config.maxNum || config.maxNum > MAX_INTERNVL2_TILE_NUM) {
+        LogError << "The tile number must satisfy 1 <= minNum <= maxNum <= " << MAX_INTERNVL2_TILE_NUM
+                 << ", but get minNum " << config.minNum << " and maxNum " << config.maxNum << "."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (image->Width() == 0 || image->Height() == 0) {
+        LogError << "Input image size should not be 0." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    auto bestRatio = FindClosestAspectRatio(image->Width(), image->Height(), config.inputSize,
+                                            GetTargetRatios(config.minNum, config.maxNum));
+
+    InternVL2FusionContext opCtx({std::cref(image->GetTensor())}, {std::ref(outputTensor)}, config.mean, config.std,
+                                 config.inputSize, bestRatio.first, bestRatio.second, config.useThumbnail,
+                                 DeviceMode::CPU);
+
+    ErrorCode ret = InternVL2FusionChecker(OperatorId::INTERNVL2FUSION).CheckAndImplicitMalloc(opCtx);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+
+    auto accelerator = Acc::GetAccelerator(opCtx.deviceMode);
+    return accelerator.ExecuteOperator(OperatorId::INTERNVL2FUSION, opCtx);
+}
+
+ErrorCode FusionOperator::ClipImagePreprocess(const std::vector<std::shared_ptr<Image>>& images,
+                                              const ClipPreprocessConfig& config, Tensor& outputTensor)
+{
+    if (images.empty()) {
+        LogError << "Input images should not be empty!" << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    std::vector<std::reference_wrapper<const Tensor>> inputRefs;
+    inputRefs.reserve(images.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (images[i] == nullptr) {
+            LogError << "Input image " << i << " should not be empty!" << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+        inputRefs.push_back(std::cref(images[i]->GetTensor()));
+    }
+
+    ClipFusionContext opCtx(inputRefs, {std::ref(outputTensor)}, config.mean, config.std, config.shortestEdge,
+                            config.cropH, config.cropW, DeviceMode::CPU);
+    opCtx.resizeH = config.resizeH;
+    opCtx.resizeW = config.resizeW;
+
+    ErrorCode ret = ClipFusionChecker(OperatorId::CLIPFUSION).CheckAndImplicitMalloc(opCtx);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+
+    auto accelerator = Acc::GetAccelerator(opCtx.deviceMode);
+    return accelerator.ExecuteOperator(OperatorId::CLIPFUSION, opCtx);
+}
+
+ErrorCode FusionOperator::Qwen2VLVideoPreprocess(const std::vector<std::shared_ptr<Image>>& frames,
+                                                 const QwenPreprocessConfig& config, Tensor& outputTensor)
+{
+    std::vector<Tensor> frameTensors;
+    ErrorCode ret = CollectFrames(frames, config.resizeH, config.resizeW, frameTensors);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+
+    std::vector<std::reference_wrapper<const Tensor>> inputRefs(frameTensors.begin(), frameTensors.end());
+    QwenFusionContext opCtx(inputRefs, {std::ref(outputTensor)}, config.mean, config.std, config.resizeH,
+                            config.resizeW, TensorFormat::NHWC, DeviceMode::CPU);
+    opCtx.mergeFrames = true;
+    opCtx.flattenPatches = true;
+    opCtx.patchSize = config.patchSize;
+    opCtx.temporalPatchSize = config.temporalPatchSize;
+    opCtx.mergeSize = config.mergeSize;
+    opCtx.outputType = config.outputType;
 
-    ErrorCode ret = QwenFusionChecker(OperatorId::QWENFUSION).CheckAndImplicitMalloc(opCtx);
+    ret = QwenFusionChecker(OperatorId::QWENFUSION).CheckAndImplicitMalloc(opCtx);
     if (ret != SUCCESS) {
         return ret;
     }
@@ -70,4 +482,4 @@ ErrorCode FusionOperator::Qwen2VLImagePreprocess(const std::vector<std::shared_p
     return accelerator.ExecuteOperator(OperatorId::QWENFUSION, opCtx);
 }
 
-} // namespace Acc
\ No newline at end of file
+} // namespace Acc
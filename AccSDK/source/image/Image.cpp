@@ -20,17 +20,23 @@
  * History: NA
  */
 #include "acc/image/Image.h"
+#include <algorithm>
 #include <numeric>
 #include <stdexcept>
 #include <fstream>
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <atomic>
+#include <type_traits>
 #include "acc/ErrorCode.h"
 #include "acc/utils/LogImpl.h"
 #include "acc/tensor/Tensor.h"
 #include "acc/utils/ImageUtils.h"
+#include "acc/utils/Base64Utils.h"
 #include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/ThreadPool.h"
+#include "acc/utils/FilePrefetcher.h"
 namespace {
 using namespace Acc;
 constexpr int32_t CPU_DEVICE_ID = -1;
@@ -40,11 +46,16 @@ constexpr size_t THREE_CHANNEL = 3;
 constexpr size_t FOUR_CHANNEL = 4;
 constexpr size_t FOUR_DIM = 4;
 constexpr size_t ONE_BATCH = 1;
+constexpr size_t YUV420_SUBSAMPLE = 2;
 
 constexpr size_t INDEX_0 = 0;
 constexpr size_t INDEX_1 = 1;
 constexpr size_t INDEX_2 = 2;
 constexpr size_t INDEX_3 = 3;
+constexpr size_t MAX_PROBE_TASK_NUM = 16;
+constexpr size_t MAX_DECODE_TASK_NUM = 16;
+constexpr size_t MAX_ENCODE_TASK_NUM = 16;
+constexpr size_t BASE64_KEEP_BYTES = 16 * 1024 * 1024; // 16MB, larger decode buffers are freed after use
 
 constexpr ErrorCode GetImageChannel(size_t& imChannel, ImageFormat imFormat)
 {
@@ -58,6 +69,11 @@ constexpr ErrorCode GetImageChannel(size_t& imChannel, ImageFormat imFormat)
         case ImageFormat::BGR_PLANAR:
             imChannel = THREE_CHANNEL;
             return SUCCESS;
+        case ImageFormat::NV12:
+            [[fallthrough]];
+        case ImageFormat::YUV420P:
+            imChannel = ONE_CHANNEL;
+            return SUCCESS;
         default:
             LogError << "Unsupported image format." << GetErrorInfo(ERR_INVALID_PARAM);
             return ERR_INVALID_PARAM;
@@ -77,6 +93,11 @@ constexpr ErrorCode GetTensorFormatFromImage(TensorFormat& tensorFormat, ImageFo
         case ImageFormat::BGR_PLANAR:
             tensorFormat = TensorFormat::NCHW;
             return SUCCESS;
+        case ImageFormat::NV12:
+            [[fallthrough]];
+        case ImageFormat::YUV420P:
+            tensorFormat = TensorFormat::ND;
+            return SUCCESS;
         default:
             LogError << "Unsupported image format." << GetErrorInfo(ERR_INVALID_PARAM);
             return ERR_INVALID_PARAM;
@@ -116,6 +137,16 @@ ErrorCode GetTensorShapeFromImage(std::vector<size_t>& tensorShape, const std::v
         case ImageFormat::BGR_PLANAR:
             tensorShape = {imBatch, imChannel, imHeight, imWidth};
             return SUCCESS;
+        case ImageFormat::NV12:
+            [[fallthrough]];
+        case ImageFormat::YUV420P:
+            if (imWidth % YUV420_SUBSAMPLE != 0 || imHeight % YUV420_SUBSAMPLE != 0) {
+                LogError << "The width and height of a yuv420 image must be even." << GetErrorInfo(ERR_INVALID_PARAM);
+                return ERR_INVALID_PARAM;
+            }
+            // full resolution Y plane followed by the quarter size chroma
+            tensorShape = {imHeight + imHeight / YUV420_SUBSAMPLE, imWidth};
+            return SUCCESS;
         default:
             LogError << "Unsupported image format." << GetErrorInfo(ERR_INVALID_PARAM);
             return ERR_INVALID_PARAM;
@@ -150,6 +181,109 @@ void InitFromRawData(const std::vector<size_t>& imSize, ImageFormat imFormat, Da
         throw std::runtime_error("Create image failed, image size or format is invalid.");
     }
 }
+
+ErrorCode CheckDecodeOptions(const ImageDecodeOptions& options)
+{
+    if (options.resizeWidth == 0 && options.resizeHeight == 0) {
+        return SUCCESS;
+    }
+    ErrorCode ret = CheckImSize({options.resizeWidth, options.resizeHeight});
+    if (ret != SUCCESS) {
+        LogError << "Decode images failed, the resize target is invalid." << GetErrorInfo(ret);
+    }
+    return ret;
+}
+
+ErrorCode WrapDecodedImage(std::shared_ptr<unsigned char[]>& decoded, size_t width, size_t height, Image& image)
+{
+    std::shared_ptr<void> decodedRgbData(decoded.get(), [decoded](void*) mutable { decoded.reset(); });
+    try {
+        image = Image(decodedRgbData, {width, height}, ImageFormat::RGB);
+    } catch (const std::exception& e) {
+        LogError << "Create decoded image failed, error: " << e.what() << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    return SUCCESS;
+}
+
+ErrorCode DecodeImageFrom(const ImageBuffer& buffer, const ImageDecodeOptions& options, Image& image)
+{
+    std::shared_ptr<unsigned char[]> decoded;
+    if (options.resizeWidth != 0) {
+        ErrorCode ret = DecodeImageDataResized(buffer.data, buffer.size, options.resizeWidth, options.resizeHeight,
+                                               decoded);
+        return ret != SUCCESS ? ret : WrapDecodedImage(decoded, options.resizeWidth, options.resizeHeight, image);
+    }
+    int width = 0;
+    int height = 0;
+    ErrorCode ret = DecodeImageData(buffer.data, buffer.size, width, height, decoded);
+    return ret != SUCCESS ? ret : WrapDecodedImage(decoded, width, height, image);
+}
+
+// the path was handed to the prefetcher, the decode task only waits when the I/O threads are behind
+ErrorCode DecodeBatchItem(const std::string&, size_t index, FilePrefetcher* prefetcher,
+                          const ImageDecodeOptions& options, Image& image)
+{
+    MappedFile file;
+    ErrorCode ret = prefetcher->Take(index, file);
+    return ret != SUCCESS ? ret : DecodeImageFrom(ImageBuffer{file.Data(), file.Size()}, options, image);
+}
+
+ErrorCode DecodeBatchItem(const ImageBuffer& buffer, size_t, FilePrefetcher*, const ImageDecodeOptions& options,
+                          Image& image)
+{
+    return DecodeImageFrom(buffer, options, image);
+}
+
+template <typename Source>
+ErrorCode DecodeImageBatch(const std::vector<Source>& sources, std::vector<Image>& images,
+                           std::vector<ErrorCode>& statuses, const ImageDecodeOptions& options)
+{
+    images.assign(sources.size(), Image());
+    statuses.assign(sources.size(), SUCCESS);
+    ErrorCode ret = CheckDecodeOptions(options);
+    if (ret != SUCCESS) {
+        statuses.assign(sources.size(), ret);
+        return ret;
+    }
+    // files are read ahead in path order on the I/O thread pool, the tasks below take them in the same order
+    std::unique_ptr<FilePrefetcher> prefetcher;
+    if constexpr (std::is_same_v<Source, std::string>) {
+        prefetcher = std::make_unique<FilePrefetcher>(sources, [](const char* path, MappedFile& file) {
+            return MapImageFile(path, file, true);
+        });
+    }
+    // images differ a lot in size, so the tasks pull the next item instead of owning a fixed slice
+    std::atomic<size_t> next(0);
+    size_t taskNum = std::min(sources.size(), MAX_DECODE_TASK_NUM);
+    std::vector<std::future<void>> futures;
+    try {
+        for (size_t task = 0; task < taskNum; ++task) {
+            futures.push_back(ThreadPool::GetInstance().Submit([&next, &sources, &prefetcher, &options, &images,
+                                                                &statuses]() {
+                for (size_t i = next.fetch_add(1); i < sources.size(); i = next.fetch_add(1)) {
+                    statuses[i] = DecodeBatchItem(sources[i], i, prefetcher.get(), options, images[i]);
+                }
+            }));
+        }
+        ThreadPool::GetInstance().WaitAll(futures);
+    } catch (const std::exception& e) {
+        for (auto& future : futures) {
+            if (future.valid()) {
+                future.wait();
+            }
+        }
+        LogError << "Decode images failed, error: " << e.what() << GetErrorInfo(ERR_INVALID_THREAD_POOL_STATUST);
+        return ERR_INVALID_THREAD_POOL_STATUST;
+    }
+    for (size_t i = 0; i < statuses.size(); ++i) {
+        if (statuses[i] != SUCCESS) {
+            LogError << "Decode image " << i << " of the batch failed." << GetErrorInfo(statuses[i]);
+            return statuses[i];
+        }
+    }
+    return SUCCESS;
+}
 } // namespace
 
 namespace Acc {
@@ -182,14 +316,13 @@ Image::Image(const char* path, const char* device)
     LogDebug << "Create Image from path.";
     int imWidth;
     int imHeight;
-    std::vector<uint8_t> imData;
     std::shared_ptr<unsigned char[]> ptr;
     CheckDeviceFromConstructor(device);
-    auto decodeRet = ReadJpegData(path, imData, imWidth, imHeight, ptr);
+    auto decodeRet = ReadImageData(path, imWidth, imHeight, ptr);
     if (decodeRet != SUCCESS) {
-        LogError << "ReadJpegData failed. Refer to the above log for detailed error information."
+        LogError << "ReadImageData failed. Refer to the above log for detailed error information."
                  << GetErrorInfo(decodeRet);
-        throw std::runtime_error("Create image from path failed. Failed to decode JPEG for CPU.");
+        throw std::runtime_error("Create image from path failed. Failed to decode image for CPU.");
     }
     size_ = {static_cast<size_t>(imWidth), static_cast<size_t>(imHeight)};
     format_ = ImageFormat::RGB;
@@ -200,7 +333,29 @@ Image::Image(const char* path, const char* device)
     tensor_ = dst;
 }
 
-// Deep copy of data
+// Decoded from an in-memory jpeg, png or webp
+Image::Image(const uint8_t* data, size_t size, const char* device)
+{
+    LogDebug << "Create Image from buffer.";
+    CheckDeviceFromConstructor(device);
+    int imWidth;
+    int imHeight;
+    std::shared_ptr<unsigned char[]> ptr;
+    auto decodeRet = DecodeImageData(data, size, imWidth, imHeight, ptr);
+    if (decodeRet != SUCCESS) {
+        LogError << "DecodeImageData failed. Refer to the above log for detailed error information."
+                 << GetErrorInfo(decodeRet);
+        throw std::runtime_error("Create image from buffer failed. Failed to decode image for CPU.");
+    }
+    size_ = {static_cast<size_t>(imWidth), static_cast<size_t>(imHeight)};
+    format_ = ImageFormat::RGB;
+    std::vector<size_t> dstShape = {ONE_BATCH, static_cast<size_t>(imHeight), static_cast<size_t>(imWidth),
+                                    THREE_CHANNEL};
+    std::shared_ptr<void> decodedRgbData(ptr.get(), [ptr](void*) mutable { ptr.reset(); });
+    tensor_ = Tensor(decodedRgbData, dstShape, DataType::UINT8, TensorFormat::NHWC, "cpu");
+}
+
+// Shares the pixels until one side calls MakeUnique
 ErrorCode Image::Clone(Image& other) const
 {
     LogDebug << "Clone Image.";
@@ -219,6 +374,30 @@ ErrorCode Image::Clone(Image& other) const
     return SUCCESS;
 }
 
+ErrorCode Image::MakeUnique()
+{
+    ErrorCode ret = tensor_.MakeUnique();
+    if (ret != SUCCESS) {
+        LogError << "Copy image data failed. See above for detailed error information." << GetErrorInfo(ret);
+    }
+    return ret;
+}
+
+ErrorCode Image::EncodeJpeg(std::vector<uint8_t>& encoded, int quality) const
+{
+    if (format_ != ImageFormat::RGB && format_ != ImageFormat::BGR) {
+        LogError << "Encode jpeg failed, only RGB or BGR images are supported." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    TJPF pixelFormat = format_ == ImageFormat::RGB ? TJPF_RGB : TJPF_BGR;
+    ErrorCode ret = EncodeJpegData(static_cast<const uint8_t*>(tensor_.Ptr()), Width(), Height(), pixelFormat, quality,
+                                   encoded);
+    if (ret != SUCCESS) {
+        LogError << "Encode jpeg failed." << GetErrorInfo(ret);
+    }
+    return ret;
+}
+
 // Obtain image attributes
 const std::vector<size_t>& Image::Size() const
 {
@@ -245,7 +424,7 @@ DataType Image::DType() const
     return tensor_.DType();
 }
 
-std::unique_ptr<char[]> Image::Device() const
+const char* Image::Device() const
 {
     return tensor_.Device();
 }
@@ -264,4 +443,103 @@ Tensor& Image::GetTensor() const
 {
     return tensor_;
 }
-} // namespace Acc
\ No newline at end of file
+
+ErrorCode ProbeImage(const char* path, ImageProbeInfo& info)
+{
+    int width = 0;
+    int height = 0;
+    info.status = ReadJpegHeader(path, width, height);
+    if (info.status != SUCCESS) {
+        LogError << "Probe image failed." << GetErrorInfo(info.status);
+        return info.status;
+    }
+    info.width = static_cast<size_t>(width);
+    info.height = static_cast<size_t>(height);
+    return SUCCESS;
+}
+
+ErrorCode ProbeImages(const std::vector<std::string>& paths, std::vector<ImageProbeInfo>& infos)
+{
+    infos.assign(paths.size(), ImageProbeInfo{});
+    ErrorCode ret = ThreadPool::GetInstance().ParallelFor(paths.size(), MAX_PROBE_TASK_NUM,
+        [&paths, &infos](size_t i) { ProbeImage(paths[i].c_str(), infos[i]); });
+    if (ret != SUCCESS) {
+        LogError << "Probe images failed." << GetErrorInfo(ret);
+        return ret;
+    }
+    for (const auto& info : infos) {
+        if (info.status != SUCCESS) {
+            return info.status;
+        }
+    }
+    return SUCCESS;
+}
+
+ErrorCode DecodeImages(const std::vector<std::string>& paths, std::vector<Image>& images,
+                       std::vector<ErrorCode>& statuses, const ImageDecodeOptions& options)
+{
+    return DecodeImageBatch(paths, images, statuses, options);
+}
+
+ErrorCode DecodeImages(const std::vector<ImageBuffer>& buffers, std::vector<Image>& images,
+                       std::vector<ErrorCode>& statuses, const ImageDecodeOptions& options)
+{
+    return DecodeImageBatch(buffers, images, statuses, options);
+}
+
+ErrorCode DecodeImageBase64(const char* text, size_t length, Image& image)
+{
+    // the decoded bytes only live until the image is decoded, every thread keeps a buffer of usual size between calls
+    thread_local std::vector<uint8_t> encoded;
+    ErrorCode ret = Base64Decode(text, length, encoded);
+    if (ret != SUCCESS) {
+        LogError << "Decode image from base64 failed, the text is not valid base64." << GetErrorInfo(ret);
+    } else {
+        ret = DecodeImageFrom(ImageBuffer{encoded.data(), encoded.size()}, ImageDecodeOptions{}, image);
+        if (ret != SUCCESS) {
+            LogError << "Decode image from base64 failed. Refer to the above log for detailed error information."
+                     << GetErrorInfo(ret);
+        }
+    }
+    if (encoded.capacity() > BASE64_KEEP_BYTES) {
+        // one huge image must not pin its size on every pool thread that ever decoded it
+        std::vector<uint8_t>().swap(encoded);
+    }
+    return ret;
+}
+
+ErrorCode EncodeJpegs(const std::vector<Image>& images, std::vector<std::vector<uint8_t>>& encoded,
+                      std::vector<ErrorCode>& statuses, int quality)
+{
+    encoded.assign(images.size(), std::vector<uint8_t>());
+    statuses.assign(images.size(), SUCCESS);
+    std::atomic<size_t> next(0);
+    size_t taskNum = std::min(images.size(), MAX_ENCODE_TASK_NUM);
+    std::vector<std::future<void>> futures;
+    try {
+        for (size_t task = 0; task < taskNum; ++task) {
+            futures.push_back(ThreadPool::GetInstance().Submit([&next, &images, &encoded, &statuses, quality]() {
+                for (size_t i = next.fetch_add(1); i < images.size(); i = next.fetch_add(1)) {
+                    statuses[i] = images[i].EncodeJpeg(encoded[i], quality);
+                }
+            }));
+        }
+        ThreadPool::GetInstance().WaitAll(futures);
+    } catch (const std::exception& e) {
+        for (auto& future : futures) {
+            if (future.valid()) {
+                future.wait();
+            }
+        }
+        LogError << "Encode images failed, error: " << e.what() << GetErrorInfo(ERR_INVALID_THREAD_POOL_STATUST);
+        return ERR_INVALID_THREAD_POOL_STATUST;
+    }
+    for (size_t i = 0; i < statuses.size(); ++i) {
+        if (statuses[i] != SUCCESS) {
+            LogError << "Encode image " << i << " of the batch failed." << GetErrorInfo(statuses[i]);
+            return statuses[i];
+        }
+    }
+    return SUCCESS;
+}
+} // namespace Acc
@@ -21,12 +21,21 @@
  */
 
 #include "acc/image/ImageOps.h"
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include "acc/tensor/TensorOps.h"
 #include "acc/utils/LogImpl.h"
 #include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/ImageUtils.h"
+#include "acc/utils/ThreadPool.h"
+#include "acc/utils/BufferPoolImpl.h"
+#include "acc/core/framework/YuvRgbResizer.h"
 namespace Acc {
 namespace {
+constexpr size_t RGB_CHANNELS = 3;
+constexpr size_t YUV_RESIZE_THREAD_NUMS = 16;
+
 std::string ImageFormatToString(ImageFormat fmt)
 {
     switch (fmt) {
@@ -40,10 +49,67 @@ std::string ImageFormatToString(ImageFormat fmt)
             return "RGB_PLANAR";
         case ImageFormat::BGR_PLANAR:
             return "BGR_PLANAR";
+        case ImageFormat::NV12:
+            return "NV12";
+        case ImageFormat::YUV420P:
+            return "YUV420P";
         default:
             return "UNKNOWN(" + std::to_string(static_cast<int>(fmt)) + ")";
     }
 }
+
+ErrorCode CheckYuvResizeParams(const Image& src, size_t resizeW, size_t resizeH, Interpolation interpolation,
+                               DeviceMode deviceMode)
+{
+    if (src.Format() != ImageFormat::NV12 && src.Format() != ImageFormat::YUV420P) {
+        LogError << "Current format is " << ImageFormatToString(src.Format()) << ", but should be NV12 or YUV420P."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (deviceMode != DeviceMode::CPU) {
+        LogError << "Unsupported device mode, only support CPU mode." << GetErrorInfo(ERR_UNSUPPORTED_TYPE);
+        return ERR_UNSUPPORTED_TYPE;
+    }
+    if (interpolation != Interpolation::BICUBIC) {
+        LogError << "Unsupported interpolation algorithm, only support BICUBIC." << GetErrorInfo(ERR_UNSUPPORTED_TYPE);
+        return ERR_UNSUPPORTED_TYPE;
+    }
+    if (CheckImSize({resizeW, resizeH}) != SUCCESS) {
+        return ERR_INVALID_PARAM;
+    }
+    return SUCCESS;
+}
+
+// Split the output rows into bands, each task streams its band through its own row rings
+template <typename Fn>
+ErrorCode RunOnRowBands(size_t dstHeight, Fn fn)
+{
+    size_t rowsPerTask = dstHeight / YUV_RESIZE_THREAD_NUMS;
+    size_t extraRows = dstHeight % YUV_RESIZE_THREAD_NUMS;
+    std::vector<std::future<void>> futures;
+    try {
+        auto& instance = ThreadPool::GetInstance();
+        size_t startRow = 0;
+        for (size_t t = 0; t < YUV_RESIZE_THREAD_NUMS; ++t) {
+            size_t endRow = startRow + rowsPerTask + (t < extraRows ? 1 : 0);
+            if (endRow > startRow) {
+                futures.push_back(instance.Submit([fn, startRow, endRow]() { fn(startRow, endRow); }));
+            }
+            startRow = endRow;
+        }
+        instance.WaitAll(futures);
+    } catch (const std::exception& e) {
+        for (auto& future : futures) {
+            if (future.valid()) {
+                future.wait();
+            }
+        }
+        LogError << "There is a problem with the thread pool used in yuv to rgb resize."
+                 << GetErrorInfo(ERR_INVALID_THREAD_POOL_STATUST);
+        return ERR_INVALID_THREAD_POOL_STATUST;
+    }
+    return SUCCESS;
+}
 } // namespace
 
 ErrorCode ImageResize(const Image& src, Image& dst, size_t resizeW, size_t resizeH, Interpolation interpolation,
@@ -63,6 +129,47 @@ ErrorCode ImageResize(const Image& src, Image& dst, size_t resizeW, size_t resiz
     return ret;
 }
 
+ErrorCode ImageDecodeResize(const char* path, Image& dst, size_t resizeW, size_t resizeH,
+                            Interpolation interpolation, DeviceMode deviceMode)
+{
+    if (deviceMode != DeviceMode::CPU) {
+        LogError << "Unsupported device mode, only support CPU mode." << GetErrorInfo(ERR_UNSUPPORTED_TYPE);
+        return ERR_UNSUPPORTED_TYPE;
+    }
+    if (interpolation != Interpolation::BICUBIC) {
+        LogError << "Unsupported interpolation algorithm, only support BICUBIC." << GetErrorInfo(ERR_UNSUPPORTED_TYPE);
+        return ERR_UNSUPPORTED_TYPE;
+    }
+    auto ret = CheckImSize({resizeW, resizeH});
+    if (ret != SUCCESS) {
+        return ERR_INVALID_PARAM;
+    }
+    std::shared_ptr<unsigned char[]> decoded;
+    ret = ReadImageResized(path, resizeW, resizeH, decoded);
+    if (ret != SUCCESS) {
+        LogError << "ReadImageResized failed. Refer to the above log for detailed error information."
+                 << GetErrorInfo(ret);
+        return ret;
+    }
+    std::shared_ptr<void> decodedRgbData(decoded.get(), [decoded](void*) mutable { decoded.reset(); });
+    dst = Image(decodedRgbData, {resizeW, resizeH}, ImageFormat::RGB);
+    return SUCCESS;
+}
+
+ErrorCode ImageDecodeCrop(const char* path, Image& dst, uint32_t top, uint32_t left, uint32_t height, uint32_t width)
+{
+    std::shared_ptr<unsigned char[]> decoded;
+    auto ret = ReadJpegRegion(path, top, left, height, width, decoded);
+    if (ret != SUCCESS) {
+        LogError << "ReadJpegRegion failed. Refer to the above log for detailed error information."
+                 << GetErrorInfo(ret);
+        return ret;
+    }
+    std::shared_ptr<void> decodedRgbData(decoded.get(), [decoded](void*) mutable { decoded.reset(); });
+    dst = Image(decodedRgbData, {width, height}, ImageFormat::RGB);
+    return SUCCESS;
+}
+
 ErrorCode ImageCrop(const Image& src, Image& dst, uint32_t top, uint32_t left, uint32_t height, uint32_t width,
                     DeviceMode deviceMode)
 {
@@ -79,4 +186,74 @@ ErrorCode ImageCrop(const Image& src, Image& dst, uint32_t top, uint32_t left, u
     }
     return ret;
 }
-} // namespace Acc
\ No newline at end of file
+
+ErrorCode ImageYuvToRgbResize(const Image& src, Image& dst, size_t resizeW, size_t resizeH,
+                              Interpolation interpolation, DeviceMode deviceMode)
+{
+    auto ret = CheckYuvResizeParams(src, resizeW, resizeH, interpolation, deviceMode);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    size_t totalBytes = resizeW * resizeH * RGB_CHANNELS;
+    std::shared_ptr<void> dstPtr;
+    if (AllocateBuffer(totalBytes, dstPtr) != SUCCESS) {
+        LogError << "Failed to malloc for yuv to rgb resize output." << GetErrorInfo(ERR_BAD_ALLOC);
+        return ERR_BAD_ALLOC;
+    }
+    auto* data = static_cast<uint8_t*>(dstPtr.get());
+    YuvRgbResizer resizer(src.Format(), src.Width(), src.Height(), resizeW, resizeH);
+    const auto* srcPtr = static_cast<const uint8_t*>(src.Ptr());
+    ret = RunOnRowBands(resizeH, [&resizer, srcPtr, data](size_t startRow, size_t endRow) {
+        resizer.Run(srcPtr, startRow, endRow, data);
+    });
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    dst = Image(dstPtr, {resizeW, resizeH}, ImageFormat::RGB, DataType::UINT8);
+    return SUCCESS;
+}
+
+ErrorCode ImageYuvToRgbResizeNormalize(const Image& src, Tensor& dst, size_t resizeW, size_t resizeH,
+                                       const std::vector<float>& mean, const std::vector<float>& std,
+                                       TensorFormat format, DeviceMode deviceMode)
+{
+    auto ret = CheckYuvResizeParams(src, resizeW, resizeH, Interpolation::BICUBIC, deviceMode);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    if (format != TensorFormat::NCHW && format != TensorFormat::NHWC) {
+        LogError << "Unsupported tensor format, only support NCHW or NHWC." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (mean.size() != RGB_CHANNELS || std.size() != RGB_CHANNELS) {
+        LogError << "The size of mean and std must be 3." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    for (float value : std) {
+        if (std::fabs(value) < std::numeric_limits<float>::epsilon()) {
+            LogError << "The value of std must not be 0." << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+    }
+    size_t totalNums = resizeW * resizeH * RGB_CHANNELS;
+    std::shared_ptr<void> dstPtr;
+    if (AllocateBuffer(totalNums * sizeof(float), dstPtr) != SUCCESS) {
+        LogError << "Failed to malloc for yuv to rgb resize output." << GetErrorInfo(ERR_BAD_ALLOC);
+        return ERR_BAD_ALLOC;
+    }
+    auto* data = static_cast<float*>(dstPtr.get());
+    bool planar = format == TensorFormat::NCHW;
+    YuvRgbResizer resizer(src.Format(), src.Width(), src.Height(), resizeW, resizeH);
+    const auto* srcPtr = static_cast<const uint8_t*>(src.Ptr());
+    ret = RunOnRowBands(resizeH, [&resizer, &mean, &std, srcPtr, planar, data](size_t startRow, size_t endRow) {
+        resizer.RunNormalize(srcPtr, startRow, endRow, mean, std, planar, data);
+    });
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    std::vector<size_t> shape = planar ? std::vector<size_t>{1, RGB_CHANNELS, resizeH, resizeW}
+                                       : std::vector<size_t>{1, resizeH, resizeW, RGB_CHANNELS};
+    dst = Tensor(dstPtr, shape, DataType::FLOAT32, format, "cpu");
+    return SUCCESS;
+}
+} // namespace Acc
@@ -0,0 +1,88 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: Row streaming bicubic resize on cpu.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#ifndef BICUBIC_ROW_RESIZER_H
+#define BICUBIC_ROW_RESIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Acc {
+/**
+ * @brief Separable bicubic resize of packed uint8 rows for producers that deliver the source row by row.
+ * @details Rows hold channels interleaved values per pixel, 3 for RGB, 1 for a single plane and 2 for the
+ *          interleaved UV plane of NV12. Same coefficients and fixed point rounding as the CPU Resize operator, the result is bit exact.
+ *          Every source row goes through HorizontalPass once, VerticalPass then combines the horizontally
+ *          resized rows [FirstSrcRow(y), FirstSrcRow(y) + NumSrcRows(y)) into output row y. The rows needed by
+ *          consecutive output rows only move forward, so a ring of MaxSrcRows() rows is enough.
+ */
+class BicubicRowResizer {
+public:
+    BicubicRowResizer(size_t srcWidth, size_t srcHeight, size_t dstWidth, size_t dstHeight, size_t channels = 3);
+
+    size_t FirstSrcRow(size_t dstRow) const
+    {
+        return static_cast<size_t>(boundsVert_[dstRow * BOUNDS_STRIDE]);
+    }
+
+    size_t NumSrcRows(size_t dstRow) const
+    {
+        return static_cast<size_t>(boundsVert_[dstRow * BOUNDS_STRIDE + 1]);
+    }
+
+    size_t MaxSrcRows() const
+    {
+        return kernelSizeH_;
+    }
+
+    /**
+     * @brief Bytes of one horizontally resized row, the size of every ring entry.
+     */
+    size_t RowBytes() const
+    {
+        return dstWidth_ * channels_;
+    }
+
+    /**
+     * @brief Resize one source row of srcWidth pixels to dstWidth pixels.
+     */
+    void HorizontalPass(const uint8_t* srcRow, uint8_t* dstRow) const;
+
+    /**
+     * @brief Write output row dstRow from rows[i], the horizontally resized source row FirstSrcRow(dstRow) + i.
+     */
+    void VerticalPass(const uint8_t* const* rows, size_t dstRow, uint8_t* dstPtr) const;
+
+private:
+    static constexpr size_t BOUNDS_STRIDE = 2;
+    size_t dstWidth_;
+    size_t channels_;
+    size_t kernelSizeH_ = 0;
+    size_t kernelSizeW_ = 0;
+    std::vector<int> boundsHoriz_;
+    std::vector<int> boundsVert_;
+    std::vector<long> coeHoriz_;
+    std::vector<long> coeVert_;
+};
+} // namespace Acc
+
+#endif // BICUBIC_ROW_RESIZER_H
@@ -71,6 +71,26 @@ private:
      * @return ErrorCode
      */
     static ErrorCode QwenFusionOperator(QwenFusionContext& opCtx);
+
+    /**
+     * @brief Core InternVL2 dynamic tiling operator using InternVL2FusionContext
+     *
+     * Resizes the input once to the tile grid, then writes every normalized tile and the optional
+     * thumbnail into one contiguous NCHW float tensor
+     * @param opCtx InternVL2FusionContext, reference OperatorContext.h
+     * @return ErrorCode
+     */
+    static ErrorCode InternVL2FusionOperator(InternVL2FusionContext& opCtx);
+
+    /**
+     * @brief Core CLIP preprocess operator using ClipFusionContext
+     *
+     * Resizes every input by its shortest side, then writes the normalized center crop of each of them
+     * into one contiguous NCHW float tensor
+     * @param opCtx ClipFusionContext, reference OperatorContext.h
+     * @return ErrorCode
+     */
+    static ErrorCode ClipFusionOperator(ClipFusionContext& opCtx);
     /**
      * @brief CPU-based image ToTensor implementation
      * @details  Converts input data to tensor format, equivalent to torchvision.transforms.ToTensor
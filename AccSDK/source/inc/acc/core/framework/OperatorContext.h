@@ -22,6 +22,7 @@
 #ifndef OPERATOR_CONTEXT_H
 #define OPERATOR_CONTEXT_H
 
+#include <utility>
 #include <vector>
 
 #include "acc/tensor/Tensor.h"
@@ -90,6 +91,7 @@ namespace Acc {
         std::vector<float> mean;
         std::vector<float> stddev;
         DeviceMode deviceMode;
+        DataType outputType = DataType::FLOAT32; // FLOAT32, FLOAT16 or BFLOAT16
         NormalizeContext(const std::vector<std::reference_wrapper<const Tensor>>& inputTensorRefs,
                          const std::vector<std::reference_wrapper<Tensor>>& outputTensorRefs,
                          const std::vector<float> mean, const std::vector<float> stddev, DeviceMode deviceMode)
@@ -105,6 +107,13 @@ namespace Acc {
         int resizeW;               // Target width for resize
         TensorFormat layout;       // Tensor layout format (e.g., NHWC)
         DeviceMode deviceMode;     // Device mode (CPU/NPU/GPU etc.)
+        bool flattenPatches = false;   // Output flattened Qwen2-VL patches instead of NHWC images
+        int patchSize = 14;            // Spatial patch size, used when flattenPatches is set
+        int temporalPatchSize = 2;     // Temporal patch size, used when flattenPatches is set
+        int mergeSize = 2;             // Spatial merge size, used when flattenPatches is set
+        std::vector<std::pair<int, int>> resizeSizes; // Per-input (height, width), empty means resizeH/resizeW for all
+        DataType outputType = DataType::FLOAT32;       // FLOAT32, FLOAT16 or BFLOAT16
+        bool mergeFrames = false; // Inputs are the frames of one video, patched into the single output
 
         QwenFusionContext(const std::vector<std::reference_wrapper<const Tensor>>& inputTensorRefs,
                           const std::vector<std::reference_wrapper<Tensor>>& outputTensorRefs,
@@ -123,11 +132,124 @@ namespace Acc {
               deviceMode(deviceMode)
         {
         }
+
+        /**
+         * @brief Target height of the input at index
+         */
+        int ResizeHOf(size_t index) const
+        {
+            return resizeSizes.empty() ? resizeH : resizeSizes[index].first;
+        }
+
+        /**
+         * @brief Target width of the input at index
+         */
+        int ResizeWOf(size_t index) const
+        {
+            return resizeSizes.empty() ? resizeW : resizeSizes[index].second;
+        }
+
+        /**
+         * @brief Number of rows of the flattened patch matrix produced for the input at index
+         */
+        size_t NumPatches(size_t index = 0) const
+        {
+            return static_cast<size_t>(ResizeHOf(index) / patchSize) *
+                   static_cast<size_t>(ResizeWOf(index) / patchSize);
+        }
+    };
+
+    struct InternVL2FusionContext : OperatorContext {
+        std::vector<float> mean;   // Mean values for normalization
+        std::vector<float> std;    // Std values for normalization
+        int inputSize;             // Side length of each square tile
+        int gridW;                 // Number of tiles along the width of the resized image
+        int gridH;                 // Number of tiles along the height of the resized image
+        bool useThumbnail;         // Whether a thumbnail tile is appended when there is more than one tile
+        DeviceMode deviceMode;     // Device mode (CPU/NPU/GPU etc.)
+
+        InternVL2FusionContext(const std::vector<std::reference_wrapper<const Tensor>>& inputTensorRefs,
+                               const std::vector<std::reference_wrapper<Tensor>>& outputTensorRefs,
+                               const std::vector<float>& mean,
+                               const std::vector<float>& std,
+                               int inputSize,
+                               int gridW,
+                               int gridH,
+                               bool useThumbnail,
+                               DeviceMode deviceMode)
+            : OperatorContext(inputTensorRefs, outputTensorRefs),
+              mean(mean),
+              std(std),
+              inputSize(inputSize),
+              gridW(gridW),
+              gridH(gridH),
+              useThumbnail(useThumbnail),
+              deviceMode(deviceMode)
+        {
+        }
+
+        /**
+         * @brief Number of tiles written to the output, including the optional thumbnail
+         */
+        size_t NumTiles() const
+        {
+            size_t blocks = static_cast<size_t>(gridW) * static_cast<size_t>(gridH);
+            return (useThumbnail && blocks != 1) ? blocks + 1 : blocks;
+        }
+    };
+
+    struct ClipFusionContext : OperatorContext {
+        std::vector<float> mean;   // Mean values for normalization
+        std::vector<float> std;    // Std values for normalization
+        int shortestEdge;          // Target length of the shortest side of the resized image
+        int cropH;                 // Height of the center crop
+        int cropW;                 // Width of the center crop
+        int resizeH = 0;           // When > 0 with resizeW, the input is treated as stretched to this size first
+        int resizeW = 0;           // When > 0 with resizeH, the input is treated as stretched to this size first
+        DeviceMode deviceMode;     // Device mode (CPU/NPU/GPU etc.)
+
+        ClipFusionContext(const std::vector<std::reference_wrapper<const Tensor>>& inputTensorRefs,
+                          const std::vector<std::reference_wrapper<Tensor>>& outputTensorRefs,
+                          const std::vector<float>& mean,
+                          const std::vector<float>& std,
+                          int shortestEdge,
+                          int cropH,
+                          int cropW,
+                          DeviceMode deviceMode)
+            : OperatorContext(inputTensorRefs, outputTensorRefs),
+              mean(mean),
+              std(std),
+              shortestEdge(shortestEdge),
+              cropH(cropH),
+              cropW(cropW),
+              deviceMode(deviceMode)
+        {
+        }
+
+        /**
+         * @brief Size (height, width) of the input at index after the shortest side resize
+         */
+        std::pair<size_t, size_t> ResizedSizeOf(size_t index) const
+        {
+            size_t height = inputTensorRefs[index].get().Shape()[1];
+            size_t width = inputTensorRefs[index].get().Shape()[2];
+            if (resizeH > 0 && resizeW > 0) {
+                height = static_cast<size_t>(resizeH);
+                width = static_cast<size_t>(resizeW);
+            }
+            size_t edge = static_cast<size_t>(shortestEdge);
+            // same as transformers: the long side is truncated, not rounded
+            if (height <= width) {
+                return {edge, edge * width / height};
+            }
+            return {edge * height / width, edge};
+        }
     };
 
     struct ToTensorContext : OperatorContext {
         TensorFormat format; // target convert format
         DeviceMode deviceMode;
+        DataType outputType = DataType::FLOAT32; // FLOAT32, FLOAT16 or BFLOAT16
         ToTensorContext(const std::vector<std::reference_wrapper<const Tensor>>& inputTensorRefs,
                         const std::vector<std::reference_wrapper<Tensor>>& outputTensorRefs,
                         TensorFormat format, DeviceMode deviceMode)
@@ -37,6 +37,8 @@ namespace Acc {
         TOTENSOR,       // Image ToTensor operator - equivalent to torchvision.transforms.ToTensor
         NORMALIZE,      // Tensor normalization operator - scales pixel values to specified range
         QWENFUSION,     // QwenFusion operator - preprocess operation for Qwen2VL
+        INTERNVL2FUSION, // InternVL2Fusion operator - dynamic tiling preprocess operation for InternVL2
+        CLIPFUSION,     // ClipFusion operator - batched preprocess operation for CLIP image encoders
         OTHER,
     };
 }
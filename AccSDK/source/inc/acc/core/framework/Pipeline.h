@@ -66,7 +66,19 @@ public:
      */
     ErrorCode Run(const std::unordered_map<std::string, std::vector<Tensor>> &inputs, Tensor &output, bool copy);
 
+    /**
+     * @brief Run the pipeline and write the result into the memory of a preallocated output
+     *
+     * @param inputs The input operator name and corresponding input tensor of pipeline
+     * @param output The output tensor, its shape and data type must match the result of the pipeline
+     * @param copy The pipeline copies the input or not, i.e., whether the memory is shared
+     */
+    ErrorCode RunInto(const std::unordered_map<std::string, std::vector<Tensor>> &inputs, Tensor &output, bool copy);
+
 private:
+    ErrorCode Execute(const std::unordered_map<std::string, std::vector<Tensor>> &inputs, Tensor &output, bool copy,
+                      bool intoOutput);
+
     std::shared_ptr<acclib::accdata::AccDataPipeline> pipeline_;
 };
 } // namespace Acc
@@ -0,0 +1,69 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: Fused yuv420 to RGB conversion and bicubic resize on cpu.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#ifndef YUV_RGB_RESIZER_H
+#define YUV_RGB_RESIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "acc/image/ImageFormat.h"
+#include "acc/core/framework/BicubicRowResizer.h"
+
+namespace Acc {
+/**
+ * @brief Convert a NV12 or YUV420P image to RGB and bicubic resize it in a single pass.
+ * @details Luma and chroma planes are resized separately, chroma straight from half resolution to the output
+ *          size, and the BT.601 limited range conversion then runs on output pixels only. The full resolution
+ *          RGB image is never produced. Each call keeps its own row rings, so disjoint row ranges of one output
+ *          may run concurrently on the same instance.
+ */
+class YuvRgbResizer {
+public:
+    YuvRgbResizer(ImageFormat format, size_t srcWidth, size_t srcHeight, size_t dstWidth, size_t dstHeight);
+
+    /**
+     * @brief Write output rows [startRow, endRow) as packed RGB, dst points to output row 0.
+     */
+    void Run(const uint8_t* src, size_t startRow, size_t endRow, uint8_t* dst) const;
+
+    /**
+     * @brief Write output rows [startRow, endRow) as float (rgb / 255 - mean) / std, in NCHW when planar is set
+     *        and NHWC otherwise. dst points to the start of the output tensor.
+     */
+    void RunNormalize(const uint8_t* src, size_t startRow, size_t endRow, const std::vector<float>& mean,
+                      const std::vector<float>& std, bool planar, float* dst) const;
+
+private:
+    template <typename Sink>
+    void ForEachRow(const uint8_t* src, size_t startRow, size_t endRow, Sink&& sink) const;
+
+    ImageFormat format_;
+    size_t srcWidth_;
+    size_t srcHeight_;
+    size_t dstWidth_;
+    size_t dstHeight_;
+    BicubicRowResizer lumaResizer_;
+    BicubicRowResizer chromaResizer_;
+};
+} // namespace Acc
+
+#endif // YUV_RGB_RESIZER_H
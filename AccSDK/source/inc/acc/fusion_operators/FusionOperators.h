@@ -21,6 +21,7 @@
  */
 #ifndef FUSION_OPERATOR_H
 #define FUSION_OPERATOR_H
+#include <utility>
 #include <vector>
 #include "acc/image/Image.h"
 #include "acc/ErrorCode.h"
@@ -31,27 +32,195 @@ namespace Acc {
 /**
  * @brief Preprocessing configuration for QwenFusion
  *
- * Contains parameters for image normalization and resizing.
+ * Contains parameters for image normalization and resizing. The target size of every image is taken from
+ * resizeSizes when it is set, otherwise from resizeH and resizeW, and when both of them are left 0 it is
+ * computed per image by the Qwen2-VL smart resize from minPixels and maxPixels.
  */
 struct QwenPreprocessConfig {
     std::vector<float> mean;
     std::vector<float> std;
     int resizeW = 0;
     int resizeH = 0;
+    bool flattenPatches = false; // Emit Qwen2-VL flattened patches instead of NHWC images
+    int patchSize = 14;
+    int temporalPatchSize = 2;
+    int mergeSize = 2;
+    std::vector<std::pair<int, int>> resizeSizes{}; // Per-image (resizeH, resizeW), one entry per image
+    int minPixels = 56 * 56;
+    int maxPixels = 28 * 28 * 1280;
+    DataType outputType = DataType::FLOAT32; // FLOAT32, FLOAT16 or BFLOAT16
+};
+
+/**
+ * @brief Preprocessing configuration for InternVL2 dynamic tiling
+ *
+ * Contains parameters for image normalization and the tile grid search.
+ */
+struct InternVL2PreprocessConfig {
+    std::vector<float> mean;
+    std::vector<float> std;
+    int inputSize = 448;
+    int minNum = 1;
+    int maxNum = 12;
+    bool useThumbnail = true;
+};
+
+/**
+ * @brief Preprocessing configuration for CLIP image encoders
+ *
+ * Same steps as the transformers CLIPImageProcessor: shortest side resize, center crop and normalization,
+ * the defaults are the ones of openai/clip-vit-base-patch32.
+ */
+struct ClipPreprocessConfig {
+    std::vector<float> mean = {0.48145466f, 0.4578275f, 0.40821073f};
+    std::vector<float> std = {0.26862954f, 0.26130258f, 0.27577711f};
+    int shortestEdge = 224;
+    int cropW = 224;
+    int cropH = 224;
+    int resizeW = 0; // When resizeW and resizeH are > 0, the image is treated as stretched to this size first
+    int resizeH = 0;
 };
 
 class FusionOperator {
 public:
+    /**
+     * @brief Compute the Qwen2-VL smart resize target of one image
+     *
+     * Both sides are rounded to multiples of patchSize * mergeSize while the area is kept within
+     * [minPixels, maxPixels] and the aspect ratio is preserved as closely as possible.
+     *
+     * @param height Height of the image
+     * @param width Width of the image
+     * @param config Preprocessing parameters, patchSize, mergeSize, minPixels and maxPixels are used
+     * @param resizeH Output target height
+     * @param resizeW Output target width
+     * @return ErrorCode Returns SUCCESS if successful, otherwise returns a specific error code
+     */
+    static ErrorCode Qwen2VLSmartResize(size_t height, size_t width, const QwenPreprocessConfig& config,
+                                        int& resizeH, int& resizeW);
+
+    /**
+     * @brief Resolve the target size of every image, see QwenPreprocessConfig for the priority of the sources
+     *
+     * @param images List of input images
+     * @param config Preprocessing parameters, resizeSizes, resizeW, resizeH, patch sizes and pixel limits are used
+     * @param sizes Output per-image (resizeH, resizeW), left empty when every image uses config.resizeH and
+     *        config.resizeW
+     * @return ErrorCode Returns SUCCESS if successful, otherwise returns a specific error code
+     */
+    static ErrorCode Qwen2VLResolveResizeSizes(const std::vector<std::shared_ptr<Image>>& images,
+                                               const QwenPreprocessConfig& config,
+                                               std::vector<std::pair<int, int>>& sizes);
+
+    /**
+     * @brief Estimate the Qwen2-VL grid and visual token count of an image or video from its size only
+     *
+     * Uses the same target size rules as Qwen2VLImagePreprocess, so a scheduler can budget tokens from
+     * probed headers before anything is decoded.
+     *
+     * @param height Height of the image or video frames
+     * @param width Width of the image or video frames
+     * @param numFrames 1 for an image, the number of sampled frames for a video
+     * @param config Preprocessing parameters, resizeW, resizeH, patch sizes, minPixels and maxPixels are used
+     * @param gridThw Output (grid_t, grid_h, grid_w)
+     * @param numTokens Output number of tokens after the spatial merge
+     * @return ErrorCode Returns SUCCESS if successful, otherwise returns a specific error code
+     */
+    static ErrorCode Qwen2VLEstimateTokens(size_t height, size_t width, size_t numFrames,
+                                           const QwenPreprocessConfig& config, std::vector<size_t>& gridThw,
+                                           size_t& numTokens);
+
+    /**
+     * @brief Estimate the InternVL2 tile count and visual token count of an image from its size only
+     *
+     * @param height Height of the image
+     * @param width Width of the image
+     * @param config Preprocessing parameters, inputSize, minNum, maxNum and useThumbnail are used
+     * @param tokensPerTile Number of tokens produced by the vision encoder for one tile
+     * @param numTiles Output number of tiles including the thumbnail
+     * @param numTokens Output number of tokens
+     * @return ErrorCode Returns SUCCESS if successful, otherwise returns a specific error code
+     */
+    static ErrorCode InternVL2EstimateTokens(size_t height, size_t width, const InternVL2PreprocessConfig& config,
+                                             size_t tokensPerTile, size_t& numTiles, size_t& numTokens);
+
     /**
      * @brief Preprocess input images with Resize + ToTensor + Normalize
      *
+     * Images may have different target sizes, they are scheduled concurrently with large images split
+     * across several threads and small images packed together on one thread.
+     *
      * @param images List of input images (RGB, 3 channels)
      * @param config Preprocessing parameters including mean, std, resizeW, resizeH, layout
-     * @param outputTensors Output tensor list, float32 type, layout current is only NHWC
+     * @param outputTensors Output tensor list, float32 type, layout current is only NHWC. When
+     *        config.flattenPatches is set, each output is the Qwen2-VL patch matrix with shape
+     *        (resizeH / patchSize * resizeW / patchSize, 3 * temporalPatchSize * patchSize * patchSize),
+     *        where resizeH and resizeW are the target size of that image
      * @return ErrorCode Returns SUCCESS if successful, otherwise returns a specific error code
      */
     static ErrorCode Qwen2VLImagePreprocess(const std::vector<std::shared_ptr<Image>>& images,
                                             const QwenPreprocessConfig& config, std::vector<Tensor>& outputTensors);
+
+    /**
+     * @brief Preprocess input images into one Qwen2-VL patch matrix
+     *
+     * The matrix is sized once from the patch count of every image and each image's patches are written at
+     * its row offset, so no per-image tensors are concatenated afterwards.
+     *
+     * @param images List of input images (RGB, 3 channels)
+     * @param config Preprocessing parameters, flattenPatches is implied
+     * @param pixelValues Output tensor with shape (sum of gridH * gridW, 3 * temporalPatchSize * patchSize *
+     *        patchSize), images follow each other in input order
+     * @param gridThw Output (1, gridH, gridW) of every image, 3 entries per image
+     * @return ErrorCode Returns SUCCESS if successful, otherwise returns a specific error code
+     */
+    static ErrorCode Qwen2VLImagePatches(const std::vector<std::shared_ptr<Image>>& images,
+                                         const QwenPreprocessConfig& config, Tensor& pixelValues,
+                                         std::vector<size_t>& gridThw);
+
+    /**
+     * @brief Preprocess one image with InternVL2 dynamic tiling
+     *
+     * Picks the closest tile grid for the image aspect ratio, resizes once, then writes every normalized
+     * tile followed by the optional thumbnail into a single tensor.
+     *
+     * @param image Input image (RGB, 3 channels)
+     * @param config Preprocessing parameters including mean, std, inputSize, minNum, maxNum, useThumbnail
+     * @param outputTensor Output tensor, float32 type, NCHW layout with shape (numTiles, 3, inputSize, inputSize)
+     * @return ErrorCode Returns SUCCESS if successful, otherwise returns a specific error code
+     */
+    static ErrorCode InternVL2ImagePreprocess(const std::shared_ptr<Image>& image,
+                                              const InternVL2PreprocessConfig& config, Tensor& outputTensor);
+
+    /**
+     * @brief Preprocess a batch of images for a CLIP image encoder
+     *
+     * Every image is resized so that its shortest side is shortestEdge, then the center crop is normalized
+     * with mean and std straight into the output. All images are handled in one call, so the frames of a
+     * whole video can be preprocessed at once.
+     *
+     * @param images Input images (RGB, 3 channels), may have different sizes
+     * @param config Preprocessing parameters including mean, std, shortestEdge, cropW, cropH
+     * @param outputTensor Output tensor, float32 type, NCHW layout with shape (numImages, 3, cropH, cropW)
+     * @return ErrorCode Returns SUCCESS if successful, otherwise returns a specific error code
+     */
+    static ErrorCode ClipImagePreprocess(const std::vector<std::shared_ptr<Image>>& images,
+                                         const ClipPreprocessConfig& config, Tensor& outputTensor);
+
+    /**
+     * @brief Preprocess all frames of one video into Qwen2-VL flattened patches in a single run
+     *
+     * Every temporalPatchSize consecutive frames are merged into one temporal group, the last frame is
+     * repeated when the number of frames is not a multiple of temporalPatchSize.
+     *
+     * @param frames Input frames (RGB, 3 channels), all of the same size
+     * @param config Preprocessing parameters, flattenPatches is implied
+     * @param outputTensor Output tensor, float32 type, with shape
+     *        (ceil(numFrames / temporalPatchSize) * gridH * gridW, 3 * temporalPatchSize * patchSize * patchSize)
+     * @return ErrorCode Returns SUCCESS if successful, otherwise returns a specific error code
+     */
+    static ErrorCode Qwen2VLVideoPreprocess(const std::vector<std::shared_ptr<Image>>& frames,
+                                            const QwenPreprocessConfig& config, Tensor& outputTensor);
 };
 
 } // namespace Acc
@@ -65,6 +65,28 @@ class QwenFusionChecker : public OpsBaseChecker {
 public:
     explicit QwenFusionChecker(const OperatorId& opId) : OpsBaseChecker(opId) {}
 
+protected:
+    ErrorCode CheckCustomRules(const OperatorContext& ctx) override;
+    ErrorCode ImplicitMalloc(const OperatorContext& ctx) override;
+
+private:
+    ErrorCode CheckQwenPatchRules(const QwenFusionContext& qwenCtx);
+    ErrorCode CheckQwenPatchOutputs(const QwenFusionContext& qwenCtx);
+};
+
+class ClipFusionChecker : public OpsBaseChecker {
+public:
+    explicit ClipFusionChecker(const OperatorId& opId) : OpsBaseChecker(opId) {}
+
+protected:
+    ErrorCode CheckCustomRules(const OperatorContext& ctx) override;
+    ErrorCode ImplicitMalloc(const OperatorContext& ctx) override;
+};
+
+class InternVL2FusionChecker : public OpsBaseChecker {
+public:
+    explicit InternVL2FusionChecker(const OperatorId& opId) : OpsBaseChecker(opId) {}
+
 protected:
     ErrorCode CheckCustomRules(const OperatorContext& ctx) override;
     ErrorCode ImplicitMalloc(const OperatorContext& ctx) override;
@@ -22,9 +22,11 @@
 #ifndef AUDIO_UTILS_H
 #define AUDIO_UTILS_H
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <optional>
 #include "acc/ErrorCode.h"
+#include "acc/utils/FileUtils.h"
 
 namespace Acc {
 
@@ -44,6 +46,15 @@ struct AudioData {
  */
 ErrorCode CheckSingleAudioInputs(const char* path, std::optional<int> sr = std::nullopt);
 
+/**
+ * @brief Checks validity of in-memory audio input parameters.
+ * @param data Encoded WAV bytes.
+ * @param size Number of bytes.
+ * @param sr Optional target sample rate.
+ * @return ErrorCode
+ */
+ErrorCode CheckAudioBufferInputs(const uint8_t* data, size_t size, std::optional<int> sr = std::nullopt);
+
 /**
  * @brief Mixes interleaved multi-channel audio into mono.
  * @param output Output mono buffer.
@@ -54,6 +65,15 @@ ErrorCode CheckSingleAudioInputs(const char* path, std::optional<int> sr = std::
  */
 ErrorCode MixChannelsInterleaved(float* output, const float* input, size_t numFrames, int numChannels);
 
+/**
+ * @brief Maps a WAV audio file for AudioDecode, the path itself is checked by CheckSingleAudioInputs.
+ * @param filePath Path to the input WAV audio file.
+ * @param file Output mapped file.
+ * @param populate Read the whole file in before returning, see MappedFile::Open.
+ * @return ErrorCode
+ */
+ErrorCode MapAudioFile(const char* filePath, MappedFile& file, bool populate = false);
+
 /**
  * @brief Decodes a WAV audio file and converts the data to floating-point PCM.
  * @param filePath Path to the input WAV audio file.
@@ -61,5 +81,14 @@ ErrorCode MixChannelsInterleaved(float* output, const float* input, size_t numFr
  * @return ErrorCode
  */
 ErrorCode AudioDecode(const char* filePath, AudioData& outputAudioData);
+
+/**
+ * @brief Decodes WAV audio held in memory and converts the data to floating-point PCM.
+ * @param data Encoded WAV bytes.
+ * @param size Number of bytes.
+ * @param outputAudioData Output structure to store the decoded audio data.
+ * @return ErrorCode
+ */
+ErrorCode AudioDecode(const uint8_t* data, size_t size, AudioData& outputAudioData);
 } // namespace Acc
 #endif
\ No newline at end of file
@@ -0,0 +1,43 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+* Description: Internal base64 utils header file.
+* Author: ACC SDK
+* Create: 2025
+* History: NA
+*/
+#ifndef BASE64_UTILS_H
+#define BASE64_UTILS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "acc/ErrorCode.h"
+
+namespace Acc {
+/**
+ * @description: Decode standard base64 text, NEON or AVX2 handle the bulk when the target supports them.
+ * A leading "data:<mime type>;base64," prefix of a data url is skipped. Padding is optional, whitespace and the
+ * url safe alphabet are rejected.
+ * @param text: Input base64 text, not null terminated.
+ * @param length: Input text length in bytes.
+ * @param decoded: Output decoded bytes.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode Base64Decode(const char* text, size_t length, std::vector<uint8_t>& decoded);
+} // namespace Acc
+
+#endif // BASE64_UTILS_H
@@ -0,0 +1,40 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+* Description: Internal buffer pool header file.
+* Author: ACC SDK
+* Create: 2025
+* History: NA
+*/
+#ifndef BUFFER_POOL_IMPL_H
+#define BUFFER_POOL_IMPL_H
+
+#include <memory>
+#include "acc/ErrorCode.h"
+#include "acc/BufferPool.h"
+
+namespace Acc {
+/**
+ * @description: Get a buffer of at least bytes from the buffer pool, it goes back to the pool when the last
+ * reference is released. The content is not initialized.
+ * @param bytes: Number of bytes, must not be 0.
+ * @param buffer: Output buffer.
+ * @return: int, Error code (SUCCESS or ERR_BAD_ALLOC).
+ */
+ErrorCode AllocateBuffer(size_t bytes, std::shared_ptr<void>& buffer);
+} // namespace Acc
+
+#endif // BUFFER_POOL_IMPL_H
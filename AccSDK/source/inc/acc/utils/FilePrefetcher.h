@@ -0,0 +1,104 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+* Description: Internal file prefetcher header file.
+* Author: ACC SDK
+* Create: 2025
+* History: NA
+*/
+#ifndef FILE_PREFETCHER_H
+#define FILE_PREFETCHER_H
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "acc/ErrorCode.h"
+#include "acc/utils/FileUtils.h"
+
+namespace Acc {
+inline constexpr size_t DEFAULT_PREFETCH_BYTES = 256 * 1024 * 1024; // 256MB
+inline constexpr size_t DEFAULT_PREFETCH_THREADS = 8;
+
+/**
+ * @description: Reads the files of a batch ahead on the shared I/O thread pool, so the decode tasks on the SDK thread
+ * pool do not block on cold storage. Files are loaded in path order as memory mappings whose pages are already read in.
+ * At most maxInFlightBytes of loaded files wait to be taken, a file larger than the limit is loaded on its own.
+ * A file no I/O task has picked up yet is loaded by Take on the calling thread instead of waiting for one.
+ */
+class FilePrefetcher {
+public:
+    // Loads one file, runs on an I/O thread, e.g. path checks followed by MappedFile::Open with populate
+    using FileLoader = std::function<ErrorCode(const char* path, MappedFile& file)>;
+
+    // ioThreads bounds the I/O tasks of this batch, the threads themselves belong to ThreadPool::GetIoInstance
+    FilePrefetcher(const std::vector<std::string>& paths, FileLoader loader,
+                   size_t maxInFlightBytes = DEFAULT_PREFETCH_BYTES, size_t ioThreads = DEFAULT_PREFETCH_THREADS);
+    ~FilePrefetcher();
+    FilePrefetcher(const FilePrefetcher&) = delete;
+    FilePrefetcher& operator=(const FilePrefetcher&) = delete;
+
+    /**
+     * @description: Wait until a file is loaded and hand it over, every index can be taken once.
+     * @param index: Index of the file in paths.
+     * @param file: Output mapped file.
+     * @return: int, Error code of the loader.
+     */
+    ErrorCode Take(size_t index, MappedFile& file);
+
+private:
+    struct Item {
+        MappedFile file;
+        ErrorCode status = SUCCESS;
+        size_t reserved = 0;
+        bool claimed = false; // picked up by an I/O task or by Take
+        bool ready = false;
+        bool taken = false;
+    };
+
+    // Budget and ready state of one batch, queued I/O tasks keep it alive after the prefetcher is gone
+    struct State {
+        State(const std::vector<std::string>& filePaths, FileLoader fileLoader, size_t maxBytes)
+            : paths(filePaths), loader(std::move(fileLoader)), maxInFlightBytes(maxBytes), items(filePaths.size())
+        {
+        }
+
+        const std::vector<std::string>& paths; // only used by running tasks, the destructor waits for them
+        FileLoader loader;
+        size_t maxInFlightBytes;
+        std::vector<Item> items;
+        std::mutex mutex;
+        std::condition_variable budgetCond; // wakes I/O tasks when bytes are taken or the reserve turn moves on
+        std::condition_variable readyCond;  // wakes Take when a file is loaded
+        std::condition_variable idleCond;   // wakes the destructor when the last running I/O task returns
+        size_t nextLoad = 0;    // next path an I/O task picks up
+        size_t nextTicket = 0;  // order of the paths picked up by I/O tasks
+        size_t nextReserve = 0; // bytes are reserved in ticket order, so large files are not starved by small ones
+        size_t inFlightBytes = 0;
+        size_t running = 0;
+        bool stop = false;
+    };
+
+    static void IoTask(const std::shared_ptr<State>& state);
+    static void IoLoop(State& state);
+
+    std::shared_ptr<State> state_;
+};
+} // namespace Acc
+
+#endif // FILE_PREFETCHER_H
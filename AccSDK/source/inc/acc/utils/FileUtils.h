@@ -29,6 +29,7 @@
 
 namespace Acc {
 inline constexpr size_t DEFAULT_MAX_FILE_SIZE = 1024 * 1024 * 1024; // 1GB
+inline constexpr size_t MMAP_MIN_FILE_SIZE = 1024 * 1024; // 1MB, smaller files are read, not mapped
 /**
 * @description: Check whether file extension match the target.
 * @param path: Input file path.
@@ -62,6 +63,51 @@ bool CheckAndGetFileSize(std::ifstream& file, size_t maxFileSize, int64_t& fileS
 */
 ErrorCode ReadFile(const char* path, std::vector<uint8_t>& data, size_t maxFileSize = DEFAULT_MAX_FILE_SIZE);
 
+/**
+ * @description: Read only view of a whole file, so decoders read straight from the page cache.
+ * Regular files of at least MMAP_MIN_FILE_SIZE bytes are mapped and advised sequential and will-need, the kernel
+ * reads ahead while the decoder runs. Smaller files and non regular files such as pipes are read into a buffer.
+ * A file truncated while it is opened is read instead of mapped, a large file must not be truncated while it is
+ * mapped.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @description: Map or read a file, a file opened before is released first.
+     * @param path: Input file path.
+     * @param maxFileSize: Maximum allowed file size limit.
+     * @param populate: Read the whole file into the page cache before returning, for prefetch threads.
+     * @return: int, Error code.
+     */
+    ErrorCode Open(const char* path, size_t maxFileSize = DEFAULT_MAX_FILE_SIZE, bool populate = false);
+
+    const uint8_t* Data() const
+    {
+        return data_;
+    }
+
+    size_t Size() const
+    {
+        return size_;
+    }
+
+private:
+    void Release();
+    ErrorCode ReadAll(int fd, size_t sizeHint, size_t maxFileSize);
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    // holds the file when it is read, empty when it is mapped
+    std::vector<uint8_t> buffer_;
+};
+
 /**
 * @description: Check file path size、symlink、regular file
 * @param path: File path
@@ -24,23 +24,222 @@
 
 #include <vector>
 #include <memory>
+#include <turbojpeg.h>
 #include "acc/ErrorCode.h"
+#include "acc/utils/FileUtils.h"
 
 namespace Acc {
 /**
- * @description: Read jpeg image meta data and optionally decode the full image.
+ * Container format of an encoded image, detected from its leading magic bytes.
+ */
+enum class ImageCodec {
+    UNKNOWN = 0,
+    JPEG,
+    PNG,
+    WEBP,
+};
+
+/**
+ * @description: Read a jpeg image file and decode it, the decoder reads the memory mapped file directly.
+ * @param path: Input jpeg image path.
+ * @param width: Output jpeg image width.
+ * @param height: Output jpeg image height.
+ * @param decoded_data: Output decoded RGB data as a shared_ptr<unsigned char[]>.
+ * @param minWidth: Minimal decoded width, 0 decodes at full size.
+ * @param minHeight: Minimal decoded height, 0 decodes at full size.
+ * When both are set the image is decoded at the smallest 1/2, 1/4 or 1/8 DCT scale that still covers them,
+ * width and height then return the scaled size.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode ReadJpegData(const char* path, int& width, int& height, std::shared_ptr<unsigned char[]>& decodedData,
+                       size_t minWidth = 0, size_t minHeight = 0);
+
+/**
+ * @description: Decode a jpeg image already held in memory, same as ReadJpegData without reading a file.
+ * @param data: Input jpeg bytes, kept by the caller until the call returns.
+ * @param size: Number of input bytes.
+ * @param width: Output jpeg image width.
+ * @param height: Output jpeg image height.
+ * @param decodedData: Output decoded RGB data.
+ * @param minWidth: Minimal decoded width, 0 decodes at full size.
+ * @param minHeight: Minimal decoded height, 0 decodes at full size.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode DecodeJpegData(const uint8_t* data, size_t size, int& width, int& height,
+                         std::shared_ptr<unsigned char[]>& decodedData, size_t minWidth = 0, size_t minHeight = 0);
+
+/**
+ * @description: Decode only a rectangle of a jpeg image.
+ * Rows above the region are skipped and rows below it are never decoded, horizontally only the iMCU columns
+ * covering the region are decompressed.
+ * @param path: Input jpeg image path.
+ * @param top: Top boundary of the region.
+ * @param left: Left boundary of the region.
+ * @param height: Region height.
+ * @param width: Region width.
+ * @param decodedData: Output decoded RGB data of the region, width * height * 3 bytes.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode ReadJpegRegion(const char* path, uint32_t top, uint32_t left, uint32_t height, uint32_t width,
+                         std::shared_ptr<unsigned char[]>& decodedData);
+
+/**
+ * @description: Decode a jpeg image and bicubic resize it in one streaming pass.
+ * The image is decoded at the smallest 1/2, 1/4 or 1/8 DCT scale that covers the target, band by band, and
+ * every band is resized as it arrives, the full size RGB image is never materialized.
+ * The result is bit exact with ReadJpegData(path, ..., resizeW, resizeH) followed by the CPU Resize operator.
+ * @param path: Input jpeg image path.
+ * @param resizeW: Resized width.
+ * @param resizeH: Resized height.
+ * @param decodedData: Output resized RGB data, resizeW * resizeH * 3 bytes.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode ReadJpegResized(const char* path, size_t resizeW, size_t resizeH,
+                          std::shared_ptr<unsigned char[]>& decodedData);
+
+/**
+ * @description: Decode and resize a jpeg image already held in memory, same as ReadJpegResized without
+ * reading a file.
+ * @param data: Input jpeg bytes, kept by the caller until the call returns.
+ * @param size: Number of input bytes.
+ * @param resizeW: Resized width.
+ * @param resizeH: Resized height.
+ * @param decodedData: Output resized RGB data, resizeW * resizeH * 3 bytes.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode DecodeJpegDataResized(const uint8_t* data, size_t size, size_t resizeW, size_t resizeH,
+                                std::shared_ptr<unsigned char[]>& decodedData);
+
+/**
+ * @description: Detect the image format from the magic bytes at the start of the data, the file suffix is not used.
+ * @param data: Input encoded image bytes.
+ * @param size: Number of input bytes.
+ * @return: ImageCodec, UNKNOWN if the data starts with none of the jpeg, png or webp signatures.
+ */
+ImageCodec SniffImageCodec(const uint8_t* data, size_t size);
+
+/**
+ * @description: Decode a png image held in memory to 8 bit RGB with libpng.
+ * Palette, gray and 16 bit images are expanded, an alpha channel is dropped.
+ * @param data: Input png bytes, kept by the caller until the call returns.
+ * @param size: Number of input bytes.
+ * @param width: Output png image width.
+ * @param height: Output png image height.
+ * @param decodedData: Output decoded RGB data.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode DecodePngData(const uint8_t* data, size_t size, int& width, int& height,
+                        std::shared_ptr<unsigned char[]>& decodedData);
+
+/**
+ * @description: Decode a lossy or lossless webp image held in memory to RGB with libwebp, an alpha plane is dropped.
+ * @param data: Input webp bytes, kept by the caller until the call returns.
+ * @param size: Number of input bytes.
+ * @param width: Output webp image width.
+ * @param height: Output webp image height.
+ * @param decodedData: Output decoded RGB data.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode DecodeWebpData(const uint8_t* data, size_t size, int& width, int& height,
+                         std::shared_ptr<unsigned char[]>& decodedData);
+
+/**
+ * @description: Decode a jpeg, png or webp image held in memory to RGB, the decoder is picked by SniffImageCodec.
+ * @param data: Input encoded image bytes, kept by the caller until the call returns.
+ * @param size: Number of input bytes.
+ * @param width: Output image width.
+ * @param height: Output image height.
+ * @param decodedData: Output decoded RGB data.
+ * @param minWidth: Minimal decoded width of a jpeg image, see DecodeJpegData. Other formats decode at full size.
+ * @param minHeight: Minimal decoded height of a jpeg image.
+ * @return: int, Error code (SUCCESS or an error code), ERR_UNSUPPORTED_TYPE for other formats.
+ */
+ErrorCode DecodeImageData(const uint8_t* data, size_t size, int& width, int& height,
+                          std::shared_ptr<unsigned char[]>& decodedData, size_t minWidth = 0, size_t minHeight = 0);
+
+/**
+ * @description: Decode and bicubic resize a jpeg, png or webp image held in memory.
+ * Jpeg images take the streaming path of DecodeJpegDataResized, the others are decoded in full and resized with
+ * the same kernel, so every format is bit exact with DecodeImageData followed by the CPU Resize operator.
+ * @param data: Input encoded image bytes, kept by the caller until the call returns.
+ * @param size: Number of input bytes.
+ * @param resizeW: Resized width.
+ * @param resizeH: Resized height.
+ * @param decodedData: Output resized RGB data, resizeW * resizeH * 3 bytes.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode DecodeImageDataResized(const uint8_t* data, size_t size, size_t resizeW, size_t resizeH,
+                                 std::shared_ptr<unsigned char[]>& decodedData);
+
+/**
+ * @description: Check an image path and map the file for DecodeImageData, any file suffix is accepted.
+ * @param path: Input image path.
+ * @param file: Output mapped file.
+ * @param populate: Read the whole file in before returning, see MappedFile::Open.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode MapImageFile(const char* path, MappedFile& file, bool populate = false);
+
+/**
+ * @description: Read a jpg, jpeg, png or webp file and decode it with DecodeImageData.
+ * @param path: Input image path.
+ * @param width: Output image width.
+ * @param height: Output image height.
+ * @param decodedData: Output decoded RGB data.
+ * @param minWidth: Minimal decoded width of a jpeg image, 0 decodes at full size.
+ * @param minHeight: Minimal decoded height of a jpeg image, 0 decodes at full size.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode ReadImageData(const char* path, int& width, int& height, std::shared_ptr<unsigned char[]>& decodedData,
+                        size_t minWidth = 0, size_t minHeight = 0);
+
+/**
+ * @description: Read a jpg, jpeg, png or webp file and decode it with DecodeImageDataResized.
+ * @param path: Input image path.
+ * @param resizeW: Resized width.
+ * @param resizeH: Resized height.
+ * @param decodedData: Output resized RGB data, resizeW * resizeH * 3 bytes.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode ReadImageResized(const char* path, size_t resizeW, size_t resizeH,
+                           std::shared_ptr<unsigned char[]>& decodedData);
+
+/**
+ * @description: Read jpeg image width and height from its frame header without decoding any pixels.
+ * Only the beginning of the file is read, it is extended when the SOF marker lies behind large APP segments.
  * @param path: Input jpeg image path.
- * @param raw_data: Output jpeg source data (filled if onlyParseHeader is true).
  * @param width: Output jpeg image width.
  * @param height: Output jpeg image height.
- * @param decoded_data: Output decoded RGB data as a shared_ptr<unsigned char[]>
- * (filled if onlyParseHeader is false).
- * @param onlyParseHeader: If true, only reads metadata and fills raw_data;
- * otherwise, decodes the image and fills decoded_data.
  * @return: int, Error code (SUCCESS or an error code).
  */
-ErrorCode ReadJpegData(const char* path, std::vector<uint8_t>& rawData, int& width, int& height,
-                       std::shared_ptr<unsigned char[]>& decodedData);
+ErrorCode ReadJpegHeader(const char* path, int& width, int& height);
+
+/**
+ * @description: Get the TurboJPEG decompressor owned by the calling thread.
+ * The handle is created on first use and destroyed when the thread exits, callers must not destroy it.
+ * @return: tjhandle, nullptr if libjpeg-turbo failed to initialize.
+ */
+tjhandle GetJpegDecompressor();
+
+/**
+ * @description: Get the TurboJPEG compressor owned by the calling thread.
+ * The handle is created on first use and destroyed when the thread exits, callers must not destroy it.
+ * @return: tjhandle, nullptr if libjpeg-turbo failed to initialize.
+ */
+tjhandle GetJpegCompressor();
+
+/**
+ * @description: Encode packed 8 bit pixels to a baseline 4:2:0 jpeg with the compressor of the calling thread.
+ * @param pixels: Input packed pixels, rows are width * 3 bytes.
+ * @param width: Image width.
+ * @param height: Image height.
+ * @param pixelFormat: TJPF_RGB or TJPF_BGR.
+ * @param quality: Jpeg quality in [1, 100].
+ * @param encoded: Output jpeg bytes.
+ * @return: int, Error code (SUCCESS or an error code).
+ */
+ErrorCode EncodeJpegData(const uint8_t* pixels, size_t width, size_t height, TJPF pixelFormat, int quality,
+                         std::vector<uint8_t>& encoded);
 
 /**
  * @description: Check image size.
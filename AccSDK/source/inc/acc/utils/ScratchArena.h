@@ -0,0 +1,34 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+* Description: Internal scratch arena header file.
+* Author: ACC SDK
+* Create: 2025
+* History: NA
+*/
+#ifndef SCRATCH_ARENA_H
+#define SCRATCH_ARENA_H
+
+#include "accdata_scratch_arena.h"
+
+namespace Acc {
+/**
+ * The arena is the one of AccData, so the CPU kernels of both libraries share a single arena per thread.
+ */
+using ScratchArena = acclib::accdata::ScratchArena;
+using ScratchScope = acclib::accdata::ScratchScope;
+} // namespace Acc
+#endif // SCRATCH_ARENA_H
@@ -31,6 +31,7 @@
 #include <queue>
 #include <thread>
 #include <vector>
+#include "acc/ErrorCode.h"
 
 namespace Acc {
 
@@ -41,6 +42,13 @@ public:
      */
     static ThreadPool& GetInstance();
 
+    /**
+     * @brief Get the thread pool for blocking file reads, created on first use
+     *
+     * Reads that wait on storage run here, so they do not hold the workers of GetInstance that decode the data.
+     */
+    static ThreadPool& GetIoInstance();
+
     /**
      * @brief submit the thread func to the thread pool
      *
@@ -78,11 +86,32 @@ public:
         }
     }
 
+    /**
+     * @brief Run body(i) for every i in [0, count) on at most maxTaskNum tasks and wait for them.
+     *
+     * Every task takes a strided share of the indices, so the body may write slot i of a caller owned vector
+     * without locking. On a worker thread the body runs inline, see InWorkerThread.
+     *
+     * @param count Number of indices
+     * @param maxTaskNum Maximum number of tasks submitted
+     * @param body Function called once per index
+     * @return ErrorCode ERR_INVALID_THREAD_POOL_STATUST when a task can not be submitted or the body throws
+     */
+    ErrorCode ParallelFor(size_t count, size_t maxTaskNum, const std::function<void(size_t)>& body);
+
     /**
      * @brief Shut down the thread pool.
      */
     void Shutdown();
 
+    /**
+     * @brief Whether the calling thread is a worker of a thread pool.
+     *
+     * A task that submits to the pool and waits on the results can block every worker once the queue is full of
+     * such tasks, kernels called from a worker run their work inline instead of fanning out again.
+     */
+    static bool InWorkerThread();
+
 private:
     explicit ThreadPool(size_t numThreads = std::thread::hardware_concurrency());
     ~ThreadPool();
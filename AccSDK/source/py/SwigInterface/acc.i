@@ -49,6 +49,10 @@ namespace std {
     %template(Tensorvector) std::vector<PyAcc::Tensor>;
     %template(Imagevector) std::vector<PyAcc::Image>;
     %template(Uint32_tSet) set<uint32_t>;
+    %template(ImageProbeInfoVector) vector<PyAcc::ImageProbeInfo>;
+    %template(ImageDecodeResultVector) vector<PyAcc::ImageDecodeResult>;
+    %template(ImageEncodeResultVector) vector<PyAcc::ImageEncodeResult>;
+    %template(VideoProbeInfoVector) vector<PyAcc::VideoProbeInfo>;
 }
 %exception {
     try {
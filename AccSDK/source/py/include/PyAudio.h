@@ -24,6 +24,7 @@
 
 #include <string>
 #include <vector>
+#include "Python.h"
 #include "PyTensor.h"
 
 namespace PyAcc {
@@ -43,6 +44,16 @@ struct LoadAudioResult {
 int load_audio(const std::string& path, Tensor& dst);
 int load_audio(const std::string& path, Tensor& dst, int sr);
 
+/**
+ * @brief Loads WAV audio held in memory into a tensor and optionally resamples it, no file is written.
+ * @param data: Any python object supporting the buffer protocol, such as bytes, bytearray or memoryview.
+ * @param dst: Tensor to store the decoded (and optionally resampled) audio.
+ * @param sr: Optional target sample rate. If not specified, the original sample rate is used.
+ * @return sample rate of the returned audio
+ */
+int load_audio_from_bytes(PyObject* data, Tensor& dst);
+int load_audio_from_bytes(PyObject* data, Tensor& dst, int sr);
+
 /**
  * @brief Loads multiple audio files into tensors and optionally resamples them.
  * @param wavFiles: List of audio file paths to load.
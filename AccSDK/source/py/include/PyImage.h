@@ -23,6 +23,7 @@
 #define PYIMAGE_H
 #include <vector>
 #include <memory>
+#include <string>
 #include "Python.h"
 
 #include "PyTensor.h"
@@ -58,7 +59,9 @@ public:
      */
     Image(const char* path, const char* device);
     /**
-     * @brief Image deep copy, exposed for Python
+     * @brief Image copy, exposed for Python
+     *
+     * The pixels are shared copy-on-write unless this image has been exported to numpy.
      *
      * @param Image dst Image
      * @return Image
@@ -139,6 +142,31 @@ public:
      * @return Image
      */
     static Image open(const std::string& path, const std::string& device);
+    /**
+     * @brief Decode a jpeg, png or webp file and resize it to the given size in one step, exposed for Python
+     *
+     * @param path user input path
+     * @param resize_w resized width
+     * @param resize_h resized height
+     * @param interpolation interpolation algorithm
+     * @param device device str, range is cpu
+     * @return Image
+     */
+    static Image open_resized(const std::string& path, size_t resize_w, size_t resize_h,
+                              Acc::Interpolation interpolation, const std::string& device);
+    /**
+     * @brief Decode only a crop rectangle of a jpeg file, exposed for Python
+     *
+     * @param path user input path
+     * @param top: top boundary position of the crop
+     * @param left: left boundary position of the crop
+     * @param height: crop height
+     * @param width: crop width
+     * @param device device str, range is cpu
+     * @return Image
+     */
+    static Image open_cropped(const std::string& path, uint32_t top, uint32_t left, uint32_t height, uint32_t width,
+                              const std::string& device);
     /**
      * @brief Construct Image from numpy array, exposed for Python
      *
@@ -148,6 +176,22 @@ public:
      * @return Image
      */
     static Image from_numpy(PyObject* pyObj, Acc::ImageFormat imageFormat, const char* device);
+    /**
+     * @brief Construct Image by decoding in-memory jpeg, png or webp bytes, exposed for Python
+     *
+     * @param PyObject: any object supporting the buffer protocol, such as bytes, bytearray or memoryview
+     * @param device device str, range is cpu
+     * @return Image
+     */
+    static Image from_bytes(PyObject* pyObj, const char* device);
+    /**
+     * @brief Construct Image by decoding base64 encoded jpeg, png or webp, exposed for Python
+     *
+     * @param PyObject: base64 text as str, or any object supporting the buffer protocol, a data url prefix is accepted
+     * @param device device str, range is cpu
+     * @return Image
+     */
+    static Image from_base64(PyObject* pyObj, const char* device);
     /**
      * @brief Image resize
      *
@@ -173,6 +217,19 @@ public:
     Image crop(uint32_t top, uint32_t left, uint32_t height, uint32_t width,
                Acc::DeviceMode device_mode = Acc::DeviceMode::CPU);
 
+    /**
+     * @brief Convert a NV12 or YUV420P image to RGB and resize it in one step
+     *
+     * @param resize_w resized width
+     * @param resize_h resized height
+     * @param interpolation interpolation algorithm
+     * @param device_mode the mode for running operator
+     * @return Image new RGB image
+     */
+    Image yuv_to_rgb_resize(size_t resize_w, size_t resize_h,
+                            Acc::Interpolation interpolation = Acc::Interpolation::BICUBIC,
+                            Acc::DeviceMode device_mode = Acc::DeviceMode::CPU);
+
     /**
      * @brief Image to_tensor
      *
@@ -182,11 +239,79 @@ public:
      */
     Tensor to_tensor(Acc::TensorFormat format, Acc::DeviceMode device_mode = Acc::DeviceMode::CPU);
 
+    /**
+     * @brief Encode the image to jpeg, exposed for Python
+     *
+     * @param quality jpeg quality, range is [1, 100]
+     * @return std::string jpeg bytes, converted to python bytes
+     */
+    std::string encode_jpeg(int quality = Acc::DEFAULT_JPEG_QUALITY);
+
 private:
     std::shared_ptr<Acc::Image> image_ = nullptr;
     std::string deviceStr_ = "cpu";
+    bool exported_ = false; // numpy views may write the pixels behind the copy-on-write tracking
+};
+
+/**
+ * @brief Size of an image file read from its header, status is 0 when the image is probed successfully
+ */
+struct ImageProbeInfo {
+    uint32_t status = 0;
+    size_t width = 0;
+    size_t height = 0;
+};
+
+/**
+ * @brief Python interface entry for probing the size of jpeg images without decoding them
+ *
+ * A broken file does not raise, its status is set instead so the other results stay usable.
+ *
+ * @param paths Input jpeg image paths
+ * @return std::vector<ImageProbeInfo> One result per path
+ */
+std::vector<ImageProbeInfo> probe_images(const std::vector<std::string>& paths);
+
+/**
+ * @brief Decoded image of a batch, status is 0 when the image is decoded successfully
+ */
+struct ImageDecodeResult {
+    uint32_t status = 0;
+    Image image;
 };
 
+/**
+ * @brief Python interface entry for decoding many jpeg, png or webp images on the SDK thread pool
+ *
+ * A broken file does not raise, its status is set instead so the other images stay usable.
+ *
+ * @param paths Input image paths
+ * @param resize_w Resized width, 0 together with resize_h keeps the original size
+ * @param resize_h Resized height
+ * @return std::vector<ImageDecodeResult> One result per path
+ */
+std::vector<ImageDecodeResult> decode_images(const std::vector<std::string>& paths, size_t resize_w = 0,
+                                             size_t resize_h = 0);
+
+/**
+ * @brief Jpeg bytes of a batch, status is 0 when the image is encoded successfully
+ */
+struct ImageEncodeResult {
+    uint32_t status = 0;
+    std::string data;
+};
+
+/**
+ * @brief Python interface entry for encoding many images to jpeg on the SDK thread pool
+ *
+ * An unsupported image does not raise, its status is set instead so the other results stay usable.
+ *
+ * @param images Input RGB or BGR images
+ * @param quality jpeg quality, range is [1, 100]
+ * @return std::vector<ImageEncodeResult> One result per image
+ */
+std::vector<ImageEncodeResult> encode_jpegs(const std::vector<Image>& images, int quality = Acc::DEFAULT_JPEG_QUALITY);
+
 } // namespace PyAcc
 
 #endif // PYIMAGE_H
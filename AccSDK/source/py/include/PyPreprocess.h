@@ -29,6 +29,33 @@
 #include "PyTensor.h"
 
 namespace PyAcc {
+/**
+ * @brief Flattened Qwen2-VL patches of a batch of images
+ *
+ * pixel_values has shape (sum of grid_t * grid_h * grid_w, C * temporal_patch_size * patch_size * patch_size),
+ * grid_thw holds (grid_t, grid_h, grid_w) of every image back to back.
+ */
+struct Qwen2VLPatches {
+    Tensor pixel_values;
+    std::vector<size_t> grid_thw;
+};
+
+/**
+ * @brief Qwen2-VL grid and visual token count estimated from the image or video size only
+ */
+struct Qwen2VLTokenEstimate {
+    std::vector<size_t> grid_thw;
+    size_t num_tokens = 0;
+};
+
+/**
+ * @brief InternVL2 tile and visual token count estimated from the image size only
+ */
+struct InternVL2TokenEstimate {
+    size_t num_tiles = 0;
+    size_t num_tokens = 0;
+};
+
 class Qwen2VLProcessor {
 public:
     /**
@@ -45,6 +72,133 @@ public:
      */
     static std::vector<Tensor> Preprocess(const std::vector<Image>& pyImages, const std::vector<float>& mean,
                                           const std::vector<float>& std, int resizeW, int resizeH);
+
+    /**
+     * @brief Python interface entry for preprocessing into flattened patches
+     *
+     * Performs Resize + ToTensor + Normalize + patch flatten on every image in one native pass, so the
+     * result can be fed to the vision encoder without any reshaping on the Python side. Every image is
+     * treated as its own temporal group, and the images are processed concurrently.
+     *
+     * @param pyImages Input images from Python, may have different sizes
+     * @param mean Normalize mean vector (length = 3)
+     * @param std Normalize standard deviation vector (length = 3)
+     * @param resizeW Resize width of all images, multiple of patchSize * mergeSize
+     * @param resizeH Resize height of all images, multiple of patchSize * mergeSize. When both resizeW and
+     *        resizeH are 0, every image is smart resized from minPixels and maxPixels instead
+     * @param patchSize Spatial patch size
+     * @param temporalPatchSize Temporal patch size (must be 2)
+     * @param mergeSize Spatial merge size
+     * @param minPixels Min pixels of the smart resize of every image
+     * @param maxPixels Max pixels of the smart resize of every image
+     * @param outputType Data type of the patches, FLOAT32, FLOAT16 or BFLOAT16
+     * @return Qwen2VLPatches Patches of all images in one matrix and their grid_thw
+     */
+    static Qwen2VLPatches PreprocessPatches(const std::vector<Image>& pyImages, const std::vector<float>& mean,
+                                           const std::vector<float>& std, int resizeW, int resizeH,
+                                           int patchSize = 14, int temporalPatchSize = 2, int mergeSize = 2,
+                                           int minPixels = 56 * 56, int maxPixels = 28 * 28 * 1280,
+                                           Acc::DataType outputType = Acc::DataType::FLOAT32);
+
+    /**
+     * @brief Python interface entry for preprocessing one video into flattened patches
+     *
+     * All frames are preprocessed in a single native run, every temporalPatchSize consecutive frames form
+     * one temporal group and the last frame is repeated to complete the final group.
+     *
+     * @param pyFrames Video frames from Python, all of the same size
+     * @param mean Normalize mean vector (length = 3)
+     * @param std Normalize standard deviation vector (length = 3)
+     * @param resizeW Resize width, multiple of patchSize * mergeSize
+     * @param resizeH Resize height, multiple of patchSize * mergeSize
+     * @param patchSize Spatial patch size
+     * @param temporalPatchSize Temporal patch size (must be 2)
+     * @param mergeSize Spatial merge size
+     * @param outputType Data type of the patches, FLOAT32, FLOAT16 or BFLOAT16
+     * @return Qwen2VLPatches Patches of the video and its grid_thw
+     */
+    static Qwen2VLPatches PreprocessVideoPatches(const std::vector<Image>& pyFrames, const std::vector<float>& mean,
+                                                const std::vector<float>& std, int resizeW, int resizeH,
+                                                int patchSize = 14, int temporalPatchSize = 2, int mergeSize = 2,
+                                                Acc::DataType outputType = Acc::DataType::FLOAT32);
+
+    /**
+     * @brief Python interface entry for estimating grid_thw and token count without decoding any pixels
+     *
+     * @param width Width of the image or video frames, e.g. from probe_images or probe_videos
+     * @param height Height of the image or video frames
+     * @param numFrames 1 for an image, the number of sampled frames for a video
+     * @param resizeW Resize width, when both resizeW and resizeH are 0 the smart resize is used
+     * @param resizeH Resize height
+     * @param patchSize Spatial patch size
+     * @param temporalPatchSize Temporal patch size
+     * @param mergeSize Spatial merge size
+     * @param minPixels Min pixels of the smart resize
+     * @param maxPixels Max pixels of the smart resize
+     * @return Qwen2VLTokenEstimate grid_thw and number of tokens
+     */
+    static Qwen2VLTokenEstimate EstimateTokens(size_t width, size_t height, size_t numFrames = 1, int resizeW = 0,
+                                               int resizeH = 0, int patchSize = 14, int temporalPatchSize = 2,
+                                               int mergeSize = 2, int minPixels = 56 * 56,
+                                               int maxPixels = 28 * 28 * 1280);
+};
+
+class InternVL2Processor {
+public:
+    /**
+     * @brief Python interface entry for InternVL2 dynamic tiling preprocessing
+     *
+     * Splits the input image into normalized tiles (plus an optional thumbnail) in a single native call.
+     *
+     * @param pyImage Input image from Python
+     * @param mean Normalize mean vector (length = 3)
+     * @param std Normalize standard deviation vector (length = 3)
+     * @param inputSize Side length of each tile
+     * @param minNum Minimum number of tiles
+     * @param maxNum Maximum number of tiles
+     * @param useThumbnail Whether to append a thumbnail tile when more than one tile is produced
+     * @return Tensor Output tensor with shape (numTiles, 3, inputSize, inputSize)
+     */
+    static Tensor Preprocess(const Image& pyImage, const std::vector<float>& mean, const std::vector<float>& std,
+                             int inputSize, int minNum, int maxNum, bool useThumbnail);
+
+    /**
+     * @brief Python interface entry for estimating the tile and token count without decoding any pixels
+     *
+     * @param width Width of the image, e.g. from probe_images
+     * @param height Height of the image
+     * @param inputSize Side length of each tile
+     * @param minNum Minimum number of tiles
+     * @param maxNum Maximum number of tiles
+     * @param useThumbnail Whether a thumbnail tile is appended when more than one tile is produced
+     * @param tokensPerTile Number of tokens of one tile after the vision encoder, 256 for InternVL2
+     * @return InternVL2TokenEstimate Number of tiles and tokens
+     */
+    static InternVL2TokenEstimate EstimateTokens(size_t width, size_t height, int inputSize = 448, int minNum = 1,
+                                                 int maxNum = 12, bool useThumbnail = true,
+                                                 size_t tokensPerTile = 256);
+};
+
+class ClipProcessor {
+public:
+    /**
+     * @brief Python interface entry for batched CLIP preprocessing
+     *
+     * Performs shortest side resize + center crop + normalize on all images in a single native call.
+     *
+     * @param pyImages Input images from Python, e.g. all decoded frames of one video
+     * @param mean Normalize mean vector (length = 3)
+     * @param std Normalize standard deviation vector (length = 3)
+     * @param shortestEdge Target length of the shortest side after resize
+     * @param cropW Center crop width
+     * @param cropH Center crop height
+     * @param resizeW When resizeW and resizeH are > 0, images are treated as stretched to this size first
+     * @param resizeH When resizeW and resizeH are > 0, images are treated as stretched to this size first
+     * @return Tensor Output tensor with shape (numImages, 3, cropH, cropW)
+     */
+    static Tensor Preprocess(const std::vector<Image>& pyImages, const std::vector<float>& mean,
+                             const std::vector<float>& std, int shortestEdge, int cropW, int cropH, int resizeW = 0,
+                             int resizeH = 0);
 };
 } // namespace PyAcc
 #endif // PY_PYPREPROCESS_H
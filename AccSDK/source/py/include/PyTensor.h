@@ -55,7 +55,9 @@ public:
      */
     Tensor& operator=(const Tensor& other) = default;
     /**
-     * @brief Tensor deep copy to a new tensor, exposed as a Python interface
+     * @brief Tensor copy to a new tensor, exposed as a Python interface
+     *
+     * The buffer is shared copy-on-write unless this tensor has been exported to numpy.
      *
      * @return Tensor dst tensor
      */
@@ -80,13 +82,16 @@ public:
     /**
      * @brief Swig Python funciton: Normalizes input tensor using mean and standard deviation values.
      *        Applies the formula: output = (input - mean) / std for each channel.
+     *        UINT8 input is scaled by 1/255 first, in the same per-channel multiply-add.
      * @param mean Vector of mean values for normalization, one value per channel.
      * @param std Vector of standard deviation values for normalization, one value per channel.
      * @param deviceMode Specifies the device mode for computation (CPU, NPU, DVPP, etc). Default is CPU.
+     * @param outputType Data type of the result, supports [FLOAT32/FLOAT16/BFLOAT16]. Default is FLOAT32.
      * @return Tensor
      */
     Tensor normalize(const std::vector<float>& mean, const std::vector<float>& std,
-                     const Acc::DeviceMode deviceMode = Acc::DeviceMode::CPU);
+                     const Acc::DeviceMode deviceMode = Acc::DeviceMode::CPU,
+                     const Acc::DataType outputType = Acc::DataType::FLOAT32);
 
     // inner aux func, will not expose Python interfaces.
 public:
@@ -137,6 +142,7 @@ public:
 private:
     std::shared_ptr<Acc::Tensor> tensor_ = nullptr;
     std::string deviceStr_ = "cpu";
+    bool exported_ = false; // numpy views may write the buffer behind the copy-on-write tracking
 };
 
 } // namespace PyAcc
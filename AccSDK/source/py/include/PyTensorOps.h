@@ -28,15 +28,18 @@ namespace PyAcc {
     /**
      * @brief Swig Python funciton: Normalizes input tensor using mean and standard deviation values.
      *        Applies the formula: output = (input - mean) / std for each channel.
+     *        UINT8 input is scaled by 1/255 first, in the same per-channel multiply-add.
      * @param src Input tensor to be normalized.
      * @param dst Output tensor to store the normalized result.
      * @param mean Vector of mean values for normalization, one value per channel.
      * @param std Vector of standard deviation values for normalization, one value per channel.
      * @param deviceMode Specifies the device mode for computation (CPU, NPU, DVPP, etc). Default is CPU.
+     * @param outputType Data type of dst, supports [FLOAT32/FLOAT16/BFLOAT16]. Default is FLOAT32.
      * @return ErrorCode
      */
     void normalize(const Tensor& src, Tensor& dst, const std::vector<float>& mean, const std::vector<float>& std,
-                   const Acc::DeviceMode deviceMode = Acc::DeviceMode::CPU);
+                   const Acc::DeviceMode deviceMode = Acc::DeviceMode::CPU,
+                   const Acc::DataType outputType = Acc::DataType::FLOAT32);
 }
 
 #endif // PYTENSOROPS_H
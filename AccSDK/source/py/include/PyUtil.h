@@ -22,6 +22,7 @@
 
 #ifndef PYUTIL_H
 #define PYUTIL_H
+#include <cstdint>
 #include <vector>
 #include "Python.h"
 #include "acc/tensor/TensorDataType.h"
@@ -53,6 +54,23 @@ namespace PyAcc {
      * @return python numpy ndarray with __array_interface__ dict
      */
     PyObject* ToNumpy(NumpyData numpyData);
+
+    /**
+     * @brief Read only view of a python object supporting the buffer protocol, such as bytes, bytearray,
+     * memoryview or a contiguous numpy array. The buffer is borrowed, not copied, and released on destruction
+     */
+    class PyBufferView {
+    public:
+        explicit PyBufferView(PyObject* pyObj);
+        ~PyBufferView();
+        PyBufferView(const PyBufferView&) = delete;
+        PyBufferView& operator=(const PyBufferView&) = delete;
+        const uint8_t* Data() const;
+        size_t Size() const;
+
+    private:
+        Py_buffer view_ = {};
+    };
 }
 
 #endif // PYUTIL_H
@@ -24,6 +24,7 @@
 
 #include <vector>
 #include <set>
+#include <string>
 #include "PyImage.h"
 
 namespace PyAcc {
@@ -41,6 +42,26 @@ namespace PyAcc {
 std::vector<Image> video_decode(const char* path, const char* device, const std::set<uint32_t>& frameIndices = {},
                                 int sampleNum = -1);
 
+/**
+ * @brief Geometry and timing of a video read from its metadata, status is 0 when the video is probed successfully
+ */
+struct VideoProbeInfo {
+    uint32_t status = 0;
+    size_t width = 0;
+    size_t height = 0;
+    double fps = 0;
+    double duration = 0;
+    int64_t total_frames = 0;
+};
+
+/**
+ * @brief Python interface entry for probing mp4 videos without decoding any frame
+ *
+ * @param paths Input video paths
+ * @return std::vector<VideoProbeInfo> One result per path, a broken file only sets its own status
+ */
+std::vector<VideoProbeInfo> probe_videos(const std::vector<std::string>& paths);
+
 } // namespace PyAcc
 
 #endif // PYVIDEO_H
@@ -39,6 +39,18 @@ void load_audio_impl(const std::string& path, Tensor& dst, int& originalSr, std:
     dst.SetTensor(tensor);
 }
 
+void load_audio_from_bytes_impl(PyObject* data, Tensor& dst, int& originalSr, std::optional<int> sr)
+{
+    PyBufferView buffer(data);
+    Acc::Tensor tensor;
+
+    Acc::ErrorCode ret = Acc::LoadAudioFromBuffer(buffer.Data(), buffer.Size(), tensor, originalSr, sr);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error(std::string("LoadAudio from bytes failed"));
+    }
+    dst.SetTensor(tensor);
+}
+
 void load_audio_batch_impl(std::vector<std::string> wavFiles, std::vector<Tensor>& dst, std::vector<int>& originalSrs,
                            std::optional<int> sr)
 {
@@ -72,6 +84,20 @@ int load_audio(const std::string& path, Tensor& dst, int sr)
     return sr;
 }
 
+int load_audio_from_bytes(PyObject* data, Tensor& dst)
+{
+    int originalSr = 0;
+    load_audio_from_bytes_impl(data, dst, originalSr, std::nullopt);
+    return originalSr;
+}
+
+int load_audio_from_bytes(PyObject* data, Tensor& dst, int sr)
+{
+    int originalSr = 0;
+    load_audio_from_bytes_impl(data, dst, originalSr, sr);
+    return sr;
+}
+
 std::vector<int> load_audio_batch(std::vector<std::string> wavFiles, std::vector<Tensor>& dst)
 {
     std::vector<int> originalSrs = {};
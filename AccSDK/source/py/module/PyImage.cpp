@@ -30,6 +30,7 @@
 #include "acc/tensor/TensorOps.h"
 #include "acc/ErrorCode.h"
 #include "acc/utils/LogImpl.h"
+#include "acc/utils/ImageUtils.h"
 
 namespace {
 constexpr size_t TWO = 2;
@@ -68,6 +69,9 @@ Image Image::clone() const
 {
     Image image;
     Acc::ErrorCode ret = image_->Clone(*image.GetImagePtr());
+    if (ret == Acc::SUCCESS && exported_) {
+        ret = image.GetImagePtr()->MakeUnique();
+    }
     if (ret != Acc::SUCCESS) {
         throw std::runtime_error("Image clone failed.");
     }
@@ -106,9 +110,7 @@ Acc::DataType Image::Dtype() const
 
 const std::string& Image::Device()
 {
-    std::unique_ptr<char[]> device = image_->Device();
-    std::string tmpStr(device.get());
-    deviceStr_ = tmpStr;
+    deviceStr_ = image_->Device();
     return deviceStr_;
 }
 
@@ -124,6 +126,11 @@ void Image::SetImage(const Acc::Image& src)
 
 PyObject* Image::numpy()
 {
+    // The returned array is writable, detach from any copy-on-write clone first
+    if (image_->MakeUnique() != Acc::SUCCESS) {
+        throw std::runtime_error("Failed to copy image data for numpy ndarray.");
+    }
+    exported_ = true;
     NumpyData numpyData;
     numpyData.dataType = image_->DType();
     numpyData.dataPtr = image_->Ptr();
@@ -142,6 +149,11 @@ PyObject* Image::numpy()
             std::swap(shape[0], shape[1]);
             shape.insert(shape.begin(), THREE);
         }
+    } else if (fmt == Acc::ImageFormat::NV12 || fmt == Acc::ImageFormat::YUV420P) {
+        // [H * 3 / 2, W]
+        if (shape.size() == TWO) {
+            shape = {shape[1] + shape[1] / TWO, shape[0]};
+        }
     } else {
         throw std::runtime_error("Unsupported image format for numpy()");
     }
@@ -155,10 +167,91 @@ Image Image::open(const std::string& path, const std::string& device)
     return PyAcc::Image(path.c_str(), device.c_str());
 }
 
+Image Image::open_resized(const std::string& path, size_t resize_w, size_t resize_h, Acc::Interpolation interpolation,
+                          const std::string& device)
+{
+    if (device != "cpu") {
+        Acc::LogError << "Illegal device. Only 'cpu' is supported now.";
+        throw std::runtime_error("Invalid parameter: device must be 'cpu'.");
+    }
+    Acc::Image dst;
+    Acc::ErrorCode ret = Acc::ImageDecodeResize(path.c_str(), dst, resize_w, resize_h, interpolation);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Image decode and resize failed. Please check the detailed log above for the cause.");
+    }
+    Image img;
+    img.SetImage(dst);
+    return img;
+}
+
+Image Image::open_cropped(const std::string& path, uint32_t top, uint32_t left, uint32_t height, uint32_t width,
+                          const std::string& device)
+{
+    if (device != "cpu") {
+        Acc::LogError << "Illegal device. Only 'cpu' is supported now.";
+        throw std::runtime_error("Invalid parameter: device must be 'cpu'.");
+    }
+    Acc::Image dst;
+    Acc::ErrorCode ret = Acc::ImageDecodeCrop(path.c_str(), dst, top, left, height, width);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Image decode and crop failed. Please check the detailed log above for the cause.");
+    }
+    Image img;
+    img.SetImage(dst);
+    return img;
+}
+
+Image Image::from_bytes(PyObject* pyObj, const char* device)
+{
+    PyBufferView buffer(pyObj);
+    std::shared_ptr<Acc::Image> decoded = nullptr;
+    try {
+        decoded = std::make_shared<Acc::Image>(buffer.Data(), buffer.Size(), device);
+    } catch (const std::exception& ex) {
+        throw std::runtime_error("Create Image from bytes failed. Please check the detailed log above for the cause.");
+    }
+    Image img;
+    img.SetImage(*decoded);
+    return img;
+}
+
+Image Image::from_base64(PyObject* pyObj, const char* device)
+{
+    if (device == nullptr || std::string(device) != "cpu") {
+        Acc::LogError << "Illegal device. Only 'cpu' is supported now.";
+        throw std::runtime_error("Invalid parameter: device must be 'cpu'.");
+    }
+    Acc::Image decoded;
+    Acc::ErrorCode ret = Acc::SUCCESS;
+    if (pyObj != nullptr && PyUnicode_Check(pyObj)) {
+        // the utf-8 form of an ascii str is its own storage, so the text is read without a copy
+        Py_ssize_t length = 0;
+        const char* text = PyUnicode_AsUTF8AndSize(pyObj, &length);
+        if (text == nullptr) {
+            PyErr_Clear();
+            throw std::runtime_error("Create Image from base64 failed. The str can not be encoded as utf-8.");
+        }
+        ret = Acc::DecodeImageBase64(text, static_cast<size_t>(length), decoded);
+    } else {
+        PyBufferView buffer(pyObj);
+        ret = Acc::DecodeImageBase64(reinterpret_cast<const char*>(buffer.Data()), buffer.Size(), decoded);
+    }
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Create Image from base64 failed. Please check the detailed log above for the cause.");
+    }
+    Image img;
+    img.SetImage(decoded);
+    return img;
+}
+
 Image Image::from_numpy(PyObject* pyObj, Acc::ImageFormat imageFormat, const char* device)
 {
     NumpyData numpyData = GetNumpyData(pyObj);
-    if (numpyData.shape.size() != THREE) {
+    bool isYuv = imageFormat == Acc::ImageFormat::NV12 || imageFormat == Acc::ImageFormat::YUV420P;
+    if (isYuv && numpyData.shape.size() != TWO) {
+        throw std::runtime_error("Create Image from numpy array failed, shape should be 2D for NV12/YUV420P");
+    }
+    if (!isYuv && numpyData.shape.size() != THREE) {
         throw std::runtime_error("Create Image from numpy array failed, shape should be 3D");
     }
 
@@ -192,6 +285,17 @@ Image Image::from_numpy(PyObject* pyObj, Acc::ImageFormat imageFormat, const cha
             imSize = {numpyShape[2], numpyShape[1]};
             break;
 
+        case Acc::ImageFormat::NV12:
+            [[fallthrough]];
+        case Acc::ImageFormat::YUV420P:
+            if (numpyShape[0] % THREE != 0) {
+                throw std::runtime_error(std::string("Create Image from numpy array failed: for NV12/YUV420P "
+                                                     "expect shape [H * 3 / 2, W], got rows = ") +
+                                         std::to_string(numpyShape[0]));
+            }
+            imSize = {numpyShape[1], numpyShape[0] / THREE * TWO};
+            break;
+
         default:
             throw std::runtime_error("Create Image from numpy array failed: unsupported image format");
     }
@@ -226,6 +330,29 @@ Image Image::crop(uint32_t top, uint32_t left, uint32_t height, uint32_t width,
     return img;
 }
 
+Image Image::yuv_to_rgb_resize(size_t resize_w, size_t resize_h, Acc::Interpolation interpolation,
+                               Acc::DeviceMode device_mode)
+{
+    Acc::Image dst;
+    Acc::ErrorCode ret = Acc::ImageYuvToRgbResize(*image_, dst, resize_w, resize_h, interpolation, device_mode);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Image yuv to rgb resize failed. Please check the detailed log above for the cause.");
+    }
+    Image img;
+    img.SetImage(dst);
+    return img;
+}
+
+std::string Image::encode_jpeg(int quality)
+{
+    std::vector<uint8_t> encoded;
+    Acc::ErrorCode ret = image_->EncodeJpeg(encoded, quality);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Image encode jpeg failed. Please check the detailed log above for the cause.");
+    }
+    return std::string(encoded.begin(), encoded.end());
+}
+
 Tensor Image::to_tensor(Acc::TensorFormat format, Acc::DeviceMode device_mode)
 {
     Acc::Tensor srcAccTensor = image_->GetTensor();
@@ -239,4 +366,63 @@ Tensor Image::to_tensor(Acc::TensorFormat format, Acc::DeviceMode device_mode)
     outputPyTensor.SetTensor(outputAccTensor);
     return outputPyTensor;
 }
-} // namespace PyAcc
\ No newline at end of file
+
+std::vector<ImageProbeInfo> probe_images(const std::vector<std::string>& paths)
+{
+    std::vector<Acc::ImageProbeInfo> accInfos;
+    Acc::ErrorCode ret = Acc::ProbeImages(paths, accInfos);
+    if (ret == Acc::ERR_INVALID_THREAD_POOL_STATUST) {
+        throw std::runtime_error("Failed to probe images. Please see above log for detail.");
+    }
+    std::vector<ImageProbeInfo> result(accInfos.size());
+    for (size_t i = 0; i < accInfos.size(); ++i) {
+        result[i] = {accInfos[i].status, accInfos[i].width, accInfos[i].height};
+    }
+    return result;
+}
+
+std::vector<ImageDecodeResult> decode_images(const std::vector<std::string>& paths, size_t resize_w, size_t resize_h)
+{
+    if ((resize_w != 0 || resize_h != 0) && Acc::CheckImSize({resize_w, resize_h}) != Acc::SUCCESS) {
+        throw std::runtime_error("Failed to decode images, the resize size is invalid.");
+    }
+    std::vector<Acc::Image> accImages;
+    std::vector<Acc::ErrorCode> statuses;
+    Acc::ImageDecodeOptions options;
+    options.resizeWidth = resize_w;
+    options.resizeHeight = resize_h;
+    Acc::ErrorCode ret = Acc::DecodeImages(paths, accImages, statuses, options);
+    if (ret == Acc::ERR_INVALID_THREAD_POOL_STATUST || statuses.size() != paths.size()) {
+        throw std::runtime_error("Failed to decode images. Please see above log for detail.");
+    }
+    std::vector<ImageDecodeResult> result(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        result[i].status = statuses[i];
+        if (statuses[i] == Acc::SUCCESS) {
+            result[i].image.SetImage(accImages[i]);
+        }
+    }
+    return result;
+}
+
+std::vector<ImageEncodeResult> encode_jpegs(const std::vector<Image>& images, int quality)
+{
+    std::vector<Acc::Image> accImages;
+    accImages.reserve(images.size());
+    for (const auto& image : images) {
+        accImages.push_back(*image.GetImagePtr());
+    }
+    std::vector<std::vector<uint8_t>> encoded;
+    std::vector<Acc::ErrorCode> statuses;
+    Acc::ErrorCode ret = Acc::EncodeJpegs(accImages, encoded, statuses, quality);
+    if (ret == Acc::ERR_INVALID_THREAD_POOL_STATUST || statuses.size() != images.size()) {
+        throw std::runtime_error("Failed to encode images. Please see above log for detail.");
+    }
+    std::vector<ImageEncodeResult> result(images.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        result[i].status = statuses[i];
+        result[i].data.assign(encoded[i].begin(), encoded[i].end());
+    }
+    return result;
+}
+} // namespace PyAcc
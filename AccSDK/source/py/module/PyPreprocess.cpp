@@ -23,15 +23,14 @@
 #include "PyPreprocess.h"
 #include <vector>
 #include <memory>
+#include <utility>
 
 #include "Python.h"
 #include "acc/ErrorCode.h"
 #include "acc/fusion_operators/FusionOperators.h"
 
-namespace PyAcc {
-
-std::vector<Tensor> Qwen2VLProcessor::Preprocess(const std::vector<Image>& pyImages, const std::vector<float>& mean,
-                                                 const std::vector<float>& std, int resizeW, int resizeH)
+namespace {
+std::vector<std::shared_ptr<Acc::Image>> GetInternalImages(const std::vector<PyAcc::Image>& pyImages)
 {
     if (pyImages.empty()) {
         throw std::runtime_error("Images is empty. This is likely due to a corrupt image.");
@@ -46,6 +45,16 @@ std::vector<Tensor> Qwen2VLProcessor::Preprocess(const std::vector<Image>& pyIma
         }
         internalImages.push_back(internalImage);
     }
+    return internalImages;
+}
+} // namespace
+
+namespace PyAcc {
+
+std::vector<Tensor> Qwen2VLProcessor::Preprocess(const std::vector<Image>& pyImages, const std::vector<float>& mean,
+                                                 const std::vector<float>& std, int resizeW, int resizeH)
+{
+    std::vector<std::shared_ptr<Acc::Image>> internalImages = GetInternalImages(pyImages);
 
     Acc::QwenPreprocessConfig config{
         mean,
@@ -71,4 +80,131 @@ std::vector<Tensor> Qwen2VLProcessor::Preprocess(const std::vector<Image>& pyIma
     return pyTensors;
 }
 
+Qwen2VLPatches Qwen2VLProcessor::PreprocessPatches(const std::vector<Image>& pyImages,
+                                                   const std::vector<float>& mean, const std::vector<float>& std,
+                                                   int resizeW, int resizeH, int patchSize, int temporalPatchSize,
+                                                   int mergeSize, int minPixels, int maxPixels,
+                                                   Acc::DataType outputType)
+{
+    std::vector<std::shared_ptr<Acc::Image>> internalImages = GetInternalImages(pyImages);
+
+    Acc::QwenPreprocessConfig config{mean, std, resizeW, resizeH, true, patchSize, temporalPatchSize, mergeSize};
+    config.minPixels = minPixels;
+    config.maxPixels = maxPixels;
+    config.outputType = outputType;
+
+    Acc::Tensor accTensor;
+    Qwen2VLPatches patches;
+    Acc::ErrorCode ret = Acc::FusionOperator::Qwen2VLImagePatches(internalImages, config, accTensor,
+                                                                  patches.grid_thw);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Failed to preprocess image data. Please see above log for detail.");
+    }
+    patches.pixel_values.SetTensor(accTensor);
+    return patches;
+}
+
+Qwen2VLPatches Qwen2VLProcessor::PreprocessVideoPatches(const std::vector<Image>& pyFrames,
+                                                        const std::vector<float>& mean, const std::vector<float>& std,
+                                                        int resizeW, int resizeH, int patchSize,
+                                                        int temporalPatchSize, int mergeSize,
+                                                        Acc::DataType outputType)
+{
+    std::vector<std::shared_ptr<Acc::Image>> internalFrames = GetInternalImages(pyFrames);
+
+    Acc::QwenPreprocessConfig config{mean, std, resizeW, resizeH, true, patchSize, temporalPatchSize, mergeSize};
+    config.outputType = outputType;
+
+    Acc::Tensor accTensor;
+    Acc::ErrorCode ret = Acc::FusionOperator::Qwen2VLVideoPreprocess(internalFrames, config, accTensor);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Failed to preprocess video data. Please see above log for detail.");
+    }
+
+    Qwen2VLPatches patches;
+    patches.pixel_values.SetTensor(accTensor);
+    size_t numFrames = internalFrames.size();
+    size_t tps = static_cast<size_t>(temporalPatchSize);
+    patches.grid_thw = {(numFrames + tps - 1) / tps, static_cast<size_t>(resizeH / patchSize),
+                        static_cast<size_t>(resizeW / patchSize)};
+    return patches;
+}
+
+Qwen2VLTokenEstimate Qwen2VLProcessor::EstimateTokens(size_t width, size_t height, size_t numFrames, int resizeW,
+                                                      int resizeH, int patchSize, int temporalPatchSize,
+                                                      int mergeSize, int minPixels, int maxPixels)
+{
+    Acc::QwenPreprocessConfig config;
+    config.resizeW = resizeW;
+    config.resizeH = resizeH;
+    config.patchSize = patchSize;
+    config.temporalPatchSize = temporalPatchSize;
+    config.mergeSize = mergeSize;
+    config.minPixels = minPixels;
+    config.maxPixels = maxPixels;
+
+    Qwen2VLTokenEstimate result;
+    Acc::ErrorCode ret = Acc::FusionOperator::Qwen2VLEstimateTokens(height, width, numFrames, config,
+                                                                    result.grid_thw, result.num_tokens);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Failed to estimate tokens. Please see above log for detail.");
+    }
+    return result;
+}
+
+Tensor InternVL2Processor::Preprocess(const Image& pyImage, const std::vector<float>& mean,
+                                      const std::vector<float>& std, int inputSize, int minNum, int maxNum,
+                                      bool useThumbnail)
+{
+    auto internalImage = pyImage.GetImagePtr();
+    if (!internalImage) {
+        throw std::runtime_error("Failed to retrieve image data. This is likely due to a corrupt image.");
+    }
+
+    Acc::InternVL2PreprocessConfig config{mean, std, inputSize, minNum, maxNum, useThumbnail};
+
+    Acc::Tensor accTensor;
+    Acc::ErrorCode ret = Acc::FusionOperator::InternVL2ImagePreprocess(internalImage, config, accTensor);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Failed to preprocess image data. Please see above log for detail.");
+    }
+
+    Tensor pyTensor;
+    pyTensor.SetTensor(accTensor);
+    return pyTensor;
+}
+
+InternVL2TokenEstimate InternVL2Processor::EstimateTokens(size_t width, size_t height, int inputSize, int minNum,
+                                                          int maxNum, bool useThumbnail, size_t tokensPerTile)
+{
+    Acc::InternVL2PreprocessConfig config{{}, {}, inputSize, minNum, maxNum, useThumbnail};
+
+    InternVL2TokenEstimate result;
+    Acc::ErrorCode ret = Acc::FusionOperator::InternVL2EstimateTokens(height, width, config, tokensPerTile,
+                                                                      result.num_tiles, result.num_tokens);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Failed to estimate tokens. Please see above log for detail.");
+    }
+    return result;
+}
+
+Tensor ClipProcessor::Preprocess(const std::vector<Image>& pyImages, const std::vector<float>& mean,
+                                 const std::vector<float>& std, int shortestEdge, int cropW, int cropH, int resizeW,
+                                 int resizeH)
+{
+    std::vector<std::shared_ptr<Acc::Image>> internalImages = GetInternalImages(pyImages);
+
+    Acc::ClipPreprocessConfig config{mean, std, shortestEdge, cropW, cropH, resizeW, resizeH};
+
+    Acc::Tensor accTensor;
+    Acc::ErrorCode ret = Acc::FusionOperator::ClipImagePreprocess(internalImages, config, accTensor);
+    if (ret != Acc::SUCCESS) {
+        throw std::runtime_error("Failed to preprocess image data. Please see above log for detail.");
+    }
+
+    Tensor pyTensor;
+    pyTensor.SetTensor(accTensor);
+    return pyTensor;
+}
+
 } // namespace PyAcc
@@ -36,6 +36,9 @@ Tensor Tensor::clone() const
 {
     Tensor tensor;
     Acc::ErrorCode ret = tensor_->Clone(*tensor.GetTensorPtr());
+    if (ret == Acc::SUCCESS && exported_) {
+        ret = tensor.GetTensorPtr()->MakeUnique();
+    }
     if (ret != Acc::SUCCESS) {
         Acc::LogError << "Tensor clone failed.";
         throw std::runtime_error("Tensor clone failed.");
@@ -64,15 +67,7 @@ Acc::DataType Tensor::Dtype() const
 
 const std::string& Tensor::Device()
 {
-    std::unique_ptr<char[]> device = tensor_->Device();
-    if (!device) {
-        Acc::LogError << "Get device string failed, may be caused by out of memory, please check the memory status of "
-                         "the environment.";
-        deviceStr_ = "";
-    } else {
-        std::string tmpStr(device.get());
-        deviceStr_ = tmpStr;
-    }
+    deviceStr_ = tensor_->Device();
     return deviceStr_;
 }
 
@@ -107,6 +102,11 @@ Tensor Tensor::from_numpy(PyObject* pyObj)
 
 PyObject* Tensor::numpy()
 {
+    // The returned array is writable, detach from any copy-on-write clone first
+    if (tensor_->MakeUnique() != Acc::SUCCESS) {
+        throw std::runtime_error("Failed to copy tensor data for numpy ndarray.");
+    }
+    exported_ = true;
     NumpyData numpyData;
     numpyData.dataType = tensor_->DType();
     numpyData.dataPtr = tensor_->Ptr();
@@ -122,10 +122,10 @@ PyObject* Tensor::numpy()
 }
 
 Tensor Tensor::normalize(const std::vector<float>& mean, const std::vector<float>& std,
-                         const Acc::DeviceMode deviceMode)
+                         const Acc::DeviceMode deviceMode, const Acc::DataType outputType)
 {
     Acc::Tensor outputAccTensor;
-    Acc::ErrorCode ret = Acc::TensorNormalize(*tensor_, outputAccTensor, mean, std, deviceMode);
+    Acc::ErrorCode ret = Acc::TensorNormalize(*tensor_, outputAccTensor, mean, std, deviceMode, outputType);
     if (ret != Acc::SUCCESS) {
         throw std::runtime_error("Failed to execute normalize operator, please ensure your inputs are valid.");
     }
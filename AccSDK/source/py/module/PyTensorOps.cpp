@@ -26,11 +26,12 @@
 
 namespace PyAcc {
     void normalize(const Tensor& src, Tensor& dst, const std::vector<float>& mean, const std::vector<float>& std,
-                   const Acc::DeviceMode deviceMode)
+                   const Acc::DeviceMode deviceMode, const Acc::DataType outputType)
     {
         std::shared_ptr<Acc::Tensor> srcAccTensor = src.GetTensorPtr();
         Acc::Tensor outputAccTensor;
-        Acc::ErrorCode ret = Acc::TensorNormalize(*srcAccTensor.get(), outputAccTensor, mean, std, deviceMode);
+        Acc::ErrorCode ret = Acc::TensorNormalize(*srcAccTensor.get(), outputAccTensor, mean, std, deviceMode,
+                                                    outputType);
         if (ret != Acc::SUCCESS) {
             throw std::runtime_error("Failed to execute normalize operator, please ensure your inputs are valid.");
         }
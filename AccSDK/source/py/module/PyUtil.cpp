@@ -35,12 +35,15 @@ namespace {
     const std::map<std::string, Acc::DataType> FORMAT_TO_DATA_TYPE_MAP = {
         {"<i1", Acc::DataType::INT8}, {"|i1", Acc::DataType::INT8}, {">i1", Acc::DataType::INT8},
         {"<u1", Acc::DataType::UINT8}, {"|u1", Acc::DataType::UINT8}, {">u1", Acc::DataType::UINT8},
-        {"<f4", Acc::DataType::FLOAT32}, {"|f4", Acc::DataType::FLOAT32}, {">f4", Acc::DataType::FLOAT32}
+        {"<f4", Acc::DataType::FLOAT32}, {"|f4", Acc::DataType::FLOAT32}, {">f4", Acc::DataType::FLOAT32},
+        {"<f2", Acc::DataType::FLOAT16}, {"|f2", Acc::DataType::FLOAT16}
     };
     const std::map<Acc::DataType, std::string> DATA_TYPE_TO_FORMAT = {
         {Acc::DataType::INT8, "|i1"},
         {Acc::DataType::UINT8, "|u1"},
-        {Acc::DataType::FLOAT32, "<f4"} // Little-endian
+        {Acc::DataType::FLOAT32, "<f4"}, // Little-endian
+        {Acc::DataType::FLOAT16, "<f2"},
+        {Acc::DataType::BFLOAT16, "<u2"} // numpy has no bfloat16, the raw bits are exposed as uint16
     };
 }
 namespace PyAcc {
@@ -189,4 +192,28 @@ namespace PyAcc {
         Py_DECREF(interface);
         return obj;
     }
-}
\ No newline at end of file
+
+    PyBufferView::PyBufferView(PyObject* pyObj)
+    {
+        if (pyObj == nullptr || PyObject_GetBuffer(pyObj, &view_, PyBUF_SIMPLE) != 0) {
+            PyErr_Clear();
+            throw std::runtime_error("The input does not support the contiguous buffer protocol, "
+                                     "please pass bytes, bytearray, memoryview or a contiguous numpy array");
+        }
+    }
+
+    PyBufferView::~PyBufferView()
+    {
+        PyBuffer_Release(&view_);
+    }
+
+    const uint8_t* PyBufferView::Data() const
+    {
+        return static_cast<const uint8_t*>(view_.buf);
+    }
+
+    size_t PyBufferView::Size() const
+    {
+        return static_cast<size_t>(view_.len);
+    }
+}
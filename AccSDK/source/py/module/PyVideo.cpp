@@ -46,4 +46,19 @@ std::vector<Image> video_decode(const char* path, const char* device, const std:
     return result;
 }
 
+std::vector<VideoProbeInfo> probe_videos(const std::vector<std::string>& paths)
+{
+    std::vector<Acc::VideoProbeInfo> accInfos;
+    auto ret = Acc::ProbeVideos(paths, accInfos);
+    if (ret == Acc::ERR_INVALID_THREAD_POOL_STATUST) {
+        throw std::runtime_error("Failed to probe videos, please see above log for detail.");
+    }
+    std::vector<VideoProbeInfo> result(accInfos.size());
+    for (size_t i = 0; i < accInfos.size(); ++i) {
+        const auto& info = accInfos[i];
+        result[i] = {info.status, info.width, info.height, info.fps, info.duration, info.totalFrames};
+    }
+    return result;
+}
+
 } // namespace PyAcc
@@ -23,15 +23,18 @@
 #include <iostream>
 #include <numeric>
 #include <climits>
+#include <cstring>
 #include <algorithm>
 #include <iostream>
 #include "securec.h"
 #include "acc/utils/LogImpl.h"
 #include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/BufferPoolImpl.h"
 namespace {
 constexpr int32_t CAN_ACCESS_FLAG = 1;
 constexpr int32_t FOUR_DIM = 4;
 constexpr int32_t DEVICE_CPU = -1;
+constexpr const char* DEVICE_CPU_NAME = "cpu";
 } // namespace
 namespace Acc {
 void Tensor::FillAuxInfo()
@@ -59,7 +62,7 @@ void Tensor::FillAuxInfo()
     }
 }
 
-void Tensor::CheckTensorParams()
+void Tensor::CheckTensorParams(const char* device)
 {
     if (dataPtr_ == nullptr) {
         LogError << "Illegal data. Data should not be nullptr." << GetErrorInfo(ERR_INVALID_POINTER);
@@ -74,57 +77,86 @@ void Tensor::CheckTensorParams()
                  << GetErrorInfo(ERR_INVALID_PARAM);
         throw std::runtime_error("Invalid parameter.");
     }
-    if (device_ != "cpu") {
+    if (device == nullptr || std::strcmp(device, DEVICE_CPU_NAME) != 0) {
         LogError << "Illegal device. Only cpu are supported now." << GetErrorInfo(ERR_UNSUPPORTED_TYPE);
         throw std::runtime_error("Invalid parameter.");
     }
 }
 
-Tensor::Tensor(void* data, const std::vector<size_t>& shape, DataType dataType, TensorFormat format, const char* device)
+Tensor::Tensor(void* data, const TensorDims& shape, DataType dataType, TensorFormat format, const char* device)
     : deviceId_(DEVICE_CPU),
       shape_(shape),
       dataType_(dataType),
       format_(format),
       dataPtr_(std::shared_ptr<void>(data, [](void*) {})),
-      device_(device ? device : "")
+      device_(DeviceMode::CPU)
 {
-    CheckTensorParams();
+    CheckTensorParams(device);
     FillAuxInfo();
 }
 
-Tensor::Tensor(std::shared_ptr<void> dataPtr, const std::vector<size_t>& shape, DataType dataType, TensorFormat format,
+Tensor::Tensor(std::shared_ptr<void> dataPtr, const TensorDims& shape, DataType dataType, TensorFormat format,
                const char* device)
     : deviceId_(DEVICE_CPU),
       shape_(shape),
       dataType_(dataType),
       format_(format),
-      dataPtr_(dataPtr),
-      device_(device ? device : "")
+      dataPtr_(std::move(dataPtr)),
+      ownsData_(true),
+      device_(DeviceMode::CPU)
 {
-    CheckTensorParams();
+    CheckTensorParams(device);
     FillAuxInfo();
 }
 
-ErrorCode Tensor::Clone(Tensor& tensor) const
+ErrorCode Tensor::CopyData(std::shared_ptr<void>& dstPtr) const
 {
-    if (dataPtr_ == nullptr || auxInfo_.totalBytes == 0) {
-        LogWarn << "Current tensor is empty, the clone operation is invalid.";
-        return SUCCESS;
-    }
     // Malloc dst memory and copy scr memory to dst memory
-    char* data = new(std::nothrow) char[auxInfo_.totalBytes];
-    if (data == nullptr) {
+    if (AllocateBuffer(auxInfo_.totalBytes, dstPtr) != SUCCESS) {
         LogError << "Failed to malloc for tensor." << GetErrorInfo(ERR_BAD_ALLOC);
         return ERR_BAD_ALLOC;
     }
-    std::shared_ptr<void> dstPtr(static_cast<void*>(data), [](void* ptr) { delete[] static_cast<char*>(ptr); });
     auto ret = memcpy_s(dstPtr.get(), auxInfo_.totalBytes, dataPtr_.get(), auxInfo_.totalBytes);
     if (ret != SUCCESS) {
-        LogError << "Tensor clone failed, may be caused by out of memory, please check the memory status of the "
+        LogError << "Tensor data copy failed, may be caused by out of memory, please check the memory status of the "
                  << "environment." << GetErrorInfo(ERR_BAD_COPY);
         return ERR_BAD_COPY;
     }
-    tensor = Tensor(dstPtr, shape_, dataType_, format_, this->Device().get());
+    return SUCCESS;
+}
+
+ErrorCode Tensor::Clone(Tensor& tensor) const
+{
+    if (dataPtr_ == nullptr || auxInfo_.totalBytes == 0) {
+        LogWarn << "Current tensor is empty, the clone operation is invalid.";
+        return SUCCESS;
+    }
+    if (ownsData_) {
+        // Share the buffer, MakeUnique copies it once either side is written
+        tensor = *this;
+        return SUCCESS;
+    }
+    std::shared_ptr<void> dstPtr;
+    ErrorCode ret = CopyData(dstPtr);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    tensor = Tensor(dstPtr, shape_, dataType_, format_, this->Device());
+    return SUCCESS;
+}
+
+ErrorCode Tensor::MakeUnique()
+{
+    // User memory is never shared by Clone, copies of such a tensor are meant to alias it
+    if (!ownsData_ || dataPtr_ == nullptr || auxInfo_.totalBytes == 0 || dataPtr_.use_count() == 1) {
+        return SUCCESS;
+    }
+    std::shared_ptr<void> dstPtr;
+    ErrorCode ret = CopyData(dstPtr);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    dataPtr_ = std::move(dstPtr);
     return SUCCESS;
 }
 
@@ -146,7 +178,7 @@ ErrorCode Tensor::SetFormat(TensorFormat tensorFormat)
     return ERR_INVALID_PARAM;
 }
 
-const std::vector<size_t>& Tensor::Shape() const
+const TensorDims& Tensor::Shape() const
 {
     return shape_;
 }
@@ -156,17 +188,15 @@ DataType Tensor::DType() const
     return dataType_;
 }
 
-std::unique_ptr<char[]> Tensor::Device() const
+const char* Tensor::Device() const
 {
-    auto ptr = std::make_unique<char[]>(device_.size() + 1);
-    auto ret = strcpy_s(ptr.get(), device_.size() + 1, device_.c_str());
-    if (ret != 0) {
-        LogError << "Get device string failed, may be caused by out of memory, please check the memory status of the"
-                 << "environment." << GetErrorInfo(ERR_BAD_COPY);
-        return nullptr;
+    // only cpu is supported for now, the switch keeps the mapping in one place once more devices are added
+    switch (device_) {
+        case DeviceMode::CPU:
+        default:
+            return DEVICE_CPU_NAME;
     }
-    return ptr;
-};
+}
 
 TensorFormat Tensor::Format() const
 {
@@ -188,7 +218,7 @@ std::shared_ptr<void> Tensor::SharedPtr() const
     return dataPtr_;
 }
 
-TensorAuxInfo Tensor::AuxInfo() const
+const TensorAuxInfo& Tensor::AuxInfo() const
 {
     return auxInfo_;
 }
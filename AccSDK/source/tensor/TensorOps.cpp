@@ -59,9 +59,10 @@ ErrorCode TensorResize(const Tensor& src, Tensor& dst, size_t resizedH, size_t r
 }
 
 ErrorCode TensorNormalize(const Tensor& src, Tensor& dst, const std::vector<float>& mean, const std::vector<float>& std,
-                          DeviceMode deviceMode)
+                          DeviceMode deviceMode, DataType outputType)
 {
     NormalizeContext opCtx{{std::cref(src)}, {std::ref(dst)}, mean, std, deviceMode};
+    opCtx.outputType = outputType;
 
     ErrorCode ret = NormalizeChecker(OperatorId::NORMALIZE).CheckAndImplicitMalloc(opCtx);
     if (ret != SUCCESS) {
@@ -72,9 +73,11 @@ ErrorCode TensorNormalize(const Tensor& src, Tensor& dst, const std::vector<floa
     return accelerator.ExecuteOperator(OperatorId::NORMALIZE, opCtx);
 }
 
-ErrorCode TensorToTensor(const Tensor& src, Tensor& dst, TensorFormat format, DeviceMode deviceMode)
+ErrorCode TensorToTensor(const Tensor& src, Tensor& dst, TensorFormat format, DeviceMode deviceMode,
+                         DataType outputType)
 {
     ToTensorContext opCtx{{std::cref(src)}, {std::ref(dst)}, format, deviceMode};
+    opCtx.outputType = outputType;
 
     ErrorCode ret = ToTensorChecker(OperatorId::TOTENSOR).CheckAndImplicitMalloc(opCtx);
     if (ret != SUCCESS) {
@@ -28,6 +28,7 @@
 #include "acc/core/framework/OperatorContext.h"
 #include "acc/core/framework/OperatorIndex.h"
 #include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/BufferPoolImpl.h"
 namespace {
 using namespace Acc;
 constexpr size_t MIN_WIDTH = 10;
@@ -48,7 +49,13 @@ const TensorConstraint BASIC_TENSOR_CONSTRAINT = {"cpu",
 
 const TensorConstraint NORMALIZE_TENSOR_CONSTRAINT_CPU = {
     "cpu",
-    {DataType::FLOAT32},
+    {DataType::FLOAT32, DataType::UINT8},
+    {TensorFormat::NHWC, TensorFormat::NCHW},
+    {{"batch", EnumeratedConstraint{{1}}}, {"channel", EnumeratedConstraint{{3}}}}};
+
+const TensorConstraint NORMALIZE_OUTPUT_CONSTRAINT_CPU = {
+    "cpu",
+    {DataType::FLOAT32, DataType::FLOAT16, DataType::BFLOAT16},
     {TensorFormat::NHWC, TensorFormat::NCHW},
     {{"batch", EnumeratedConstraint{{1}}}, {"channel", EnumeratedConstraint{{3}}}}};
 
@@ -59,6 +66,25 @@ const TensorConstraint BASIC_QWENFUSION_CONSTRAINT = {"cpu",
                                                        {"width", RangeConstraint{MIN_WIDTH, MAX_WIDTH}},
                                                        {"channel", EnumeratedConstraint{{3}}}}};
 
+// Resized NHWC images, or flattened patch matrices that are only checked by the QwenFusion custom rules
+const TensorConstraint QWENFUSION_OUTPUT_CONSTRAINT = {"cpu",
+                                                       {DataType::UINT8, DataType::FLOAT32, DataType::FLOAT16,
+                                                        DataType::BFLOAT16},
+                                                       {TensorFormat::NHWC, TensorFormat::ND},
+                                                       {{"height", RangeConstraint{MIN_HEIGHT, MAX_HEIGHT}},
+                                                        {"width", RangeConstraint{MIN_WIDTH, MAX_WIDTH}},
+                                                        {"channel", EnumeratedConstraint{{3}}}}};
+
+const TensorConstraint INTERNVL2FUSION_OUTPUT_CONSTRAINT = {"cpu",
+                                                            {DataType::FLOAT32},
+                                                            {TensorFormat::NCHW},
+                                                            {{"channel", EnumeratedConstraint{{3}}}}};
+
+const TensorConstraint CLIPFUSION_OUTPUT_CONSTRAINT = {"cpu",
+                                                       {DataType::FLOAT32},
+                                                       {TensorFormat::NCHW},
+                                                       {{"channel", EnumeratedConstraint{{3}}}}};
+
 const TensorConstraint TO_TENSOR_INPUT_TENSOR_CONSTRAINT_CPU = {
     "cpu",
     {DataType::UINT8},
@@ -67,7 +93,7 @@ const TensorConstraint TO_TENSOR_INPUT_TENSOR_CONSTRAINT_CPU = {
 
 const TensorConstraint TO_TENSOR_OUTPUT_TENSOR_CONSTRAINT_CPU = {
     "cpu",
-    {DataType::FLOAT32},
+    {DataType::FLOAT32, DataType::FLOAT16, DataType::BFLOAT16},
     {TensorFormat::NHWC, TensorFormat::NCHW},
     {{"batch", EnumeratedConstraint{{1}}}, {"channel", EnumeratedConstraint{{3}}}}};
 
@@ -79,10 +105,18 @@ const OperatorTensorConstraints CPU_CROP_CONSTRAINT{{BASIC_TENSOR_CONSTRAINT}, {
 
 // normalize constraint
 const OperatorTensorConstraints CPU_NORMALIZE_CONSTRAINT{{NORMALIZE_TENSOR_CONSTRAINT_CPU},
-                                                         {NORMALIZE_TENSOR_CONSTRAINT_CPU}};
+                                                         {NORMALIZE_OUTPUT_CONSTRAINT_CPU}};
 
 // QwenFusion constraint
-const OperatorTensorConstraints CPU_QWENFUSION_CONSTRAINT{{BASIC_QWENFUSION_CONSTRAINT}, {BASIC_QWENFUSION_CONSTRAINT}};
+const OperatorTensorConstraints CPU_QWENFUSION_CONSTRAINT{{BASIC_QWENFUSION_CONSTRAINT},
+                                                          {QWENFUSION_OUTPUT_CONSTRAINT}};
+
+// InternVL2Fusion constraint
+const OperatorTensorConstraints CPU_INTERNVL2FUSION_CONSTRAINT{{BASIC_TENSOR_CONSTRAINT},
+                                                               {INTERNVL2FUSION_OUTPUT_CONSTRAINT}};
+
+// ClipFusion constraint
+const OperatorTensorConstraints CPU_CLIPFUSION_CONSTRAINT{{BASIC_TENSOR_CONSTRAINT}, {CLIPFUSION_OUTPUT_CONSTRAINT}};
 
 // normalize constraint
 const OperatorTensorConstraints CPU_TO_TENSOR_CONSTRAINT{{TO_TENSOR_INPUT_TENSOR_CONSTRAINT_CPU},
@@ -94,6 +128,8 @@ const std::unordered_map<OperatorId, OperatorTensorConstraints> OPERATOR_CONSTRA
     {OperatorId::RESIZE, CPU_CROP_CONSTRAINT},
     {OperatorId::NORMALIZE, CPU_NORMALIZE_CONSTRAINT},
     {OperatorId::QWENFUSION, CPU_QWENFUSION_CONSTRAINT},
+    {OperatorId::INTERNVL2FUSION, CPU_INTERNVL2FUSION_CONSTRAINT},
+    {OperatorId::CLIPFUSION, CPU_CLIPFUSION_CONSTRAINT},
     {OperatorId::TOTENSOR, CPU_TO_TENSOR_CONSTRAINT}};
 
 std::string DataTypeToString(DataType dt)
@@ -105,6 +141,10 @@ std::string DataTypeToString(DataType dt)
             return "UINT8";
         case DataType::FLOAT32:
             return "FLOAT32";
+        case DataType::FLOAT16:
+            return "FLOAT16";
+        case DataType::BFLOAT16:
+            return "BFLOAT16";
         default:
             return "UNKNOWN";
     }
@@ -185,7 +225,18 @@ ErrorCode OpsBaseChecker::CheckAndImplicitMalloc(const OperatorContext& ctx)
         return ret;
     }
     ret = ImplicitMalloc(ctx);
-    return ret;
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    // Kernels write preallocated outputs in place, detach them from copy-on-write clones first
+    for (size_t i = 0; i < ctx.outputTensorRefs.size(); i++) {
+        ret = ctx.outputTensorRefs[i].get().MakeUnique();
+        if (ret != SUCCESS) {
+            LogError << "Failed to copy the shared data of output " << i << "." << GetErrorInfo(ret);
+            return ret;
+        }
+    }
+    return SUCCESS;
 }
 
 ErrorCode OpsBaseChecker::CheckTensorDimension(
@@ -236,8 +287,8 @@ ErrorCode OpsBaseChecker::CheckTensorDimension(
 
 ErrorCode OpsBaseChecker::CheckTensorAttributes(const Tensor& tensor, const TensorConstraint& tensorConstraint) const
 {
-    if (std::strcmp(tensor.Device().get(), tensorConstraint.device.c_str()) != 0) {
-        LogError << "The device of current input/output is not required. Current device is " << tensor.Device().get()
+    if (std::strcmp(tensor.Device(), tensorConstraint.device.c_str()) != 0) {
+        LogError << "The device of current input/output is not required. Current device is " << tensor.Device()
                  << ", but the expected device is " << tensorConstraint.device.c_str() << "."
                  << GetErrorInfo(ERR_INVALID_PARAM);
         return ERR_INVALID_PARAM;
@@ -347,14 +398,13 @@ ErrorCode OpsBaseChecker::ImplicitMalloc(const OperatorContext& ctx)
             LogError << "The data size of input should not be 0." << GetErrorInfo(ERR_INVALID_PARAM);
             return ERR_INVALID_PARAM;
         }
-        char* data = new(std::nothrow) char[totalBytes];
-        if (data == nullptr) {
+        std::shared_ptr<void> dstPtr;
+        if (AllocateBuffer(totalBytes, dstPtr) != SUCCESS) {
             LogError << "Failed to malloc for tensor." << GetErrorInfo(ERR_BAD_ALLOC);
             return ERR_BAD_ALLOC;
         }
-        std::shared_ptr<void> dstPtr(static_cast<void*>(data), [](void* ptr) { delete[] static_cast<char*>(ptr); });
         ctx.outputTensorRefs[i].get() =
-            Tensor(dstPtr, inferShape, inferDatatype, inferFromat, ctx.inputTensorRefs[0].get().Device().get());
+            Tensor(dstPtr, inferShape, inferDatatype, inferFromat, ctx.inputTensorRefs[0].get().Device());
     }
     return SUCCESS;
 }
@@ -20,10 +20,12 @@
  * History: NA
  */
 #include "acc/tensor/OpsCustomChecker.h"
+#include <algorithm>
 #include <numeric>
 #include "acc/utils/LogImpl.h"
 #include "acc/core/framework/OperatorContext.h"
 #include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/BufferPoolImpl.h"
 using namespace Acc;
 
 namespace {
@@ -36,6 +38,8 @@ constexpr size_t CHANNEL_INDEX_NCHW = 1;
 constexpr size_t MAX_WIDTH = 8192;
 constexpr size_t MAX_HEIGHT = 8192;
 constexpr size_t MEAN_STD_SIZE = 3;
+constexpr int QWEN_TEMPORAL_PATCH_SIZE = 2;
+constexpr size_t QWEN_CHANNEL_NUM = 3;
 } // namespace
 
 namespace Acc {
@@ -70,6 +74,16 @@ ErrorCode CheckCropInputOutputConsistency(const CropContext& ctx)
     }
     return SUCCESS;
 }
+
+ErrorCode CheckFloatOutputType(DataType outputType)
+{
+    if (outputType != DataType::FLOAT32 && outputType != DataType::FLOAT16 && outputType != DataType::BFLOAT16) {
+        LogError << "The output data type is invalid, it must be in [FLOAT32/FLOAT16/BFLOAT16]."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    return SUCCESS;
+}
 } // namespace
 ErrorCode ResizeChecker::CheckCustomRules(const OperatorContext& ctx)
 {
@@ -136,13 +150,12 @@ ErrorCode ResizeChecker::ImplicitMalloc(const OperatorContext& ctx)
     auto totalBytes =
         std::accumulate(dstShape.begin(), dstShape.end(), static_cast<size_t>(1), std::multiplies<size_t>()) *
         GetByteSize(src.DType());
-    char* data = new(std::nothrow) char[totalBytes];
-    if (data == nullptr) {
+    std::shared_ptr<void> dstPtr;
+    if (AllocateBuffer(totalBytes, dstPtr) != SUCCESS) {
         LogError << "Failed to malloc for tensor." << GetErrorInfo(ERR_BAD_ALLOC);
         return ERR_BAD_ALLOC;
     }
-    std::shared_ptr<void> dstPtr(static_cast<void*>(data), [](void* ptr) { delete[] static_cast<char*>(ptr); });
-    resizeCtx->outputTensorRefs[0].get() = Tensor(dstPtr, dstShape, src.DType(), src.Format(), src.Device().get());
+    resizeCtx->outputTensorRefs[0].get() = Tensor(dstPtr, dstShape, src.DType(), src.Format(), src.Device());
     return SUCCESS;
 }
 
@@ -203,13 +216,12 @@ ErrorCode CropChecker::ImplicitMalloc(const OperatorContext& ctx)
     auto totalBytes =
         std::accumulate(dstShape.begin(), dstShape.end(), static_cast<size_t>(1), std::multiplies<size_t>()) *
         GetByteSize(src.DType());
-    char* data = new(std::nothrow) char[totalBytes];
-    if (data == nullptr) {
+    std::shared_ptr<void> dstPtr;
+    if (AllocateBuffer(totalBytes, dstPtr) != SUCCESS) {
         LogError << "Failed to malloc for tensor." << GetErrorInfo(ERR_BAD_ALLOC);
         return ERR_BAD_ALLOC;
     }
-    std::shared_ptr<void> dstPtr(static_cast<void*>(data), [](void* ptr) { delete[] static_cast<char*>(ptr); });
-    cropCtx->outputTensorRefs[0].get() = Tensor(dstPtr, dstShape, src.DType(), src.Format(), src.Device().get());
+    cropCtx->outputTensorRefs[0].get() = Tensor(dstPtr, dstShape, src.DType(), src.Format(), src.Device());
     return SUCCESS;
 }
 
@@ -225,6 +237,9 @@ ErrorCode NormalizeChecker::CheckCustomRules(const Acc::OperatorContext& ctx)
         LogError << "Unsupported device mode, only support CPU mode." << GetErrorInfo(ERR_UNSUPPORTED_TYPE);
         return ERR_UNSUPPORTED_TYPE;
     }
+    if (CheckFloatOutputType(normalizeCtx->outputType) != SUCCESS) {
+        return ERR_INVALID_PARAM;
+    }
 
     for (size_t i = 0; i < normalizeCtx->inputTensorRefs.size(); i++) {
         auto tensor = normalizeCtx->inputTensorRefs[i].get();
@@ -251,10 +266,16 @@ ErrorCode QwenFusionChecker::CheckCustomRules(const OperatorContext& ctx)
         return ERR_INVALID_POINTER;
     }
     size_t numInputs = ctx.inputTensorRefs.size();
-    if (numInputs == 0 || ctx.outputTensorRefs.size() != numInputs) {
+    size_t numOutputs = qwenCtx->mergeFrames ? 1 : numInputs;
+    if (numInputs == 0 || ctx.outputTensorRefs.size() != numOutputs) {
         LogError << "Input/Output size mismatch, please check." << GetErrorInfo(ERR_INVALID_PARAM);
         return ERR_INVALID_PARAM;
     }
+    if (qwenCtx->mergeFrames && (!qwenCtx->flattenPatches || !qwenCtx->resizeSizes.empty())) {
+        LogError << "Merged video frames are only supported for flattened patches with one resize size."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
 
     if (qwenCtx->mean.size() != MEAN_STD_SIZE) {
         LogError << "The input mean's size must be 3, please check." << GetErrorInfo(ERR_INVALID_PARAM);
@@ -264,12 +285,24 @@ ErrorCode QwenFusionChecker::CheckCustomRules(const OperatorContext& ctx)
         LogError << "The input std's size must be 3, please check." << GetErrorInfo(ERR_INVALID_PARAM);
         return ERR_INVALID_PARAM;
     }
-    if (static_cast<size_t>(qwenCtx->resizeH) > MAX_HEIGHT || static_cast<size_t>(qwenCtx->resizeH) < MIN_HEIGHT ||
-        static_cast<size_t>(qwenCtx->resizeW) > MAX_WIDTH || static_cast<size_t>(qwenCtx->resizeW) < MIN_WIDTH) {
-        LogError << "Current resize width is " << qwenCtx->resizeW << ", height is " << qwenCtx->resizeH
-                 << ", but should be range from [" << MIN_WIDTH << "," << MIN_HEIGHT << "] to [" << MAX_WIDTH << ","
-                 << MAX_HEIGHT << "]." << GetErrorInfo(ERR_OUT_OF_RANGE);
-        return ERR_OUT_OF_RANGE;
+    if (CheckFloatOutputType(qwenCtx->outputType) != SUCCESS) {
+        return ERR_INVALID_PARAM;
+    }
+    if (!qwenCtx->resizeSizes.empty() && qwenCtx->resizeSizes.size() != numInputs) {
+        LogError << "The number of resize sizes " << qwenCtx->resizeSizes.size() << " should be equal to the "
+                 << "number of inputs " << numInputs << "." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    for (size_t i = 0; i < numInputs; ++i) {
+        int resizeH = qwenCtx->ResizeHOf(i);
+        int resizeW = qwenCtx->ResizeWOf(i);
+        if (resizeH < 0 || static_cast<size_t>(resizeH) > MAX_HEIGHT || static_cast<size_t>(resizeH) < MIN_HEIGHT ||
+            resizeW < 0 || static_cast<size_t>(resizeW) > MAX_WIDTH || static_cast<size_t>(resizeW) < MIN_WIDTH) {
+            LogError << "Current resize width of input " << i << " is " << resizeW << ", height is " << resizeH
+                     << ", but should be range from [" << MIN_WIDTH << "," << MIN_HEIGHT << "] to [" << MAX_WIDTH
+                     << "," << MAX_HEIGHT << "]." << GetErrorInfo(ERR_OUT_OF_RANGE);
+            return ERR_OUT_OF_RANGE;
+        }
     }
     for (size_t i = 0; i < qwenCtx->std.size(); ++i) {
         if (qwenCtx->std[i] <= 0.0f) {
@@ -278,6 +311,71 @@ ErrorCode QwenFusionChecker::CheckCustomRules(const OperatorContext& ctx)
             return ERR_INVALID_PARAM;
         }
     }
+    if (qwenCtx->flattenPatches) {
+        return CheckQwenPatchRules(*qwenCtx);
+    }
+    return SUCCESS;
+}
+
+ErrorCode QwenFusionChecker::CheckQwenPatchRules(const QwenFusionContext& qwenCtx)
+{
+    if (qwenCtx.temporalPatchSize != QWEN_TEMPORAL_PATCH_SIZE) {
+        LogError << "The temporal patch size must be " << QWEN_TEMPORAL_PATCH_SIZE << ", but get "
+                 << qwenCtx.temporalPatchSize << "." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (qwenCtx.patchSize <= 0 || qwenCtx.mergeSize <= 0) {
+        LogError << "The patch size and merge size must be > 0, but get " << qwenCtx.patchSize << " and "
+                 << qwenCtx.mergeSize << "." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    const auto& firstShape = qwenCtx.inputTensorRefs[0].get().Shape();
+    for (size_t i = 1; qwenCtx.mergeFrames && i < qwenCtx.inputTensorRefs.size(); ++i) {
+        if (qwenCtx.inputTensorRefs[i].get().Shape() != firstShape ||
+            qwenCtx.inputTensorRefs[i].get().DType() != qwenCtx.inputTensorRefs[0].get().DType()) {
+            LogError << "Video frame " << i << " should have the shape and data type of the first frame."
+                     << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+    }
+    int factor = qwenCtx.patchSize * qwenCtx.mergeSize;
+    for (size_t i = 0; i < qwenCtx.inputTensorRefs.size(); ++i) {
+        if (qwenCtx.ResizeHOf(i) % factor != 0 || qwenCtx.ResizeWOf(i) % factor != 0) {
+            LogError << "The resize width " << qwenCtx.ResizeWOf(i) << " and height " << qwenCtx.ResizeHOf(i)
+                     << " of input " << i << " must be multiples of patch size * merge size (" << factor << ")."
+                     << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+    }
+    return CheckQwenPatchOutputs(qwenCtx);
+}
+
+ErrorCode QwenFusionChecker::CheckQwenPatchOutputs(const QwenFusionContext& qwenCtx)
+{
+    auto temporal = static_cast<size_t>(qwenCtx.temporalPatchSize);
+    auto patch = static_cast<size_t>(qwenCtx.patchSize);
+    for (size_t i = 0; i < qwenCtx.outputTensorRefs.size(); ++i) {
+        const Tensor& output = qwenCtx.outputTensorRefs[i].get();
+        if (output.Ptr() == nullptr) {
+            continue;
+        }
+        // a preallocated output receives the patches in place, so it must have exactly their shape
+        size_t numSamples = 0;
+        size_t end = qwenCtx.mergeFrames ? qwenCtx.inputTensorRefs.size() : i + 1;
+        for (size_t j = qwenCtx.mergeFrames ? 0 : i; j < end; ++j) {
+            const auto& inputShape = qwenCtx.inputTensorRefs[j].get().Shape();
+            numSamples += inputShape.empty() ? 1 : std::max<size_t>(inputShape[0], 1);
+        }
+        std::vector<size_t> expected = {(numSamples + temporal - 1) / temporal *
+                                            (static_cast<size_t>(qwenCtx.ResizeHOf(i)) / patch) *
+                                            (static_cast<size_t>(qwenCtx.ResizeWOf(i)) / patch),
+                                        QWEN_CHANNEL_NUM * temporal * patch * patch};
+        if (output.Shape() != expected || output.DType() != qwenCtx.outputType) {
+            LogError << "The preallocated output " << i << " should have shape (" << expected[0] << ", "
+                     << expected[1] << ") and the configured output data type." << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+    }
     return SUCCESS;
 }
 
@@ -291,21 +389,206 @@ ErrorCode QwenFusionChecker::ImplicitMalloc(const OperatorContext& ctx)
         LogDebug << "The class of ctx is wrong, please check." << GetErrorInfo(ERR_INVALID_POINTER);
         return ERR_INVALID_POINTER;
     }
+    // The flattened patches are produced by the fused operator itself.
+    if (qwenCtx->flattenPatches) {
+        return SUCCESS;
+    }
     auto src = qwenCtx->inputTensorRefs[0].get();
     auto heightIndex = HEIGHT_INDEX_NHWC;
     std::vector<size_t> dstShape = src.Shape();
-    dstShape[heightIndex] = qwenCtx->resizeH;
-    dstShape[heightIndex + 1] = qwenCtx->resizeW;
+    dstShape[heightIndex] = static_cast<size_t>(qwenCtx->ResizeHOf(0));
+    dstShape[heightIndex + 1] = static_cast<size_t>(qwenCtx->ResizeWOf(0));
     auto totalBytes =
         std::accumulate(dstShape.begin(), dstShape.end(), static_cast<size_t>(1), std::multiplies<size_t>()) *
         GetByteSize(src.DType());
-    char* data = new(std::nothrow) char[totalBytes];
-    if (data == nullptr) {
+    std::shared_ptr<void> dstPtr;
+    if (AllocateBuffer(totalBytes, dstPtr) != SUCCESS) {
+        LogError << "Failed to malloc for tensor." << GetErrorInfo(ERR_BAD_ALLOC);
+        return ERR_BAD_ALLOC;
+    }
+    qwenCtx->outputTensorRefs[0].get() = Tensor(dstPtr, dstShape, src.DType(), src.Format(), src.Device());
+    return SUCCESS;
+}
+
+ErrorCode ClipFusionChecker::CheckCustomRules(const OperatorContext& ctx)
+{
+    const auto* clipCtx = dynamic_cast<const ClipFusionContext*>(&ctx);
+    if (clipCtx == nullptr) {
+        LogDebug << "The class of ctx is wrong, please check." << GetErrorInfo(ERR_INVALID_POINTER);
+        return ERR_INVALID_POINTER;
+    }
+    if (ctx.inputTensorRefs.empty() || ctx.outputTensorRefs.size() != 1) {
+        LogError << "ClipFusion needs at least one input and exactly one output, please check."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (clipCtx->mean.size() != MEAN_STD_SIZE || clipCtx->std.size() != MEAN_STD_SIZE) {
+        LogError << "The input mean's and std's size must be 3, please check." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    for (size_t i = 0; i < clipCtx->std.size(); ++i) {
+        if (clipCtx->std[i] <= 0.0f) {
+            LogError << "Invalid input: std values must all be > 0. "
+                     << "(index " << i << ", std=" << clipCtx->std[i] << ")" << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+    }
+    if (clipCtx->cropW < static_cast<int>(MIN_WIDTH) || clipCtx->cropW > static_cast<int>(MAX_WIDTH) ||
+        clipCtx->cropH < static_cast<int>(MIN_HEIGHT) || clipCtx->cropH > static_cast<int>(MAX_HEIGHT) ||
+        clipCtx->shortestEdge < std::min(clipCtx->cropW, clipCtx->cropH) ||
+        clipCtx->shortestEdge > static_cast<int>(std::min(MAX_WIDTH, MAX_HEIGHT))) {
+        LogError << "Current crop width is " << clipCtx->cropW << ", height is " << clipCtx->cropH
+                 << ", shortest edge is " << clipCtx->shortestEdge << ", but the crop should be range from ["
+                 << MIN_WIDTH << "," << MIN_HEIGHT << "] to [" << MAX_WIDTH << "," << MAX_HEIGHT
+                 << "] and not be larger than the shortest edge." << GetErrorInfo(ERR_OUT_OF_RANGE);
+        return ERR_OUT_OF_RANGE;
+    }
+    if ((clipCtx->resizeW != 0 || clipCtx->resizeH != 0) && (clipCtx->resizeW <= 0 || clipCtx->resizeH <= 0)) {
+        LogError << "The resize width " << clipCtx->resizeW << " and height " << clipCtx->resizeH
+                 << " should be both 0 or both > 0." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    const Tensor& first = ctx.inputTensorRefs[0].get();
+    for (size_t i = 0; i < ctx.inputTensorRefs.size(); ++i) {
+        const Tensor& src = ctx.inputTensorRefs[i].get();
+        auto shape = src.Shape();
+        if (src.DType() != first.DType() || src.Format() != first.Format() || shape.size() != first.Shape().size() ||
+            shape[0] != 1 || shape[CHANNEL_INDEX_NHWC] != MEAN_STD_SIZE) {
+            LogError << "Input " << i << " should be a single 3 channels image of the same type as input 0."
+                     << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+        if (shape[HEIGHT_INDEX_NHWC] < MIN_HEIGHT || shape[HEIGHT_INDEX_NHWC] > MAX_HEIGHT ||
+            shape[HEIGHT_INDEX_NHWC + 1] < MIN_WIDTH || shape[HEIGHT_INDEX_NHWC + 1] > MAX_WIDTH) {
+            LogError << "Input " << i << " has height " << shape[HEIGHT_INDEX_NHWC] << " and width "
+                     << shape[HEIGHT_INDEX_NHWC + 1] << ", but should be range from [" << MIN_WIDTH << ","
+                     << MIN_HEIGHT << "] to [" << MAX_WIDTH << "," << MAX_HEIGHT << "]."
+                     << GetErrorInfo(ERR_OUT_OF_RANGE);
+            return ERR_OUT_OF_RANGE;
+        }
+        auto resized = clipCtx->ResizedSizeOf(i);
+        if (resized.first < static_cast<size_t>(clipCtx->cropH) ||
+            resized.second < static_cast<size_t>(clipCtx->cropW) || resized.first > MAX_HEIGHT ||
+            resized.second > MAX_WIDTH) {
+            LogError << "The resized height " << resized.first << " and width " << resized.second << " of input " << i
+                     << " should cover the crop and not exceed [" << MAX_WIDTH << "," << MAX_HEIGHT << "]."
+                     << GetErrorInfo(ERR_OUT_OF_RANGE);
+            return ERR_OUT_OF_RANGE;
+        }
+    }
+    if (!outputMallocFlags_[0]) {
+        return SUCCESS;
+    }
+    auto& dst = clipCtx->outputTensorRefs[0].get();
+    std::vector<size_t> expectShape = {ctx.inputTensorRefs.size(), MEAN_STD_SIZE, static_cast<size_t>(clipCtx->cropH),
+                                       static_cast<size_t>(clipCtx->cropW)};
+    if (dst.Shape() != expectShape) {
+        LogError << "The shape of dst should be (" << expectShape[0] << ", 3, " << clipCtx->cropH << ", "
+                 << clipCtx->cropW << ")." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    return SUCCESS;
+}
+
+ErrorCode ClipFusionChecker::ImplicitMalloc(const OperatorContext& ctx)
+{
+    if (outputMallocFlags_[0]) {
+        return SUCCESS;
+    }
+    const auto* clipCtx = dynamic_cast<const ClipFusionContext*>(&ctx);
+    if (clipCtx == nullptr) {
+        LogDebug << "The class of ctx is wrong, please check." << GetErrorInfo(ERR_INVALID_POINTER);
+        return ERR_INVALID_POINTER;
+    }
+    auto& src = clipCtx->inputTensorRefs[0].get();
+    std::vector<size_t> dstShape = {clipCtx->inputTensorRefs.size(), MEAN_STD_SIZE,
+                                    static_cast<size_t>(clipCtx->cropH), static_cast<size_t>(clipCtx->cropW)};
+    auto totalBytes =
+        std::accumulate(dstShape.begin(), dstShape.end(), static_cast<size_t>(1), std::multiplies<size_t>()) *
+        GetByteSize(DataType::FLOAT32);
+    std::shared_ptr<void> dstPtr;
+    if (AllocateBuffer(totalBytes, dstPtr) != SUCCESS) {
         LogError << "Failed to malloc for tensor." << GetErrorInfo(ERR_BAD_ALLOC);
         return ERR_BAD_ALLOC;
     }
-    std::shared_ptr<void> dstPtr(static_cast<void*>(data), [](void* ptr) { delete[] static_cast<char*>(ptr); });
-    qwenCtx->outputTensorRefs[0].get() = Tensor(dstPtr, dstShape, src.DType(), src.Format(), src.Device().get());
+    clipCtx->outputTensorRefs[0].get() =
+        Tensor(dstPtr, dstShape, DataType::FLOAT32, TensorFormat::NCHW, src.Device());
+    return SUCCESS;
+}
+
+ErrorCode InternVL2FusionChecker::CheckCustomRules(const OperatorContext& ctx)
+{
+    const auto* internCtx = dynamic_cast<const InternVL2FusionContext*>(&ctx);
+    if (internCtx == nullptr) {
+        LogDebug << "The class of ctx is wrong, please check." << GetErrorInfo(ERR_INVALID_POINTER);
+        return ERR_INVALID_POINTER;
+    }
+    if (ctx.inputTensorRefs.size() != 1 || ctx.outputTensorRefs.size() != 1) {
+        LogError << "InternVL2Fusion only supports one input and one output, please check."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    if (internCtx->mean.size() != MEAN_STD_SIZE || internCtx->std.size() != MEAN_STD_SIZE) {
+        LogError << "The input mean's and std's size must be 3, please check." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    for (size_t i = 0; i < internCtx->std.size(); ++i) {
+        if (internCtx->std[i] <= 0.0f) {
+            LogError << "Invalid input: std values must all be > 0. "
+                     << "(index " << i << ", std=" << internCtx->std[i] << ")" << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+    }
+    if (internCtx->gridW <= 0 || internCtx->gridH <= 0) {
+        LogError << "The tile grid must be positive, but get [" << internCtx->gridW << ", " << internCtx->gridH
+                 << "]." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    size_t inputSize = static_cast<size_t>(std::max(internCtx->inputSize, 0));
+    size_t resizedW = inputSize * static_cast<size_t>(internCtx->gridW);
+    size_t resizedH = inputSize * static_cast<size_t>(internCtx->gridH);
+    if (inputSize < MIN_WIDTH || resizedW > MAX_WIDTH || resizedH > MAX_HEIGHT) {
+        LogError << "Current tile grid resize width is " << resizedW << ", height is " << resizedH
+                 << ", but should be range from [" << MIN_WIDTH << "," << MIN_HEIGHT << "] to [" << MAX_WIDTH << ","
+                 << MAX_HEIGHT << "]." << GetErrorInfo(ERR_OUT_OF_RANGE);
+        return ERR_OUT_OF_RANGE;
+    }
+    if (!outputMallocFlags_[0]) {
+        return SUCCESS;
+    }
+    auto& dst = internCtx->outputTensorRefs[0].get();
+    std::vector<size_t> expectShape = {internCtx->NumTiles(), MEAN_STD_SIZE, inputSize, inputSize};
+    if (dst.Shape() != expectShape) {
+        LogError << "The shape of dst should be (" << expectShape[0] << ", 3, " << inputSize << ", " << inputSize
+                 << ")." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    return SUCCESS;
+}
+
+ErrorCode InternVL2FusionChecker::ImplicitMalloc(const OperatorContext& ctx)
+{
+    if (outputMallocFlags_[0]) {
+        return SUCCESS;
+    }
+    const auto* internCtx = dynamic_cast<const InternVL2FusionContext*>(&ctx);
+    if (internCtx == nullptr) {
+        LogDebug << "The class of ctx is wrong, please check." << GetErrorInfo(ERR_INVALID_POINTER);
+        return ERR_INVALID_POINTER;
+    }
+    auto& src = internCtx->inputTensorRefs[0].get();
+    auto inputSize = static_cast<size_t>(internCtx->inputSize);
+    std::vector<size_t> dstShape = {internCtx->NumTiles(), MEAN_STD_SIZE, inputSize, inputSize};
+    auto totalBytes =
+        std::accumulate(dstShape.begin(), dstShape.end(), static_cast<size_t>(1), std::multiplies<size_t>()) *
+        GetByteSize(DataType::FLOAT32);
+    std::shared_ptr<void> dstPtr;
+    if (AllocateBuffer(totalBytes, dstPtr) != SUCCESS) {
+        LogError << "Failed to malloc for tensor." << GetErrorInfo(ERR_BAD_ALLOC);
+        return ERR_BAD_ALLOC;
+    }
+    internCtx->outputTensorRefs[0].get() =
+        Tensor(dstPtr, dstShape, DataType::FLOAT32, TensorFormat::NCHW, src.Device());
     return SUCCESS;
 }
 
@@ -321,6 +604,9 @@ ErrorCode ToTensorChecker::CheckCustomRules(const Acc::OperatorContext& ctx)
         LogError << "The input format is invalid, it must be in [NHWC/NCHW]." << GetErrorInfo(ERR_INVALID_PARAM);
         return ERR_INVALID_PARAM;
     }
+    if (CheckFloatOutputType(toTensorCtx->outputType) != SUCCESS) {
+        return ERR_INVALID_PARAM;
+    }
 
     return SUCCESS;
 }
@@ -27,6 +27,7 @@
 #include <cstdint>
 #include <algorithm>
 #include <cstring>
+#include <functional>
 
 #include "securec.h"
 #include "acc/ErrorCode.h"
@@ -96,7 +97,7 @@ void ConvertPcm16ToFloatNeon(const uint8_t* raw, float* samples, size_t numSampl
     }
 }
 #else
-void ConvertPcm16ToFloatScalar(const uint8_t* raw, std::vector<float>& samples, size_t numSamples)
+void ConvertPcm16ToFloatScalar(const uint8_t* raw, float* samples, size_t numSamples)
 {
     constexpr size_t bytesPerSample = 16 / 8;
     constexpr float scale = 1.0f / PCM16_MAX_ABS_VALUE;
@@ -176,13 +177,13 @@ void ConvertPcm32ToFloatScalar(const uint8_t* raw, float* samples, size_t numSam
 }
 #endif
 
-ErrorCode ConvertFloat32(const std::vector<uint8_t>& raw, std::vector<float>& samples)
+ErrorCode ConvertFloat32(const uint8_t* raw, size_t rawSize, std::vector<float>& samples)
 {
     size_t target_size_bytes = samples.size() * sizeof(float);
-    if (target_size_bytes < raw.size()) {
+    if (target_size_bytes < rawSize) {
         return ERR_INVALID_PARAM; // Buffer too small
     }
-    errno_t result = memcpy_s(samples.data(), target_size_bytes, raw.data(), target_size_bytes);
+    errno_t result = memcpy_s(samples.data(), target_size_bytes, raw, target_size_bytes);
     if (result != 0) {
         LogError << "memcpy_s failed: buffer overflow or invalid parameters." << GetErrorInfo(ERR_BAD_FREE);
         return ERR_BAD_FREE;
@@ -228,15 +229,16 @@ ErrorCode ConvertPcm32(const uint8_t* rawData, float* outputData, size_t expecte
     return SUCCESS;
 }
 
-ErrorCode ReadAndCheckRiffHeader(const std::vector<uint8_t>& data, size_t& offset)
+ErrorCode ReadAndCheckRiffHeader(const uint8_t* data, size_t size, size_t& offset)
 {
     constexpr size_t kRiffHeaderSize = 12;
     const size_t riffLen = 4;
     const size_t fileSizeLen = 4;
     const size_t waveLen = 4;
-    const uint8_t* ptr = data.data() + offset;
+    const uint8_t* ptr = data + offset;
 
-    if (std::memcmp(ptr, "RIFF", riffLen) != 0 || std::memcmp(ptr + riffLen + fileSizeLen, "WAVE", waveLen) != 0) {
+    if (offset + kRiffHeaderSize > size || std::memcmp(ptr, "RIFF", riffLen) != 0 ||
+        std::memcmp(ptr + riffLen + fileSizeLen, "WAVE", waveLen) != 0) {
         LogError << "Invalid RIFF/WAVE header" << GetErrorInfo(ERR_INVALID_PARAM);
         return ERR_INVALID_PARAM;
     }
@@ -245,20 +247,20 @@ ErrorCode ReadAndCheckRiffHeader(const std::vector<uint8_t>& data, size_t& offse
     return SUCCESS;
 }
 
-ErrorCode FindAndReadFmtChunk(const std::vector<uint8_t>& data, size_t& offset, WavFmt& fmt)
+ErrorCode FindAndReadFmtChunk(const uint8_t* data, size_t size, size_t& offset, WavFmt& fmt)
 {
     constexpr size_t kChunkIdSize = 4;
     constexpr size_t kChunkSizeField = 4;
     constexpr size_t kStandardFmtChunkSize = 16;
 
-    while (offset + kChunkIdSize + kChunkSizeField <= data.size()) {
-        const uint8_t* ptr = data.data() + offset;
+    while (offset + kChunkIdSize + kChunkSizeField <= size) {
+        const uint8_t* ptr = data + offset;
 
         const uint8_t* chunkId = ptr;
         offset += kChunkIdSize;
 
         uint32_t chunkSize;
-        errno_t result = memcpy_s(&chunkSize, kChunkSizeField, data.data() + offset, kChunkSizeField);
+        errno_t result = memcpy_s(&chunkSize, kChunkSizeField, data + offset, kChunkSizeField);
         if (result != 0) {
             LogError << "memcpy_s failed: buffer overflow or invalid parameters." << GetErrorInfo(ERR_BAD_FREE);
             return ERR_BAD_FREE;
@@ -266,12 +268,12 @@ ErrorCode FindAndReadFmtChunk(const std::vector<uint8_t>& data, size_t& offset,
         offset += kChunkSizeField;
 
         if (std::memcmp(chunkId, "fmt ", kChunkIdSize) == 0) {
-            if (chunkSize < kStandardFmtChunkSize || offset + kStandardFmtChunkSize > data.size()) {
+            if (chunkSize < kStandardFmtChunkSize || offset + kStandardFmtChunkSize > size) {
                 LogError << "Invalid fmt chunk size" << GetErrorInfo(ERR_INVALID_PARAM);
                 return ERR_INVALID_PARAM;
             }
 
-            errno_t result = memcpy_s(&fmt, kStandardFmtChunkSize, data.data() + offset, kStandardFmtChunkSize);
+            errno_t result = memcpy_s(&fmt, kStandardFmtChunkSize, data + offset, kStandardFmtChunkSize);
             if (result != 0) {
                 LogError << "memcpy_s failed: buffer overflow or invalid parameters." << GetErrorInfo(ERR_BAD_FREE);
                 return ERR_BAD_FREE;
@@ -292,19 +294,19 @@ ErrorCode FindAndReadFmtChunk(const std::vector<uint8_t>& data, size_t& offset,
     return ERR_INVALID_PARAM;
 }
 
-ErrorCode FindDataChunk(const std::vector<uint8_t>& data, size_t& offset, uint32_t& dataSize)
+ErrorCode FindDataChunk(const uint8_t* data, size_t size, size_t& offset, uint32_t& dataSize)
 {
     constexpr size_t kChunkIdSize = 4;
     constexpr size_t kChunkSizeField = 4;
 
-    while (offset + kChunkIdSize + kChunkSizeField <= data.size()) {
-        const uint8_t* ptr = data.data() + offset;
+    while (offset + kChunkIdSize + kChunkSizeField <= size) {
+        const uint8_t* ptr = data + offset;
 
         const uint8_t* chunkId = ptr;
         offset += kChunkIdSize;
 
         uint32_t chunkSize;
-        errno_t result = memcpy_s(&chunkSize, kChunkSizeField, data.data() + offset, kChunkSizeField);
+        errno_t result = memcpy_s(&chunkSize, kChunkSizeField, data + offset, kChunkSizeField);
         if (result != 0) {
             LogError << "memcpy_s failed: buffer overflow or invalid parameters." << GetErrorInfo(ERR_BAD_FREE);
             return ERR_BAD_FREE;
@@ -312,7 +314,7 @@ ErrorCode FindDataChunk(const std::vector<uint8_t>& data, size_t& offset, uint32
         offset += kChunkSizeField;
 
         if (std::memcmp(chunkId, "data", kChunkIdSize) == 0) {
-            if (offset + chunkSize > data.size()) {
+            if (offset + chunkSize > size) {
                 LogError << "Invalid data chunk size" << GetErrorInfo(ERR_INVALID_PARAM);
                 return ERR_INVALID_PARAM;
             }
@@ -340,6 +342,10 @@ ErrorCode CheckAudioFormat(const WavFmt& fmt)
         LogError << "Unsupported bit depth." << GetErrorInfo(ERR_INVALID_PARAM);
         return ERR_INVALID_PARAM;
     }
+    if (fmt.numChannels == 0) {
+        LogError << "Invalid audio channel number: 0." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
     return SUCCESS;
 }
 
@@ -349,12 +355,12 @@ const std::vector<AudioConvertEntry> gAudioConverters = {
     {WAVE_FORMAT_PCM, 32, ConvertPcm32},
 };
 
-ErrorCode ConvertAudioDataToFloat(const std::vector<uint8_t>& rawData, const WavFmt& fmt, uint32_t expectedSize,
+ErrorCode ConvertAudioDataToFloat(const uint8_t* rawData, size_t rawSize, const WavFmt& fmt, uint32_t expectedSize,
                                   std::vector<float>& samples)
 {
     if (fmt.audioFormat == WAVE_FORMAT_IEEE_FLOAT) {
         if (fmt.bitsPerSample == BITS_PER_SAMPLE_32) {
-            return ConvertFloat32(rawData, samples);
+            return ConvertFloat32(rawData, rawSize, samples);
         } else {
             LogError << "IEEE_FLOAT only supports 32-bit sample data." << GetErrorInfo(ERR_INVALID_PARAM);
             return ERR_INVALID_PARAM;
@@ -362,7 +368,7 @@ ErrorCode ConvertAudioDataToFloat(const std::vector<uint8_t>& rawData, const Wav
     } else if (fmt.audioFormat == WAVE_FORMAT_PCM) {
         for (const auto& entry : gAudioConverters) {
             if (entry.audioFormat == fmt.audioFormat && entry.bitsPerSample == fmt.bitsPerSample) {
-                return entry.convert(rawData.data(), samples.data(), expectedSize);
+                return entry.convert(rawData, samples.data(), expectedSize);
             }
         }
     }
@@ -372,11 +378,7 @@ ErrorCode ConvertAudioDataToFloat(const std::vector<uint8_t>& rawData, const Wav
     return ERR_INVALID_PARAM;
 }
 
-} // namespace
-
-namespace Acc {
-
-ErrorCode CheckSingleAudioInputs(const char* path, std::optional<int> sr)
+ErrorCode CheckSampleRate(std::optional<int> sr)
 {
     if (sr.has_value()) {
         int value = sr.value();
@@ -391,6 +393,18 @@ ErrorCode CheckSingleAudioInputs(const char* path, std::optional<int> sr)
             return ERR_INVALID_PARAM;
         }
     }
+    return SUCCESS;
+}
+} // namespace
+
+namespace Acc {
+
+ErrorCode CheckSingleAudioInputs(const char* path, std::optional<int> sr)
+{
+    ErrorCode ret = CheckSampleRate(sr);
+    if (ret != SUCCESS) {
+        return ret;
+    }
     if (path == nullptr) {
         LogError << "Path is null." << GetErrorInfo(ERR_INVALID_POINTER);
         return ERR_INVALID_POINTER;
@@ -418,6 +432,24 @@ ErrorCode CheckSingleAudioInputs(const char* path, std::optional<int> sr)
     return SUCCESS;
 }
 
+ErrorCode CheckAudioBufferInputs(const uint8_t* data, size_t size, std::optional<int> sr)
+{
+    ErrorCode ret = CheckSampleRate(sr);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    if (data == nullptr) {
+        LogError << "Audio buffer is null." << GetErrorInfo(ERR_INVALID_POINTER);
+        return ERR_INVALID_POINTER;
+    }
+    if (size == 0 || size > static_cast<size_t>(AUDIO_MAX_FILE_SIZE)) {
+        LogError << "The audio buffer size is out of range (0, " << AUDIO_MAX_FILE_SIZE << "]."
+                 << GetErrorInfo(ERR_INVALID_FILE_SIZE);
+        return ERR_INVALID_FILE_SIZE;
+    }
+    return SUCCESS;
+}
+
 ErrorCode MixChannelsInterleaved(float* output, const float* input, size_t numFrames, int numChannels)
 {
     if (numChannels == 0) {
@@ -462,22 +494,35 @@ ErrorCode MixChannelsInterleaved(float* output, const float* input, size_t numFr
     return SUCCESS;
 }
 
-ErrorCode AudioDecode(const char* filePath, AudioData& outputAudioData)
+ErrorCode MapAudioFile(const char* filePath, MappedFile& file, bool populate)
 {
-    std::vector<uint8_t> fileData;
+    return file.Open(filePath, static_cast<size_t>(AUDIO_MAX_FILE_SIZE), populate);
+}
 
-    ErrorCode ret = ReadFile(filePath, fileData, AUDIO_MAX_FILE_SIZE);
+ErrorCode AudioDecode(const char* filePath, AudioData& outputAudioData)
+{
+    // the wav parser reads the mapped file pages directly
+    MappedFile file;
+    ErrorCode ret = MapAudioFile(filePath, file);
     if (ret != SUCCESS) {
         return ret;
     }
+    return AudioDecode(file.Data(), file.Size(), outputAudioData);
+}
 
+ErrorCode AudioDecode(const uint8_t* data, size_t size, AudioData& outputAudioData)
+{
+    if (data == nullptr) {
+        LogError << "Audio data is null." << GetErrorInfo(ERR_INVALID_POINTER);
+        return ERR_INVALID_POINTER;
+    }
     size_t offset = 0;
-    ret = ReadAndCheckRiffHeader(fileData, offset);
+    ErrorCode ret = ReadAndCheckRiffHeader(data, size, offset);
     if (ret != SUCCESS)
         return ret;
 
     WavFmt fmt;
-    ret = FindAndReadFmtChunk(fileData, offset, fmt);
+    ret = FindAndReadFmtChunk(data, size, offset, fmt);
     if (ret != SUCCESS)
         return ret;
 
@@ -486,16 +531,17 @@ ErrorCode AudioDecode(const char* filePath, AudioData& outputAudioData)
         return ret;
 
     uint32_t dataSize;
-    ret = FindDataChunk(fileData, offset, dataSize);
+    ret = FindDataChunk(data, size, offset, dataSize);
     if (ret != SUCCESS)
         return ret;
 
-    std::vector<uint8_t> rawData(fileData.begin() + offset, fileData.begin() + offset + dataSize);
+    // the samples are converted straight from the input, the data chunk is not copied first
+    const uint8_t* rawData = data + offset;
     const uint32_t bytesPerSample = fmt.bitsPerSample / 8;
     const uint32_t numSamples = dataSize / (bytesPerSample * fmt.numChannels);
 
     std::vector<float> samples(numSamples * fmt.numChannels);
-    ret = ConvertAudioDataToFloat(rawData, fmt, numSamples * fmt.numChannels, samples);
+    ret = ConvertAudioDataToFloat(rawData, dataSize, fmt, numSamples * fmt.numChannels, samples);
     if (ret != SUCCESS)
         return ret;
 
@@ -503,4 +549,4 @@ ErrorCode AudioDecode(const char* filePath, AudioData& outputAudioData)
 
     return SUCCESS;
 }
-} // namespace Acc
\ No newline at end of file
+} // namespace Acc
@@ -0,0 +1,246 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: Base64 utils file.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#include "acc/utils/Base64Utils.h"
+
+#include <array>
+#include <cstring>
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#include "acc/utils/LogImpl.h"
+#include "acc/utils/ErrorCodeUtils.h"
+
+namespace {
+using namespace Acc;
+constexpr uint8_t INVALID_SEXTET = 0xFF;
+constexpr uint32_t INVALID_SEXTET_BITS = 0xC0; // set only for characters outside the alphabet
+constexpr char PADDING = '=';
+constexpr size_t MAX_PADDING = 2;
+constexpr size_t QUAD_CHARS = 4;
+constexpr size_t QUAD_BYTES = 3;
+constexpr size_t SEXTET_BITS = 6;
+constexpr size_t BYTE_BITS = 8;
+constexpr char DATA_URL_SCHEME[] = "data:";
+constexpr char DATA_URL_BASE64[] = ";base64";
+constexpr size_t DATA_URL_SCHEME_LEN = sizeof(DATA_URL_SCHEME) - 1;
+constexpr size_t DATA_URL_BASE64_LEN = sizeof(DATA_URL_BASE64) - 1;
+
+constexpr std::array<uint8_t, 256> MakeDecodeTable()
+{
+    std::array<uint8_t, 256> table{};
+    for (auto& value : table) {
+        value = INVALID_SEXTET;
+    }
+    constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (size_t i = 0; i + 1 < sizeof(alphabet); i++) {
+        table[static_cast<uint8_t>(alphabet[i])] = static_cast<uint8_t>(i);
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> DECODE_TABLE = MakeDecodeTable();
+
+// Skip "data:<mime type>;base64," when present, plain base64 is returned unchanged
+bool SkipDataUrlPrefix(const char*& text, size_t& length)
+{
+    if (length < DATA_URL_SCHEME_LEN || std::memcmp(text, DATA_URL_SCHEME, DATA_URL_SCHEME_LEN) != 0) {
+        return true;
+    }
+    const auto* comma = static_cast<const char*>(std::memchr(text, ',', length));
+    if (comma == nullptr) {
+        return false;
+    }
+    size_t headerLen = static_cast<size_t>(comma - text);
+    if (headerLen < DATA_URL_SCHEME_LEN + DATA_URL_BASE64_LEN ||
+        std::memcmp(comma - DATA_URL_BASE64_LEN, DATA_URL_BASE64, DATA_URL_BASE64_LEN) != 0) {
+        return false;
+    }
+    text = comma + 1;
+    length -= headerLen + 1;
+    return true;
+}
+
+// Decode whole quads, returns false on the first character outside the alphabet
+bool DecodeQuadsScalar(const uint8_t* src, size_t quads, uint8_t* dst)
+{
+    for (size_t q = 0; q < quads; q++) {
+        uint32_t a = DECODE_TABLE[src[0]];
+        uint32_t b = DECODE_TABLE[src[1]];
+        uint32_t c = DECODE_TABLE[src[2]];
+        uint32_t d = DECODE_TABLE[src[3]];
+        if (((a | b | c | d) & INVALID_SEXTET_BITS) != 0) {
+            return false;
+        }
+        uint32_t triple = (a << (3 * SEXTET_BITS)) | (b << (2 * SEXTET_BITS)) | (c << SEXTET_BITS) | d;
+        dst[0] = static_cast<uint8_t>(triple >> (2 * BYTE_BITS));
+        dst[1] = static_cast<uint8_t>(triple >> BYTE_BITS);
+        dst[2] = static_cast<uint8_t>(triple);
+        src += QUAD_CHARS;
+        dst += QUAD_BYTES;
+    }
+    return true;
+}
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+constexpr size_t SIMD_CHARS = 64;
+constexpr size_t SIMD_BYTES = 48;
+
+// Map one register of characters to sextets, invalid lanes are flagged in the returned mask
+inline uint8x16_t ToSextets(uint8x16_t chars, uint8x16_t& valid)
+{
+    uint8x16_t upper = vsubq_u8(chars, vdupq_n_u8('A'));
+    uint8x16_t lower = vsubq_u8(chars, vdupq_n_u8('a'));
+    uint8x16_t digit = vsubq_u8(chars, vdupq_n_u8('0'));
+    uint8x16_t isUpper = vcltq_u8(upper, vdupq_n_u8(26));
+    uint8x16_t isLower = vcltq_u8(lower, vdupq_n_u8(26));
+    uint8x16_t isDigit = vcltq_u8(digit, vdupq_n_u8(10));
+    uint8x16_t isPlus = vceqq_u8(chars, vdupq_n_u8('+'));
+    uint8x16_t isSlash = vceqq_u8(chars, vdupq_n_u8('/'));
+    uint8x16_t sextets = vandq_u8(upper, isUpper);
+    sextets = vorrq_u8(sextets, vandq_u8(vaddq_u8(lower, vdupq_n_u8(26)), isLower));
+    sextets = vorrq_u8(sextets, vandq_u8(vaddq_u8(digit, vdupq_n_u8(52)), isDigit));
+    sextets = vorrq_u8(sextets, vandq_u8(vdupq_n_u8(62), isPlus));
+    sextets = vorrq_u8(sextets, vandq_u8(vdupq_n_u8(63), isSlash));
+    valid = vandq_u8(valid, vorrq_u8(vorrq_u8(vorrq_u8(isUpper, isLower), vorrq_u8(isDigit, isPlus)), isSlash));
+    return sextets;
+}
+
+// Decode 64 characters per step, stops before a block holding an invalid character
+size_t DecodeBlocksSimd(const uint8_t* src, size_t quads, uint8_t* dst)
+{
+    size_t done = 0;
+    size_t blockQuads = SIMD_CHARS / QUAD_CHARS;
+    for (; done + blockQuads <= quads; done += blockQuads) {
+        uint8x16x4_t chars = vld4q_u8(src + done * QUAD_CHARS);
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+        uint8x16_t a = ToSextets(chars.val[0], valid);
+        uint8x16_t b = ToSextets(chars.val[1], valid);
+        uint8x16_t c = ToSextets(chars.val[2], valid);
+        uint8x16_t d = ToSextets(chars.val[3], valid);
+        if (vminvq_u8(valid) == 0) {
+            break;
+        }
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+        vst3q_u8(dst + done * QUAD_BYTES, bytes);
+    }
+    return done;
+}
+#elif defined(__AVX2__)
+constexpr size_t SIMD_CHARS = 32;
+constexpr size_t SIMD_STORE_BYTES = 32; // 24 decoded bytes plus 8 bytes overwritten by the next block
+
+// Decode 32 characters per step with the nibble lookup validation of Mula and Lemire, stops before a block holding
+// an invalid character. The last block that would store past the output is left to the scalar loop.
+size_t DecodeBlocksSimd(const uint8_t* src, size_t quads, uint8_t* dst)
+{
+    const __m256i lutLo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+                                           0x1B, 0x1B, 0x1B, 0x1A, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                           0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lutHi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                                           0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                           0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lutRoll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 19, 4,
+                                             -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask2F = _mm256_set1_epi8(0x2F);
+    const __m256i mergeSextets = _mm256_set1_epi32(0x01400140);
+    const __m256i mergePairs = _mm256_set1_epi32(0x00011000);
+    const __m256i packBytes = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5,
+                                               4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i packLanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+    size_t done = 0;
+    size_t blockQuads = SIMD_CHARS / QUAD_CHARS;
+    size_t outBytes = quads * QUAD_BYTES;
+    for (; done + blockQuads <= quads && done * QUAD_BYTES + SIMD_STORE_BYTES <= outBytes; done += blockQuads) {
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + done * QUAD_CHARS));
+        __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), mask2F);
+        __m256i loNibbles = _mm256_and_si256(chars, mask2F);
+        __m256i lo = _mm256_shuffle_epi8(lutLo, loNibbles);
+        __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+        if (!_mm256_testz_si256(lo, hi)) {
+            break;
+        }
+        __m256i eq2F = _mm256_cmpeq_epi8(chars, mask2F);
+        __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(eq2F, hiNibbles));
+        __m256i sextets = _mm256_add_epi8(chars, roll);
+        __m256i pairs = _mm256_maddubs_epi16(sextets, mergeSextets);
+        __m256i triples = _mm256_madd_epi16(pairs, mergePairs);
+        __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(triples, packBytes), packLanes);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + done * QUAD_BYTES), bytes);
+    }
+    return done;
+}
+#else
+size_t DecodeBlocksSimd(const uint8_t*, size_t, uint8_t*)
+{
+    return 0;
+}
+#endif
+} // namespace
+
+namespace Acc {
+ErrorCode Base64Decode(const char* text, size_t length, std::vector<uint8_t>& decoded)
+{
+    if (text == nullptr) {
+        LogError << "Base64 text is nullptr." << GetErrorInfo(ERR_INVALID_POINTER);
+        return ERR_INVALID_POINTER;
+    }
+    if (!SkipDataUrlPrefix(text, length)) {
+        LogError << "Invalid data url, only base64 data urls are supported." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    for (size_t i = 0; i < MAX_PADDING && length > 0 && text[length - 1] == PADDING; i++) {
+        length--;
+    }
+    size_t quads = length / QUAD_CHARS;
+    size_t tailChars = length % QUAD_CHARS;
+    if (tailChars == 1) {
+        LogError << "Invalid base64 length." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    // two or three trailing characters carry one or two bytes
+    size_t tailBytes = tailChars == 0 ? 0 : tailChars - 1;
+    decoded.resize(quads * QUAD_BYTES + tailBytes);
+    const auto* src = reinterpret_cast<const uint8_t*>(text);
+    size_t done = DecodeBlocksSimd(src, quads, decoded.data());
+    bool valid = DecodeQuadsScalar(src + done * QUAD_CHARS, quads - done, decoded.data() + done * QUAD_BYTES);
+    if (valid && tailChars != 0) {
+        // pad the last partial quad with 'A', which decodes to zero bits
+        uint8_t lastQuad[QUAD_CHARS] = {'A', 'A', 'A', 'A'};
+        std::memcpy(lastQuad, src + quads * QUAD_CHARS, tailChars);
+        uint8_t lastBytes[QUAD_BYTES];
+        valid = DecodeQuadsScalar(lastQuad, 1, lastBytes);
+        std::memcpy(decoded.data() + quads * QUAD_BYTES, lastBytes, tailBytes);
+    }
+    if (!valid) {
+        decoded.clear();
+        LogError << "Invalid base64 text, found a character outside the standard alphabet."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    return SUCCESS;
+}
+} // namespace Acc
@@ -0,0 +1,287 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: Buffer pool file.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#include "acc/utils/BufferPoolImpl.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+#include <sys/mman.h>
+#include "acc/utils/LogImpl.h"
+#include "acc/utils/ErrorCodeUtils.h"
+
+namespace {
+using namespace Acc;
+constexpr size_t BUFFER_ALIGNMENT = 64;
+constexpr size_t MIN_POOLED_BYTES = 64 * 1024;         // smaller buffers are cheap for malloc, they are not kept
+constexpr size_t CLASS_STEPS = 4;                      // size classes per power of two, at most 25% is wasted
+constexpr size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+constexpr size_t DEFAULT_POOL_CAPACITY = 512 * 1024 * 1024; // 512MB
+
+size_t RoundUp(size_t bytes, size_t step)
+{
+    return (bytes + step - 1) / step * step;
+}
+
+size_t SizeClass(size_t bytes)
+{
+    if (bytes < MIN_POOLED_BYTES) {
+        return RoundUp(bytes, BUFFER_ALIGNMENT);
+    }
+    size_t floorPow2 = static_cast<size_t>(1) << (63 - __builtin_clzll(static_cast<unsigned long long>(bytes)));
+    return RoundUp(bytes, floorPow2 / CLASS_STEPS);
+}
+
+class DefaultAllocator : public BufferAllocator {
+public:
+    void* Allocate(size_t bytes) override
+    {
+        return ::operator new(bytes, std::align_val_t(BUFFER_ALIGNMENT), std::nothrow);
+    }
+
+    void Deallocate(void* ptr, size_t) override
+    {
+        ::operator delete(ptr, std::align_val_t(BUFFER_ALIGNMENT));
+    }
+};
+
+class HugePageAllocator : public DefaultAllocator {
+public:
+    void* Allocate(size_t bytes) override
+    {
+        if (bytes < HUGE_PAGE_BYTES) {
+            return DefaultAllocator::Allocate(bytes);
+        }
+        size_t alignedBytes = RoundUp(bytes, HUGE_PAGE_BYTES);
+        void* ptr = std::aligned_alloc(HUGE_PAGE_BYTES, alignedBytes);
+        if (ptr != nullptr) {
+            // only a hint, the memory is usable with normal pages when transparent huge pages are disabled
+            madvise(ptr, alignedBytes, MADV_HUGEPAGE);
+        }
+        return ptr;
+    }
+
+    void Deallocate(void* ptr, size_t bytes) override
+    {
+        if (bytes < HUGE_PAGE_BYTES) {
+            DefaultAllocator::Deallocate(ptr, bytes);
+            return;
+        }
+        std::free(ptr);
+    }
+};
+
+class BufferPool {
+public:
+    // never destroyed, buffers held by static objects may still come back during exit
+    static BufferPool& GetInstance()
+    {
+        static BufferPool* instance = new BufferPool();
+        return *instance;
+    }
+
+    ErrorCode Allocate(size_t bytes, std::shared_ptr<void>& buffer)
+    {
+        size_t classBytes = SizeClass(bytes);
+        void* ptr = nullptr;
+        std::shared_ptr<BufferAllocator> allocator;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            allocator = allocator_;
+            requests_++;
+            inUseBytes_ += classBytes;
+            auto it = cache_.find(classBytes);
+            if (it != cache_.end() && !it->second.empty()) {
+                ptr = it->second.back();
+                it->second.pop_back();
+                cachedBytes_ -= classBytes;
+                hits_++;
+            }
+        }
+        if (ptr == nullptr) {
+            ptr = allocator->Allocate(classBytes);
+        }
+        if (ptr == nullptr) {
+            // buffers of other size classes may be what is missing
+            Trim();
+            ptr = allocator->Allocate(classBytes);
+        }
+        if (ptr == nullptr) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            inUseBytes_ -= classBytes;
+            LogError << "Failed to malloc " << classBytes << " bytes for buffer." << GetErrorInfo(ERR_BAD_ALLOC);
+            return ERR_BAD_ALLOC;
+        }
+        buffer = std::shared_ptr<void>(ptr, [allocator, classBytes](void* p) {
+            BufferPool::GetInstance().Release(p, classBytes, allocator);
+        });
+        return SUCCESS;
+    }
+
+    void SetAllocator(std::shared_ptr<BufferAllocator> allocator)
+    {
+        std::shared_ptr<BufferAllocator> previous;
+        std::unordered_map<size_t, std::vector<void*>> cache;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            previous = std::move(allocator_);
+            allocator_ = std::move(allocator);
+            cache.swap(cache_);
+            cachedBytes_ = 0;
+        }
+        FreeAll(cache, *previous);
+    }
+
+    void SetCapacity(size_t bytes)
+    {
+        std::unordered_map<size_t, std::vector<void*>> evicted;
+        std::shared_ptr<BufferAllocator> allocator;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            capacity_ = bytes;
+            allocator = allocator_;
+            for (auto& entry : cache_) {
+                while (cachedBytes_ > capacity_ && !entry.second.empty()) {
+                    evicted[entry.first].push_back(entry.second.back());
+                    entry.second.pop_back();
+                    cachedBytes_ -= entry.first;
+                }
+            }
+        }
+        FreeAll(evicted, *allocator);
+    }
+
+    void Trim()
+    {
+        std::unordered_map<size_t, std::vector<void*>> cache;
+        std::shared_ptr<BufferAllocator> allocator;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            allocator = allocator_;
+            cache.swap(cache_);
+            cachedBytes_ = 0;
+        }
+        FreeAll(cache, *allocator);
+    }
+
+    BufferPoolStats GetStats()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        BufferPoolStats stats;
+        stats.requests = requests_;
+        stats.hits = hits_;
+        stats.inUseBytes = inUseBytes_;
+        stats.cachedBytes = cachedBytes_;
+        stats.capacity = capacity_;
+        return stats;
+    }
+
+private:
+    BufferPool() : allocator_(std::make_shared<DefaultAllocator>()) {}
+
+    void Release(void* ptr, size_t classBytes, const std::shared_ptr<BufferAllocator>& allocator)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            inUseBytes_ -= classBytes;
+            // buffers of a replaced allocator go back to it, the cache only holds buffers of the current one
+            if (classBytes >= MIN_POOLED_BYTES && allocator == allocator_ && cachedBytes_ + classBytes <= capacity_) {
+                cache_[classBytes].push_back(ptr);
+                cachedBytes_ += classBytes;
+                return;
+            }
+        }
+        allocator->Deallocate(ptr, classBytes);
+    }
+
+    static void FreeAll(std::unordered_map<size_t, std::vector<void*>>& cache, BufferAllocator& allocator)
+    {
+        for (auto& entry : cache) {
+            for (void* ptr : entry.second) {
+                allocator.Deallocate(ptr, entry.first);
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::shared_ptr<BufferAllocator> allocator_;
+    std::unordered_map<size_t, std::vector<void*>> cache_; // size class to idle buffers
+    size_t capacity_ = DEFAULT_POOL_CAPACITY;
+    size_t cachedBytes_ = 0;
+    size_t inUseBytes_ = 0;
+    size_t requests_ = 0;
+    size_t hits_ = 0;
+};
+} // namespace
+
+namespace Acc {
+ErrorCode AllocateBuffer(size_t bytes, std::shared_ptr<void>& buffer)
+{
+    if (bytes == 0) {
+        LogError << "The buffer size should not be 0." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    return BufferPool::GetInstance().Allocate(bytes, buffer);
+}
+
+ErrorCode SetBufferAllocator(BufferAllocatorType type)
+{
+    switch (type) {
+        case BufferAllocatorType::DEFAULT:
+            BufferPool::GetInstance().SetAllocator(std::make_shared<DefaultAllocator>());
+            return SUCCESS;
+        case BufferAllocatorType::HUGE_PAGE:
+            BufferPool::GetInstance().SetAllocator(std::make_shared<HugePageAllocator>());
+            return SUCCESS;
+        default:
+            LogError << "Unsupported buffer allocator type: " << static_cast<int>(type) << "."
+                     << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+    }
+}
+
+ErrorCode SetBufferAllocator(std::shared_ptr<BufferAllocator> allocator)
+{
+    if (allocator == nullptr) {
+        LogError << "The buffer allocator is nullptr." << GetErrorInfo(ERR_INVALID_POINTER);
+        return ERR_INVALID_POINTER;
+    }
+    BufferPool::GetInstance().SetAllocator(std::move(allocator));
+    return SUCCESS;
+}
+
+void SetBufferPoolCapacity(size_t bytes)
+{
+    BufferPool::GetInstance().SetCapacity(bytes);
+}
+
+BufferPoolStats GetBufferPoolStats()
+{
+    return BufferPool::GetInstance().GetStats();
+}
+
+void TrimBufferPool()
+{
+    BufferPool::GetInstance().Trim();
+}
+} // namespace Acc
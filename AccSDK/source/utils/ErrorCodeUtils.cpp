@@ -71,6 +71,12 @@ const std::string OPENSOURCE_ERROR_INFO_STRING[] = {
         static_cast<uint32_t>(SubErrorCode::OPENSOURCE_ERROR_BEGIN)] = "LibJpeg read file failed",
     [static_cast<uint32_t>(SubErrorCode::FFMPEG_COMMON_FAILURE) -
         static_cast<uint32_t>(SubErrorCode::OPENSOURCE_ERROR_BEGIN)] = "FFmpeg inner function execute failed",
+    [static_cast<uint32_t>(SubErrorCode::LIBPNG_READ_FILE_FAILURE) -
+        static_cast<uint32_t>(SubErrorCode::OPENSOURCE_ERROR_BEGIN)] = "LibPng read file failed",
+    [static_cast<uint32_t>(SubErrorCode::LIBWEBP_READ_FILE_FAILURE) -
+        static_cast<uint32_t>(SubErrorCode::OPENSOURCE_ERROR_BEGIN)] = "LibWebp read file failed",
+    [static_cast<uint32_t>(SubErrorCode::LIBJPEG_ENCODE_FAILURE) -
+        static_cast<uint32_t>(SubErrorCode::OPENSOURCE_ERROR_BEGIN)] = "LibJpeg encode failed",
 };
 
 const std::string THIRD_PARTY_ERROR_INFO_STRING[] = {
@@ -0,0 +1,153 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: File prefetcher file.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#include "acc/utils/FilePrefetcher.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+#include "acc/utils/LogImpl.h"
+#include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/ThreadPool.h"
+
+namespace Acc {
+FilePrefetcher::FilePrefetcher(const std::vector<std::string>& paths, FileLoader loader, size_t maxInFlightBytes,
+                               size_t ioThreads)
+    : state_(std::make_shared<State>(paths, std::move(loader), maxInFlightBytes))
+{
+    size_t taskNum = std::min(paths.size(), ioThreads);
+    try {
+        auto& pool = ThreadPool::GetIoInstance();
+        for (size_t i = 0; i < taskNum; ++i) {
+            pool.Submit(&FilePrefetcher::IoTask, state_);
+        }
+    } catch (const std::exception& e) {
+        // the submitted tasks still cover every path, with none Take loads the files itself
+        LogWarn << "Submit file prefetch task failed, error: " << e.what();
+    }
+}
+
+FilePrefetcher::~FilePrefetcher()
+{
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->stop = true;
+    state_->budgetCond.notify_all();
+    // tasks still queued in the pool see stop and return without touching paths or the loader
+    state_->idleCond.wait(lock, [this]() { return state_->running == 0; });
+}
+
+void FilePrefetcher::IoTask(const std::shared_ptr<State>& state)
+{
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->stop) {
+            return;
+        }
+        state->running++;
+    }
+    IoLoop(*state);
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->running--;
+    }
+    state->idleCond.notify_all();
+}
+
+void FilePrefetcher::IoLoop(State& state)
+{
+    while (true) {
+        size_t index = 0;
+        size_t ticket = 0;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            while (state.nextLoad < state.items.size() && state.items[state.nextLoad].claimed) {
+                state.nextLoad++;
+            }
+            if (state.stop || state.nextLoad >= state.items.size()) {
+                return;
+            }
+            index = state.nextLoad++;
+            state.items[index].claimed = true;
+            ticket = state.nextTicket++;
+        }
+        // a missing file reserves nothing, the loader reports the error
+        std::error_code ec;
+        uintmax_t fileSize = std::filesystem::file_size(state.paths[index], ec);
+        size_t reserved = ec ? 0 : static_cast<size_t>(std::min<uintmax_t>(fileSize, state.maxInFlightBytes));
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.budgetCond.wait(lock, [&state, ticket, reserved]() {
+                return state.stop ||
+                       (state.nextReserve == ticket && state.inFlightBytes + reserved <= state.maxInFlightBytes);
+            });
+            if (state.stop) {
+                return;
+            }
+            state.nextReserve++;
+            state.inFlightBytes += reserved;
+        }
+        state.budgetCond.notify_all();
+        MappedFile file;
+        ErrorCode status = state.loader(state.paths[index].c_str(), file);
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            Item& item = state.items[index];
+            item.file = std::move(file);
+            item.status = status;
+            item.reserved = reserved;
+            item.ready = true;
+        }
+        state.readyCond.notify_all();
+    }
+}
+
+ErrorCode FilePrefetcher::Take(size_t index, MappedFile& file)
+{
+    State& state = *state_;
+    if (index >= state.items.size()) {
+        LogError << "Prefetch index " << index << " is out of range [0, " << state.items.size() << ")."
+                 << GetErrorInfo(ERR_OUT_OF_RANGE);
+        return ERR_OUT_OF_RANGE;
+    }
+    ErrorCode status = SUCCESS;
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        Item& item = state.items[index];
+        if (item.taken) {
+            LogError << "Prefetched file " << index << " has already been taken." << GetErrorInfo(ERR_INVALID_PARAM);
+            return ERR_INVALID_PARAM;
+        }
+        item.taken = true;
+        if (!item.claimed) {
+            // the I/O tasks are behind or busy with other batches, waiting for them could block this worker for long
+            item.claimed = true;
+            lock.unlock();
+            return state.loader(state.paths[index].c_str(), file);
+        }
+        state.readyCond.wait(lock, [&item]() { return item.ready; });
+        file = std::move(item.file);
+        status = item.status;
+        state.inFlightBytes -= item.reserved;
+    }
+    state.budgetCond.notify_all();
+    return status;
+}
+} // namespace Acc
@@ -21,9 +21,14 @@
  */
 #include "acc/utils/FileUtils.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
 #include <fstream>
 #include <filesystem>
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include "acc/ErrorCode.h"
@@ -34,6 +39,7 @@ namespace fs = std::filesystem;
 namespace {
 constexpr int FILE_PATH_MAX = 4096;
 constexpr mode_t FILE_MODE = 0640;
+constexpr size_t READ_CHUNK_SIZE = 64 * 1024;
 } // namespace
 
 namespace Acc {
@@ -125,6 +131,133 @@ ErrorCode ReadFile(const char* path, std::vector<uint8_t>& data, size_t maxFileS
     return SUCCESS;
 }
 
+MappedFile::~MappedFile()
+{
+    Release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(other.data_), size_(other.size_), buffer_(std::move(other.buffer_))
+{
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        Release();
+        data_ = other.data_;
+        size_ = other.size_;
+        buffer_ = std::move(other.buffer_);
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+void MappedFile::Release()
+{
+    if (data_ != nullptr && buffer_.empty()) {
+        munmap(const_cast<uint8_t*>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    std::vector<uint8_t>().swap(buffer_);
+}
+
+ErrorCode MappedFile::Open(const char* path, size_t maxFileSize, bool populate)
+{
+    Release();
+    if (path == nullptr) {
+        LogError << "The file is invalid, file path is nullptr." << GetErrorInfo(ERR_OPEN_FILE_FAILURE);
+        return ERR_OPEN_FILE_FAILURE;
+    }
+    fs::path normPath = fs::absolute(path).lexically_normal();
+    int fd = open(normPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        LogError << "The file is invalid, file open failed." << GetErrorInfo(ERR_OPEN_FILE_FAILURE);
+        return ERR_OPEN_FILE_FAILURE;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0) {
+        close(fd);
+        LogError << "The file is invalid, get file stat failed." << GetErrorInfo(ERR_OPEN_FILE_FAILURE);
+        return ERR_OPEN_FILE_FAILURE;
+    }
+    bool isRegular = S_ISREG(fileStat.st_mode);
+    if (isRegular && (fileStat.st_size <= 0 ||
+        static_cast<uint64_t>(fileStat.st_size) > static_cast<uint64_t>(maxFileSize))) {
+        close(fd);
+        LogError << "The file is invalid, file size out of range. The file is empty or exceeds the maximum limit: "
+                 << maxFileSize << " bytes." << GetErrorInfo(ERR_INVALID_FILE_SIZE);
+        return ERR_INVALID_FILE_SIZE;
+    }
+    // the size of a pipe or a device is unknown until it is read
+    size_t fileSize = isRegular ? static_cast<size_t>(fileStat.st_size) : 0;
+    if (fileSize >= MMAP_MIN_FILE_SIZE) {
+        void* mapped =
+            mmap(nullptr, fileSize, PROT_READ, populate ? (MAP_PRIVATE | MAP_POPULATE) : MAP_PRIVATE, fd, 0);
+        struct stat mappedStat;
+        // pages past the end of a file truncated meanwhile would raise SIGBUS, such a file is read instead
+        if (mapped != MAP_FAILED && fstat(fd, &mappedStat) == 0 && mappedStat.st_size == fileStat.st_size) {
+            close(fd);
+            // only hints, the mapping stays usable when the kernel ignores them
+            madvise(mapped, fileSize, MADV_SEQUENTIAL);
+            madvise(mapped, fileSize, MADV_WILLNEED);
+            data_ = static_cast<const uint8_t*>(mapped);
+            size_ = fileSize;
+            return SUCCESS;
+        }
+        if (mapped != MAP_FAILED) {
+            munmap(mapped, fileSize);
+        }
+    }
+    ErrorCode ret = ReadAll(fd, fileSize, maxFileSize);
+    close(fd);
+    return ret;
+}
+
+ErrorCode MappedFile::ReadAll(int fd, size_t sizeHint, size_t maxFileSize)
+{
+    // one byte beyond the limit tells a file at the limit from a larger one
+    size_t limit = maxFileSize < SIZE_MAX ? maxFileSize + 1 : SIZE_MAX;
+    // one byte beyond the hint lets a regular file end with the first short read
+    buffer_.resize(std::min(sizeHint > 0 ? sizeHint + 1 : READ_CHUNK_SIZE, limit));
+    size_t total = 0;
+    while (true) {
+        if (total == buffer_.size()) {
+            if (total >= limit) {
+                break;
+            }
+            buffer_.resize(std::min(total * 2, limit));
+        }
+        ssize_t n = read(fd, buffer_.data() + total, buffer_.size() - total);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            Release();
+            LogError << "Read file data failed." << GetErrorInfo(ERR_OPEN_FILE_FAILURE);
+            return ERR_OPEN_FILE_FAILURE;
+        }
+        if (n == 0) {
+            break;
+        }
+        total += static_cast<size_t>(n);
+    }
+    if (total == 0 || total > maxFileSize) {
+        Release();
+        LogError << "The file is invalid, file size out of range. The file is empty or exceeds the maximum limit: "
+                 << maxFileSize << " bytes." << GetErrorInfo(ERR_INVALID_FILE_SIZE);
+        return ERR_INVALID_FILE_SIZE;
+    }
+    buffer_.resize(total);
+    data_ = buffer_.data();
+    size_ = total;
+    return SUCCESS;
+}
+
 bool CheckFilePath(const std::string& path)
 {
     if (path.empty()) {
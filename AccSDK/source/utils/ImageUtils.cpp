@@ -19,16 +19,26 @@
  * Create: 2025
  * History: NA
  */
+#include <algorithm>
 #include <string>
+#include <csetjmp>
 #include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <turbojpeg.h>
+#include <jpeglib.h>
+#include <png.h>
+#include <webp/decode.h>
 #include "acc/ErrorCode.h"
 #include "acc/utils/LogImpl.h"
 #include "acc/utils/FileUtils.h"
 #include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/BufferPoolImpl.h"
 #include "acc/utils/ImageUtils.h"
+#include "acc/core/framework/BicubicRowResizer.h"
 
 namespace {
+using namespace Acc;
 constexpr size_t THREE_CHANNEL = 3;
 constexpr size_t MAX_WIDTH = 8192;
 constexpr size_t MIN_WIDTH = 10;
@@ -36,9 +46,306 @@ constexpr size_t MAX_HEIGHT = 8192;
 constexpr size_t MIN_HEIGHT = 10;
 constexpr size_t IMAGE_SIZE_DIMS = 2;
 constexpr size_t IMAGE_MAX_FILE_SIZE = 1024 * 1024 * 50; // 1GB
+constexpr size_t JPEG_HEADER_PROBE_BYTES = 64 * 1024;   // SOF usually sits in the first APP0/APP1 segments
+constexpr size_t JPEG_HEADER_PROBE_GROWTH = 4;
+constexpr int JPEG_BAND_ROWS = 4; // covers rec_outbuf_height of every sampling factor
+constexpr size_t FOUR_CHANNEL = 4;
+constexpr uint8_t JPEG_SIGNATURE[] = {0xFF, 0xD8, 0xFF};
+constexpr uint8_t PNG_SIGNATURE[] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+constexpr size_t FOURCC_BYTES = 4;
+constexpr size_t RIFF_FORM_OFFSET = 8; // "RIFF", chunk size, form type
+constexpr size_t RIFF_HEADER_BYTES = RIFF_FORM_OFFSET + FOURCC_BYTES;
+constexpr int MIN_JPEG_QUALITY = 1;
+constexpr int MAX_JPEG_QUALITY = 100;
+
+ErrorCode CheckImagePath(const char* path)
+{
+    if (!IsFileValid(path)) {
+        LogError << "Image path is invalid.";
+        return ERR_INVALID_PARAM;
+    }
+    // The suffix is not checked, the decoder is picked from the magic bytes of the file content
+    return SUCCESS;
+}
+
+// the readers below only take jpeg, like Image the content is checked instead of the file suffix
+ErrorCode CheckJpegContent(const uint8_t* data, size_t size)
+{
+    if (SniffImageCodec(data, size) != ImageCodec::JPEG) {
+        LogError << "Invalid image data: the file content is not a jpeg image, only jpeg images are supported."
+                 << GetErrorInfo(ERR_UNSUPPORTED_TYPE);
+        return ERR_UNSUPPORTED_TYPE;
+    }
+    return SUCCESS;
+}
+
+ErrorCode CheckImageBuffer(const uint8_t* data, size_t size)
+{
+    if (data == nullptr || size == 0 || size > IMAGE_MAX_FILE_SIZE) {
+        LogError << "Invalid image data: the image buffer is empty or larger than " << IMAGE_MAX_FILE_SIZE
+                 << " bytes." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    return SUCCESS;
+}
+
+/**
+ * TurboJPEG handles of the current thread. Creating a handle allocates the whole libjpeg state, which costs
+ * about as much as decoding a thumbnail, so the handles are kept for the lifetime of the thread.
+ */
+struct ThreadJpegHandles {
+    tjhandle decompressor = nullptr;
+    tjhandle compressor = nullptr;
+
+    ThreadJpegHandles() = default;
+    ThreadJpegHandles(const ThreadJpegHandles&) = delete;
+    ThreadJpegHandles& operator=(const ThreadJpegHandles&) = delete;
+    ~ThreadJpegHandles()
+    {
+        if (decompressor != nullptr) {
+            tjDestroy(decompressor);
+        }
+        if (compressor != nullptr) {
+            tjDestroy(compressor);
+        }
+    }
+};
+
+ThreadJpegHandles& GetThreadJpegHandles()
+{
+    thread_local ThreadJpegHandles handles;
+    return handles;
+}
+
+struct JpegErrorManager {
+    jpeg_error_mgr pub;
+    jmp_buf jumpBuffer;
+};
+
+void JpegErrorExit(j_common_ptr cinfo)
+{
+    auto* err = reinterpret_cast<JpegErrorManager*>(cinfo->err);
+    longjmp(err->jumpBuffer, 1);
+}
+
+void JpegOutputMessage(j_common_ptr) {}
+
+// corrupt data warnings fail the decode, same as tjDecompress2 which returns -1 on them
+void JpegEmitMessage(j_common_ptr cinfo, int msgLevel)
+{
+    if (msgLevel < 0) {
+        JpegErrorExit(cinfo);
+    }
+}
+
+/**
+ * Decode rows [top, top + height) and columns [left, left + width) with the libjpeg scanline API. Only the iMCU
+ * columns covering the region go through the IDCT, rows above it are skipped and rows below are never read.
+ * Errors leave through longjmp, so no object with a destructor may be created in here. rowBuffer must hold a
+ * full RGB row of the image.
+ */
+bool DecodeJpegRegion(const uint8_t* data, size_t size, uint32_t top, uint32_t left, uint32_t height,
+                      uint32_t width, unsigned char* dst, unsigned char* rowBuffer)
+{
+    jpeg_decompress_struct cinfo;
+    JpegErrorManager jerr;
+    cinfo.err = jpeg_std_error(&jerr.pub);
+    jerr.pub.error_exit = JpegErrorExit;
+    jerr.pub.output_message = JpegOutputMessage;
+    jerr.pub.emit_message = JpegEmitMessage;
+    if (setjmp(jerr.jumpBuffer) != 0) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, data, static_cast<unsigned long>(size));
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_RGB;
+    jpeg_start_decompress(&cinfo);
+
+    // the crop is widened to iMCU boundaries, xOffset and cropWidth return the columns actually decoded
+    JDIMENSION xOffset = left;
+    JDIMENSION cropWidth = width;
+    jpeg_crop_scanline(&cinfo, &xOffset, &cropWidth);
+    if (top > 0 && jpeg_skip_scanlines(&cinfo, top) != top) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+    size_t shift = static_cast<size_t>(left - xOffset) * THREE_CHANNEL;
+    size_t rowBytes = static_cast<size_t>(width) * THREE_CHANNEL;
+    for (uint32_t row = 0; row < height; row++) {
+        JSAMPROW rowPtr = rowBuffer;
+        if (jpeg_read_scanlines(&cinfo, &rowPtr, 1) != 1) {
+            jpeg_destroy_decompress(&cinfo);
+            return false;
+        }
+        std::copy_n(rowBuffer + shift, rowBytes, dst + row * rowBytes);
+    }
+    // the remaining rows are dropped without being decoded
+    jpeg_destroy_decompress(&cinfo);
+    return true;
+}
+
+/**
+ * Buffers of a streaming decode, allocated by the caller because DecodeJpegResized may leave through longjmp.
+ */
+struct JpegStreamWorkspace {
+    unsigned char* band;      // JPEG_BAND_ROWS decoded rows
+    size_t srcRowBytes;
+    unsigned char* ring;      // MaxSrcRows() horizontally resized rows
+    size_t ringRows;
+    size_t dstRowBytes;
+    const uint8_t** rowPtrs;  // MaxSrcRows() pointers into the ring
+};
+
+/**
+ * Decode the jpeg at the given DCT scale band by band and resize it on the fly. Each band is resized
+ * horizontally as soon as the vertical kernel needs it, so only a few rows are ever held and rows below the
+ * last kernel are never decoded. Same longjmp restrictions as DecodeJpegRegion.
+ */
+bool DecodeJpegResized(const uint8_t* data, size_t size, tjscalingfactor scale, const BicubicRowResizer& resizer,
+                       size_t dstHeight, const JpegStreamWorkspace& ws, unsigned char* dst)
+{
+    jpeg_decompress_struct cinfo;
+    JpegErrorManager jerr;
+    cinfo.err = jpeg_std_error(&jerr.pub);
+    jerr.pub.error_exit = JpegErrorExit;
+    jerr.pub.output_message = JpegOutputMessage;
+    jerr.pub.emit_message = JpegEmitMessage;
+    if (setjmp(jerr.jumpBuffer) != 0) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, data, static_cast<unsigned long>(size));
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.scale_num = static_cast<unsigned int>(scale.num);
+    cinfo.scale_denom = static_cast<unsigned int>(scale.denom);
+    jpeg_start_decompress(&cinfo);
+    if (static_cast<size_t>(cinfo.output_width) * THREE_CHANNEL != ws.srcRowBytes) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+
+    JSAMPROW bandRows[JPEG_BAND_ROWS];
+    for (int i = 0; i < JPEG_BAND_ROWS; i++) {
+        bandRows[i] = ws.band + static_cast<size_t>(i) * ws.srcRowBytes;
+    }
+    size_t bandFirst = 0;
+    size_t bandCount = 0;
+    size_t resized = 0;
+    for (size_t yy = 0; yy < dstHeight; yy++) {
+        size_t first = resizer.FirstSrcRow(yy);
+        size_t count = resizer.NumSrcRows(yy);
+        while (resized < first + count) {
+            if (resized >= bandFirst + bandCount) {
+                bandFirst += bandCount;
+                bandCount = jpeg_read_scanlines(&cinfo, bandRows, JPEG_BAND_ROWS);
+                if (bandCount == 0) {
+                    jpeg_destroy_decompress(&cinfo);
+                    return false;
+                }
+            }
+            resizer.HorizontalPass(bandRows[resized - bandFirst], ws.ring + (resized % ws.ringRows) * ws.dstRowBytes);
+            resized++;
+        }
+        for (size_t y = 0; y < count; y++) {
+            ws.rowPtrs[y] = ws.ring + ((first + y) % ws.ringRows) * ws.dstRowBytes;
+        }
+        resizer.VerticalPass(ws.rowPtrs, yy, dst + yy * ws.dstRowBytes);
+    }
+    jpeg_destroy_decompress(&cinfo);
+    return true;
+}
+
+/**
+ * Pick the strongest 1/2^n DCT scaling whose output still covers the minimal size, the other M/8 factors of
+ * libjpeg-turbo cost about as much as a full decode.
+ */
+tjscalingfactor SelectJpegScale(int width, int height, size_t minWidth, size_t minHeight)
+{
+    tjscalingfactor best = {1, 1};
+    if (minWidth == 0 || minHeight == 0) {
+        return best;
+    }
+    int numFactors = 0;
+    const tjscalingfactor* factors = tjGetScalingFactors(&numFactors);
+    if (factors == nullptr) {
+        return best;
+    }
+    for (int i = 0; i < numFactors; i++) {
+        const tjscalingfactor& factor = factors[i];
+        if (factor.num != 1 || factor.denom <= best.denom) {
+            continue;
+        }
+        if (static_cast<size_t>(TJSCALED(width, factor)) >= minWidth &&
+            static_cast<size_t>(TJSCALED(height, factor)) >= minHeight) {
+            best = factor;
+        }
+    }
+    return best;
+}
+
+/**
+ * Bicubic resize of a fully decoded RGB image with the resizer of the streaming jpeg path, so that every format
+ * gives the same result as the CPU Resize operator. Runs on the calling thread, it is used inside pool tasks.
+ */
+void ResizeRgbImage(const unsigned char* src, size_t srcWidth, size_t srcHeight, size_t dstWidth, size_t dstHeight,
+                    unsigned char* dst)
+{
+    BicubicRowResizer resizer(srcWidth, srcHeight, dstWidth, dstHeight);
+    size_t srcRowBytes = srcWidth * THREE_CHANNEL;
+    size_t dstRowBytes = dstWidth * THREE_CHANNEL;
+    size_t ringRows = resizer.MaxSrcRows();
+    std::vector<unsigned char> ring(ringRows * dstRowBytes);
+    std::vector<const uint8_t*> rowPtrs(ringRows);
+    size_t resized = 0;
+    for (size_t yy = 0; yy < dstHeight; yy++) {
+        size_t first = resizer.FirstSrcRow(yy);
+        size_t count = resizer.NumSrcRows(yy);
+        for (; resized < first + count; resized++) {
+            resizer.HorizontalPass(src + resized * srcRowBytes, ring.data() + (resized % ringRows) * dstRowBytes);
+        }
+        for (size_t y = 0; y < count; y++) {
+            rowPtrs[y] = ring.data() + ((first + y) % ringRows) * dstRowBytes;
+        }
+        resizer.VerticalPass(rowPtrs.data(), yy, dst + yy * dstRowBytes);
+    }
+}
+
+// decoded pixels come from the buffer pool, the aliasing pointer keeps the pooled block alive
+ErrorCode AllocateDecodedData(size_t totalBytes, std::shared_ptr<unsigned char[]>& decodedData)
+{
+    std::shared_ptr<void> buffer;
+    if (AllocateBuffer(totalBytes, buffer) != SUCCESS) {
+        LogError << "Failed to malloc for decoded image data." << GetErrorInfo(ERR_BAD_ALLOC);
+        return ERR_BAD_ALLOC;
+    }
+    decodedData = std::shared_ptr<unsigned char[]>(buffer, static_cast<unsigned char*>(buffer.get()));
+    return SUCCESS;
+}
 } // namespace
 
 namespace Acc {
+tjhandle GetJpegDecompressor()
+{
+    auto& handles = GetThreadJpegHandles();
+    if (handles.decompressor == nullptr) {
+        handles.decompressor = tjInitDecompress();
+    }
+    return handles.decompressor;
+}
+
+tjhandle GetJpegCompressor()
+{
+    auto& handles = GetThreadJpegHandles();
+    if (handles.compressor == nullptr) {
+        handles.compressor = tjInitCompress();
+    }
+    return handles.compressor;
+}
+
 ErrorCode CheckImSize(const std::vector<size_t>& imSize)
 {
     if (imSize.size() != IMAGE_SIZE_DIMS) {
@@ -58,26 +365,94 @@ ErrorCode CheckImSize(const std::vector<size_t>& imSize)
     return SUCCESS;
 }
 
-ErrorCode ReadJpegData(const char* path, std::vector<uint8_t>& rawData, int& width, int& height,
-                       std::shared_ptr<unsigned char[]>& decodedData)
+ErrorCode ReadJpegHeader(const char* path, int& width, int& height)
 {
-    if (!IsFileValid(path)) {
-        LogError << "Image path is invalid.";
-        return ERR_INVALID_PARAM;
+    ErrorCode ret = CheckImagePath(path);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    tjhandle jpegDecompressor = GetJpegDecompressor();
+    if (!jpegDecompressor) {
+        LogError << "Image decompressor initialization failed. "
+            << "Image decoding cannot proceed. Please check if the system has proper libjpeg-turbo support installed."
+            << GetErrorInfo(ERR_LIBJPEG_INIT_FAILURE);
+        return ERR_LIBJPEG_INIT_FAILURE;
     }
 
-    if (!CheckFileExtension(path, "jpg") && !CheckFileExtension(path, "jpeg")) {
-        LogError << "Invalid image suffix, only support 'jpg', 'jpeg', 'JPG' or 'JPEG'.";
-        return ERR_INVALID_PARAM;
+    std::ifstream file;
+    if (!CheckFileOpen(path, file)) {
+        LogError << "The file is invalid, file open failed." << GetErrorInfo(ERR_OPEN_FILE_FAILURE);
+        return ERR_OPEN_FILE_FAILURE;
+    }
+    int64_t fileSize = 0;
+    if (!CheckAndGetFileSize(file, IMAGE_MAX_FILE_SIZE, fileSize)) {
+        LogError << "The file is invalid, file size out of range." << GetErrorInfo(ERR_INVALID_FILE_SIZE);
+        return ERR_INVALID_FILE_SIZE;
+    }
+    // the header is read in growing steps into one buffer, each step only reads the bytes not read before
+    std::vector<uint8_t> head;
+    size_t probeBytes = std::min(JPEG_HEADER_PROBE_BYTES, static_cast<size_t>(fileSize));
+    int retInt = -1;
+    while (true) {
+        size_t readBytes = head.size();
+        head.resize(probeBytes);
+        if (!file.read(reinterpret_cast<char*>(head.data() + readBytes),
+                       static_cast<std::streamsize>(probeBytes - readBytes))) {
+            LogError << "Read file data failed." << GetErrorInfo(ERR_OPEN_FILE_FAILURE);
+            return ERR_OPEN_FILE_FAILURE;
+        }
+        if (readBytes == 0) {
+            ret = CheckJpegContent(head.data(), head.size());
+            if (ret != SUCCESS) {
+                return ret;
+            }
+        }
+        int subSample;
+        retInt = tjDecompressHeader2(jpegDecompressor, head.data(), head.size(), &width, &height, &subSample);
+        // the header may fail to parse only because the SOF marker is beyond the bytes read so far
+        if (retInt == 0 || probeBytes >= static_cast<size_t>(fileSize)) {
+            break;
+        }
+        probeBytes = std::min(probeBytes * JPEG_HEADER_PROBE_GROWTH, static_cast<size_t>(fileSize));
+    }
+    if (retInt != 0) {
+        LogError << "Invalid image data: failed to parse image header. "
+                 << "Please ensure the input is a valid, non-corrupted image file."
+                 << GetErrorInfo(ERR_LIBJPEG_READ_FILE_FAILURE);
+        return ERR_LIBJPEG_READ_FILE_FAILURE;
     }
+    return CheckImSize({static_cast<size_t>(width), static_cast<size_t>(height)});
+}
 
-    // Buffer to hold the raw file data
-    ErrorCode ret = ReadFile(path, rawData, IMAGE_MAX_FILE_SIZE);
+ErrorCode ReadJpegData(const char* path, int& width, int& height, std::shared_ptr<unsigned char[]>& decodedData,
+                       size_t minWidth, size_t minHeight)
+{
+    ErrorCode ret = CheckImagePath(path);
     if (ret != SUCCESS) {
         return ret;
     }
-    // Initialize JPEG decompressor
-    tjhandle jpegDecompressor = tjInitDecompress();
+
+    // The decoder reads the mapped file pages directly
+    MappedFile file;
+    ret = file.Open(path, IMAGE_MAX_FILE_SIZE);
+    if (ret == SUCCESS) {
+        ret = CheckJpegContent(file.Data(), file.Size());
+    }
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    return DecodeJpegData(file.Data(), file.Size(), width, height, decodedData, minWidth, minHeight);
+}
+
+ErrorCode DecodeJpegData(const uint8_t* data, size_t size, int& width, int& height,
+                         std::shared_ptr<unsigned char[]>& decodedData, size_t minWidth, size_t minHeight)
+{
+    ErrorCode ret = CheckImageBuffer(data, size);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    // Reuse the JPEG decompressor of this thread
+    tjhandle jpegDecompressor = GetJpegDecompressor();
     if (!jpegDecompressor) {
         LogError << "Image decompressor initialization failed. "
             << "Image decoding cannot proceed. Please check if the system has proper libjpeg-turbo support installed."
@@ -87,34 +462,396 @@ ErrorCode ReadJpegData(const char* path, std::vector<uint8_t>& rawData, int& wid
 
     int subSample;
     // Decompress header to get width, height, and subsampling
-    int retInt = tjDecompressHeader2(jpegDecompressor, rawData.data(), rawData.size(), &width, &height, &subSample);
+    // tjDecompressHeader2 only reads the buffer, its TurboJPEG 2.0 signature is not const
+    int retInt = tjDecompressHeader2(jpegDecompressor, const_cast<unsigned char*>(data), size, &width, &height,
+                                     &subSample);
     if (retInt != 0) {
         LogError << "Invalid image data: failed to parse image header. "
                  << "Please ensure the input is a valid, non-corrupted image file."
                  << GetErrorInfo(ERR_LIBJPEG_READ_FILE_FAILURE);
-        tjDestroy(jpegDecompressor);
         return ERR_LIBJPEG_READ_FILE_FAILURE;
     }
     // check image size before actual read data, prevent OOM.
     ret = CheckImSize({static_cast<size_t>(width), static_cast<size_t>(height)});
     if (ret != SUCCESS) {
         LogError << "Check image size failed." << GetErrorInfo(ret);
-        tjDestroy(jpegDecompressor);
         return ret;
     }
 
+    // decode straight to a smaller size in the DCT domain when the caller shrinks the image anyway
+    tjscalingfactor scale = SelectJpegScale(width, height, minWidth, minHeight);
+    width = TJSCALED(width, scale);
+    height = TJSCALED(height, scale);
     size_t totalBytes = static_cast<size_t>(width) * static_cast<size_t>(height) * THREE_CHANNEL;
-    decodedData = std::make_unique<unsigned char[]>(totalBytes);
-    retInt = tjDecompress2(jpegDecompressor, rawData.data(), rawData.size(), decodedData.get(), width, 0, height,
-                           TJPF_RGB, 0);
+    if (AllocateDecodedData(totalBytes, decodedData) != SUCCESS) {
+        return ERR_BAD_ALLOC;
+    }
+    retInt = tjDecompress2(jpegDecompressor, data, size, decodedData.get(), width, 0, height, TJPF_RGB, 0);
+    if (retInt != 0) {
+        LogError << "Invalid image data: failed to parse image data. "
+                 << "Please ensure the input is a valid, non-corrupted image file."
+                 << GetErrorInfo(ERR_LIBJPEG_READ_FILE_FAILURE);
+        return ERR_LIBJPEG_READ_FILE_FAILURE;
+    }
+    return SUCCESS;
+}
+
+ErrorCode ReadJpegRegion(const char* path, uint32_t top, uint32_t left, uint32_t height, uint32_t width,
+                         std::shared_ptr<unsigned char[]>& decodedData)
+{
+    ErrorCode ret = CheckImagePath(path);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    MappedFile file;
+    ret = file.Open(path, IMAGE_MAX_FILE_SIZE);
+    if (ret == SUCCESS) {
+        ret = CheckJpegContent(file.Data(), file.Size());
+    }
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    tjhandle jpegDecompressor = GetJpegDecompressor();
+    if (!jpegDecompressor) {
+        LogError << "Image decompressor initialization failed. "
+            << "Image decoding cannot proceed. Please check if the system has proper libjpeg-turbo support installed."
+            << GetErrorInfo(ERR_LIBJPEG_INIT_FAILURE);
+        return ERR_LIBJPEG_INIT_FAILURE;
+    }
+    int imWidth = 0;
+    int imHeight = 0;
+    int subSample;
+    int retInt = tjDecompressHeader2(jpegDecompressor, const_cast<uint8_t*>(file.Data()), file.Size(), &imWidth,
+                                     &imHeight, &subSample);
+    if (retInt != 0) {
+        LogError << "Invalid image data: failed to parse image header. "
+                 << "Please ensure the input is a valid, non-corrupted image file."
+                 << GetErrorInfo(ERR_LIBJPEG_READ_FILE_FAILURE);
+        return ERR_LIBJPEG_READ_FILE_FAILURE;
+    }
+    ret = CheckImSize({static_cast<size_t>(imWidth), static_cast<size_t>(imHeight)});
+    if (ret != SUCCESS) {
+        LogError << "Check image size failed." << GetErrorInfo(ret);
+        return ret;
+    }
+    if (static_cast<size_t>(top) + height > static_cast<size_t>(imHeight) ||
+        static_cast<size_t>(left) + width > static_cast<size_t>(imWidth)) {
+        LogError << "Crop region exceeds the image. Current top is " << top << ", left is " << left << ", height is "
+                 << height << ", width is " << width << ", and the image size is " << imWidth << "x" << imHeight
+                 << "." << GetErrorInfo(ERR_OUT_OF_RANGE);
+        return ERR_OUT_OF_RANGE;
+    }
+    ret = CheckImSize({static_cast<size_t>(width), static_cast<size_t>(height)});
+    if (ret != SUCCESS) {
+        LogError << "Check crop size failed." << GetErrorInfo(ret);
+        return ret;
+    }
+
+    std::vector<unsigned char> rowBuffer(static_cast<size_t>(imWidth) * THREE_CHANNEL);
+    if (AllocateDecodedData(static_cast<size_t>(width) * height * THREE_CHANNEL, decodedData) != SUCCESS) {
+        return ERR_BAD_ALLOC;
+    }
+    if (!DecodeJpegRegion(file.Data(), file.Size(), top, left, height, width, decodedData.get(),
+                          rowBuffer.data())) {
+        LogError << "Invalid image data: failed to parse image data. "
+                 << "Please ensure the input is a valid, non-corrupted image file."
+                 << GetErrorInfo(ERR_LIBJPEG_READ_FILE_FAILURE);
+        decodedData.reset();
+        return ERR_LIBJPEG_READ_FILE_FAILURE;
+    }
+    return SUCCESS;
+}
+
+ErrorCode ReadJpegResized(const char* path, size_t resizeW, size_t resizeH,
+                          std::shared_ptr<unsigned char[]>& decodedData)
+{
+    ErrorCode ret = CheckImagePath(path);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    MappedFile file;
+    ret = file.Open(path, IMAGE_MAX_FILE_SIZE);
+    if (ret == SUCCESS) {
+        ret = CheckJpegContent(file.Data(), file.Size());
+    }
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    return DecodeJpegDataResized(file.Data(), file.Size(), resizeW, resizeH, decodedData);
+}
+
+ErrorCode DecodeJpegDataResized(const uint8_t* data, size_t size, size_t resizeW, size_t resizeH,
+                                std::shared_ptr<unsigned char[]>& decodedData)
+{
+    ErrorCode ret = CheckImageBuffer(data, size);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    tjhandle jpegDecompressor = GetJpegDecompressor();
+    if (!jpegDecompressor) {
+        LogError << "Image decompressor initialization failed. "
+            << "Image decoding cannot proceed. Please check if the system has proper libjpeg-turbo support installed."
+            << GetErrorInfo(ERR_LIBJPEG_INIT_FAILURE);
+        return ERR_LIBJPEG_INIT_FAILURE;
+    }
+    int width = 0;
+    int height = 0;
+    int subSample;
+    // tjDecompressHeader2 only reads the buffer, its TurboJPEG 2.0 signature is not const
+    int retInt = tjDecompressHeader2(jpegDecompressor, const_cast<unsigned char*>(data), size, &width, &height,
+                                     &subSample);
     if (retInt != 0) {
+        LogError << "Invalid image data: failed to parse image header. "
+                 << "Please ensure the input is a valid, non-corrupted image file."
+                 << GetErrorInfo(ERR_LIBJPEG_READ_FILE_FAILURE);
+        return ERR_LIBJPEG_READ_FILE_FAILURE;
+    }
+    ret = CheckImSize({static_cast<size_t>(width), static_cast<size_t>(height)});
+    if (ret != SUCCESS) {
+        LogError << "Check image size failed." << GetErrorInfo(ret);
+        return ret;
+    }
+
+    tjscalingfactor scale = SelectJpegScale(width, height, resizeW, resizeH);
+    size_t scaledW = static_cast<size_t>(TJSCALED(width, scale));
+    size_t scaledH = static_cast<size_t>(TJSCALED(height, scale));
+    BicubicRowResizer resizer(scaledW, scaledH, resizeW, resizeH);
+    std::vector<unsigned char> band(JPEG_BAND_ROWS * scaledW * THREE_CHANNEL);
+    std::vector<unsigned char> ring(resizer.MaxSrcRows() * resizeW * THREE_CHANNEL);
+    std::vector<const uint8_t*> rowPtrs(resizer.MaxSrcRows());
+    JpegStreamWorkspace ws = {band.data(), scaledW * THREE_CHANNEL, ring.data(), resizer.MaxSrcRows(),
+                              resizeW * THREE_CHANNEL, rowPtrs.data()};
+    if (AllocateDecodedData(resizeW * resizeH * THREE_CHANNEL, decodedData) != SUCCESS) {
+        return ERR_BAD_ALLOC;
+    }
+    if (!DecodeJpegResized(data, size, scale, resizer, resizeH, ws, decodedData.get())) {
         LogError << "Invalid image data: failed to parse image data. "
                  << "Please ensure the input is a valid, non-corrupted image file."
                  << GetErrorInfo(ERR_LIBJPEG_READ_FILE_FAILURE);
-        tjDestroy(jpegDecompressor);
+        decodedData.reset();
         return ERR_LIBJPEG_READ_FILE_FAILURE;
     }
-    tjDestroy(jpegDecompressor);
+    return SUCCESS;
+}
+
+ImageCodec SniffImageCodec(const uint8_t* data, size_t size)
+{
+    if (data == nullptr) {
+        return ImageCodec::UNKNOWN;
+    }
+    if (size >= sizeof(JPEG_SIGNATURE) && std::memcmp(data, JPEG_SIGNATURE, sizeof(JPEG_SIGNATURE)) == 0) {
+        return ImageCodec::JPEG;
+    }
+    if (size >= sizeof(PNG_SIGNATURE) && std::memcmp(data, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) == 0) {
+        return ImageCodec::PNG;
+    }
+    if (size >= RIFF_HEADER_BYTES && std::memcmp(data, "RIFF", FOURCC_BYTES) == 0 &&
+        std::memcmp(data + RIFF_FORM_OFFSET, "WEBP", FOURCC_BYTES) == 0) {
+        return ImageCodec::WEBP;
+    }
+    return ImageCodec::UNKNOWN;
+}
+
+ErrorCode DecodePngData(const uint8_t* data, size_t size, int& width, int& height,
+                        std::shared_ptr<unsigned char[]>& decodedData)
+{
+    ErrorCode ret = CheckImageBuffer(data, size);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    // the simplified API reports errors through the png_image instead of longjmp
+    png_image image{};
+    image.version = PNG_IMAGE_VERSION;
+    if (png_image_begin_read_from_memory(&image, data, size) == 0) {
+        LogError << "Invalid image data: failed to parse png header, " << image.message << ". "
+                 << "Please ensure the input is a valid, non-corrupted image file."
+                 << GetErrorInfo(ERR_LIBPNG_READ_FILE_FAILURE);
+        return ERR_LIBPNG_READ_FILE_FAILURE;
+    }
+    size_t imWidth = static_cast<size_t>(image.width);
+    size_t imHeight = static_cast<size_t>(image.height);
+    ret = CheckImSize({imWidth, imHeight});
+    if (ret != SUCCESS) {
+        png_image_free(&image);
+        LogError << "Check image size failed." << GetErrorInfo(ret);
+        return ret;
+    }
+
+    // Palette, gray and 16 bit images are expanded to 8 bit RGB by libpng. Removing alpha would composite onto
+    // black, decode it and drop it instead, the same as converting to RGB in Pillow.
+    bool hasAlpha = (image.format & PNG_FORMAT_FLAG_ALPHA) != 0;
+    image.format = hasAlpha ? PNG_FORMAT_RGBA : PNG_FORMAT_RGB;
+    size_t numPixels = imWidth * imHeight;
+    if (AllocateDecodedData(numPixels * THREE_CHANNEL, decodedData) != SUCCESS) {
+        return ERR_BAD_ALLOC;
+    }
+    std::vector<unsigned char> rgba(hasAlpha ? numPixels * FOUR_CHANNEL : 0);
+    unsigned char* target = hasAlpha ? rgba.data() : decodedData.get();
+    if (png_image_finish_read(&image, nullptr, target, 0, nullptr) == 0) {
+        LogError << "Invalid image data: failed to parse png data, " << image.message << ". "
+                 << "Please ensure the input is a valid, non-corrupted image file."
+                 << GetErrorInfo(ERR_LIBPNG_READ_FILE_FAILURE);
+        decodedData.reset();
+        return ERR_LIBPNG_READ_FILE_FAILURE;
+    }
+    if (hasAlpha) {
+        unsigned char* dst = decodedData.get();
+        for (size_t i = 0; i < numPixels; i++) {
+            dst[i * THREE_CHANNEL] = rgba[i * FOUR_CHANNEL];
+            dst[i * THREE_CHANNEL + 1] = rgba[i * FOUR_CHANNEL + 1];
+            dst[i * THREE_CHANNEL + 2] = rgba[i * FOUR_CHANNEL + 2];
+        }
+    }
+    width = static_cast<int>(imWidth);
+    height = static_cast<int>(imHeight);
+    return SUCCESS;
+}
+
+ErrorCode DecodeWebpData(const uint8_t* data, size_t size, int& width, int& height,
+                         std::shared_ptr<unsigned char[]>& decodedData)
+{
+    ErrorCode ret = CheckImageBuffer(data, size);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    if (WebPGetInfo(data, size, &width, &height) == 0) {
+        LogError << "Invalid image data: failed to parse webp header. "
+                 << "Please ensure the input is a valid, non-corrupted image file."
+                 << GetErrorInfo(ERR_LIBWEBP_READ_FILE_FAILURE);
+        return ERR_LIBWEBP_READ_FILE_FAILURE;
+    }
+    ret = CheckImSize({static_cast<size_t>(width), static_cast<size_t>(height)});
+    if (ret != SUCCESS) {
+        LogError << "Check image size failed." << GetErrorInfo(ret);
+        return ret;
+    }
+    // the alpha plane of lossy and lossless images is skipped when decoding to RGB
+    size_t rowBytes = static_cast<size_t>(width) * THREE_CHANNEL;
+    size_t totalBytes = rowBytes * static_cast<size_t>(height);
+    if (AllocateDecodedData(totalBytes, decodedData) != SUCCESS) {
+        return ERR_BAD_ALLOC;
+    }
+    if (WebPDecodeRGBInto(data, size, decodedData.get(), totalBytes, static_cast<int>(rowBytes)) == nullptr) {
+        LogError << "Invalid image data: failed to parse webp data. "
+                 << "Please ensure the input is a valid, non-corrupted image file."
+                 << GetErrorInfo(ERR_LIBWEBP_READ_FILE_FAILURE);
+        decodedData.reset();
+        return ERR_LIBWEBP_READ_FILE_FAILURE;
+    }
+    return SUCCESS;
+}
+
+ErrorCode DecodeImageData(const uint8_t* data, size_t size, int& width, int& height,
+                          std::shared_ptr<unsigned char[]>& decodedData, size_t minWidth, size_t minHeight)
+{
+    ErrorCode ret = CheckImageBuffer(data, size);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    switch (SniffImageCodec(data, size)) {
+        case ImageCodec::JPEG:
+            return DecodeJpegData(data, size, width, height, decodedData, minWidth, minHeight);
+        case ImageCodec::PNG:
+            return DecodePngData(data, size, width, height, decodedData);
+        case ImageCodec::WEBP:
+            return DecodeWebpData(data, size, width, height, decodedData);
+        default:
+            LogError << "Unsupported image data, only jpeg, png and webp images are supported."
+                     << GetErrorInfo(ERR_UNSUPPORTED_TYPE);
+            return ERR_UNSUPPORTED_TYPE;
+    }
+}
+
+ErrorCode DecodeImageDataResized(const uint8_t* data, size_t size, size_t resizeW, size_t resizeH,
+                                 std::shared_ptr<unsigned char[]>& decodedData)
+{
+    if (SniffImageCodec(data, size) == ImageCodec::JPEG) {
+        return DecodeJpegDataResized(data, size, resizeW, resizeH, decodedData);
+    }
+    int width = 0;
+    int height = 0;
+    std::shared_ptr<unsigned char[]> fullData;
+    ErrorCode ret = DecodeImageData(data, size, width, height, fullData);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    if (AllocateDecodedData(resizeW * resizeH * THREE_CHANNEL, decodedData) != SUCCESS) {
+        return ERR_BAD_ALLOC;
+    }
+    ResizeRgbImage(fullData.get(), static_cast<size_t>(width), static_cast<size_t>(height), resizeW, resizeH,
+                   decodedData.get());
+    return SUCCESS;
+}
+
+ErrorCode MapImageFile(const char* path, MappedFile& file, bool populate)
+{
+    ErrorCode ret = CheckImagePath(path);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    return file.Open(path, IMAGE_MAX_FILE_SIZE, populate);
+}
+
+ErrorCode ReadImageData(const char* path, int& width, int& height, std::shared_ptr<unsigned char[]>& decodedData,
+                        size_t minWidth, size_t minHeight)
+{
+    MappedFile file;
+    ErrorCode ret = MapImageFile(path, file);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    return DecodeImageData(file.Data(), file.Size(), width, height, decodedData, minWidth, minHeight);
+}
+
+ErrorCode ReadImageResized(const char* path, size_t resizeW, size_t resizeH,
+                           std::shared_ptr<unsigned char[]>& decodedData)
+{
+    MappedFile file;
+    ErrorCode ret = MapImageFile(path, file);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    return DecodeImageDataResized(file.Data(), file.Size(), resizeW, resizeH, decodedData);
+}
+
+ErrorCode EncodeJpegData(const uint8_t* pixels, size_t width, size_t height, TJPF pixelFormat, int quality,
+                         std::vector<uint8_t>& encoded)
+{
+    if (pixels == nullptr) {
+        LogError << "Image data to encode is nullptr." << GetErrorInfo(ERR_INVALID_POINTER);
+        return ERR_INVALID_POINTER;
+    }
+    if (quality < MIN_JPEG_QUALITY || quality > MAX_JPEG_QUALITY) {
+        LogError << "Jpeg quality must be in [" << MIN_JPEG_QUALITY << ", " << MAX_JPEG_QUALITY << "], but got "
+                 << quality << "." << GetErrorInfo(ERR_INVALID_PARAM);
+        return ERR_INVALID_PARAM;
+    }
+    ErrorCode ret = CheckImSize({width, height});
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    tjhandle jpegCompressor = GetJpegCompressor();
+    if (jpegCompressor == nullptr) {
+        LogError << "Failed to init libjpeg-turbo compressor." << GetErrorInfo(ERR_LIBJPEG_INIT_FAILURE);
+        return ERR_LIBJPEG_INIT_FAILURE;
+    }
+    int jpegWidth = static_cast<int>(width);
+    int jpegHeight = static_cast<int>(height);
+    // worst case size, so the compressor writes straight into the vector and never reallocates, the unused tail is
+    // released once the real size is known
+    encoded.resize(tjBufSize(jpegWidth, jpegHeight, TJSAMP_420));
+    unsigned char* jpegBuf = encoded.data();
+    unsigned long jpegSize = static_cast<unsigned long>(encoded.size());
+    if (tjCompress2(jpegCompressor, pixels, jpegWidth, 0, jpegHeight, pixelFormat, &jpegBuf, &jpegSize, TJSAMP_420,
+                    quality, TJFLAG_NOREALLOC) != 0) {
+        LogError << "Failed to encode jpeg, error: " << tjGetErrorStr2(jpegCompressor)
+                 << GetErrorInfo(ERR_LIBJPEG_ENCODE_FAILURE);
+        encoded.clear();
+        encoded.shrink_to_fit();
+        return ERR_LIBJPEG_ENCODE_FAILURE;
+    }
+    encoded.resize(jpegSize);
+    encoded.shrink_to_fit();
     return SUCCESS;
 }
 } // namespace Acc
@@ -45,13 +45,17 @@ namespace {
     // Map DataType to TensorDataType
     const std::map<DataType, TensorDataType> dataTypeToTensorDataType = {
         {DataType::UINT8, TensorDataType::UINT8},
-        {DataType::FLOAT32, TensorDataType::FP32}
+        {DataType::FLOAT32, TensorDataType::FP32},
+        {DataType::FLOAT16, TensorDataType::FP16},
+        {DataType::BFLOAT16, TensorDataType::BF16}
     };
 
     // Map TensorDataType to DataType
     const std::map<TensorDataType, DataType> tensorDataTypeToDataType = {
         {TensorDataType::UINT8, DataType::UINT8},
-        {TensorDataType::FP32, DataType::FLOAT32}
+        {TensorDataType::FP32, DataType::FLOAT32},
+        {TensorDataType::FP16, DataType::FLOAT16},
+        {TensorDataType::BF16, DataType::BFLOAT16}
     };
 }
 
@@ -21,10 +21,16 @@
  */
 
 #include "acc/utils/ThreadPool.h"
+#include <algorithm>
 #include <iostream>
+#include "acc/utils/ErrorCodeUtils.h"
+#include "acc/utils/LogImpl.h"
+#include "acc/utils/ScratchArena.h"
 
 namespace {
 constexpr size_t THREAD_POOL_DEFAULT_THREAD_NUMS = 128;
+constexpr size_t IO_THREAD_POOL_DEFAULT_THREAD_NUMS = 8;
+thread_local bool g_inWorkerThread = false;
 }
 
 namespace Acc {
@@ -47,6 +53,12 @@ ThreadPool& ThreadPool::GetInstance()
     return instance;
 }
 
+ThreadPool& ThreadPool::GetIoInstance()
+{
+    static ThreadPool instance(IO_THREAD_POOL_DEFAULT_THREAD_NUMS);
+    return instance;
+}
+
 void ThreadPool::Shutdown()
 {
     {
@@ -61,8 +73,47 @@ void ThreadPool::Shutdown()
     }
 }
 
+ErrorCode ThreadPool::ParallelFor(size_t count, size_t maxTaskNum, const std::function<void(size_t)>& body)
+{
+    if (InWorkerThread()) {
+        for (size_t i = 0; i < count; ++i) {
+            body(i);
+        }
+        return SUCCESS;
+    }
+    size_t taskNum = std::min(count, std::max<size_t>(maxTaskNum, 1));
+    std::vector<std::future<void>> futures;
+    futures.reserve(taskNum);
+    try {
+        for (size_t task = 0; task < taskNum; ++task) {
+            futures.push_back(Submit([task, taskNum, count, &body]() {
+                for (size_t i = task; i < count; i += taskNum) {
+                    body(i);
+                }
+            }));
+        }
+        WaitAll(futures);
+    } catch (const std::exception& e) {
+        // the tasks reference the body of the caller, finish them before returning
+        for (auto& future : futures) {
+            if (future.valid()) {
+                future.wait();
+            }
+        }
+        LogError << "Run parallel tasks failed, error: " << e.what() << GetErrorInfo(ERR_INVALID_THREAD_POOL_STATUST);
+        return ERR_INVALID_THREAD_POOL_STATUST;
+    }
+    return SUCCESS;
+}
+
+bool ThreadPool::InWorkerThread()
+{
+    return g_inWorkerThread;
+}
+
 void ThreadPool::WorkerLoop()
 {
+    g_inWorkerThread = true;
     while (true) {
         std::function<void()> task;
         {
@@ -77,6 +128,8 @@ void ThreadPool::WorkerLoop()
             tasks_.pop();
         }
         task();
+        // scratch memory of a task does not outlive it
+        ScratchArena::ThreadLocal().Reset();
     }
 }
 } // namespace Acc
\ No newline at end of file
@@ -21,6 +21,7 @@
  */
 #include "acc/video/Video.h"
 
+#include <algorithm>
 #include <chrono>
 #include <array>
 #include <mutex>
@@ -65,6 +66,7 @@ constexpr uint32_t OUT_FRAME_FLAG_3 = 3;          // Decode failed, ref frame nu
 constexpr uint32_t OUT_FRAME_FLAG_4 = 4;          // Decode failed, frame buf size error
 constexpr float_t BUF_SIZE_WEIGHT = 1.5;          // Weight for buf size, 1.5 means 3 / 2
 constexpr auto GET_AVAILABLE_CHN_TIMEOUT = std::chrono::seconds(15); // Max waiting time for get available chnId
+constexpr size_t MAX_PROBE_TASK_NUM = 8;          // Max concurrent tasks when probing many videos
 
 /**
  * @description: Checks whether the frame idx set is valid and fills it when it's empty.
@@ -187,6 +189,46 @@ ErrorCode InitVideoInfo(const char* path, std::set<uint32_t>& targetIndices, int
     return SUCCESS;
 }
 
+ErrorCode ReadVideoMetadata(const char* path, VideoProbeInfo& info)
+{
+    AVFormatContext* formatCtx = nullptr;
+    // avformat_open_input parses the moov box of mp4, no packet is read or decoded
+    if (avformat_open_input(&formatCtx, path, nullptr, nullptr) != SUCCESS) {
+        LogError << "Cannot open video file, please ensure that the input video is legal."
+                 << GetErrorInfo(ERR_FFMPEG_COMMON_FAILURE);
+        return ERR_FFMPEG_COMMON_FAILURE;
+    }
+    int videoStreamIdx = FindVideoStream(formatCtx);
+    if (videoStreamIdx == -1) {
+        avformat_close_input(&formatCtx);
+        LogError << "No video stream found, please ensure that the input video is legal."
+                 << GetErrorInfo(ERR_FFMPEG_COMMON_FAILURE);
+        return ERR_FFMPEG_COMMON_FAILURE;
+    }
+    AVStream* videoStream = formatCtx->streams[videoStreamIdx];
+    ErrorCode ret = CheckVideoResolution(videoStream);
+    if (ret != SUCCESS) {
+        avformat_close_input(&formatCtx);
+        return ret;
+    }
+    ret = GetFramesAndFPS(videoStream, info.fps, info.totalFrames);
+    if (ret != SUCCESS) {
+        avformat_close_input(&formatCtx);
+        LogError << "Cannot determine video frame count or FPS, may caused by input video which is broken."
+                 << GetErrorInfo(ret);
+        return ret;
+    }
+    info.width = static_cast<size_t>(videoStream->codecpar->width);
+    info.height = static_cast<size_t>(videoStream->codecpar->height);
+    if (videoStream->duration != AV_NOPTS_VALUE && videoStream->duration > 0) {
+        info.duration = videoStream->duration * av_q2d(videoStream->time_base);
+    } else {
+        info.duration = info.totalFrames / info.fps;
+    }
+    avformat_close_input(&formatCtx);
+    return SUCCESS;
+}
+
 ErrorCode DecodeKeyframesParallel(const char* path, VideoAuxInfo& videoAuxInfo,
                                   const std::vector<int>& targetKeyframeIndices, std::map<int, AVFrame*>& results)
 {
@@ -302,6 +344,41 @@ ErrorCode VideoDecodeCpu(const char* path, std::vector<Image>& frames, const std
     return ConvertFramesToImage(results, checkedTargetIndices, frames);
 }
 
+ErrorCode ProbeVideo(const char* path, VideoProbeInfo& info)
+{
+    info = VideoProbeInfo{};
+    if (!IsFileValid(path)) {
+        LogError << "Video probe failed, video path is invalid." << GetErrorInfo(ERR_INVALID_PARAM);
+        info.status = ERR_INVALID_PARAM;
+        return info.status;
+    }
+    if (!CheckFileExtension(path, "mp4")) {
+        LogError << "Video probe failed, invalid video suffix, only support 'mp4', 'MP4'."
+                 << GetErrorInfo(ERR_INVALID_PARAM);
+        info.status = ERR_INVALID_PARAM;
+        return info.status;
+    }
+    info.status = ReadVideoMetadata(path, info);
+    return info.status;
+}
+
+ErrorCode ProbeVideos(const std::vector<std::string>& paths, std::vector<VideoProbeInfo>& infos)
+{
+    infos.assign(paths.size(), VideoProbeInfo{});
+    ErrorCode ret = ThreadPool::GetInstance().ParallelFor(paths.size(), MAX_PROBE_TASK_NUM,
+        [&paths, &infos](size_t i) { ProbeVideo(paths[i].c_str(), infos[i]); });
+    if (ret != SUCCESS) {
+        LogError << "Probe videos failed." << GetErrorInfo(ret);
+        return ret;
+    }
+    for (const auto& info : infos) {
+        if (info.status != SUCCESS) {
+            return info.status;
+        }
+    }
+    return SUCCESS;
+}
+
 ErrorCode VideoDecode(const char* path, const char* device, std::vector<Image>& frames,
                       const std::set<uint32_t>& frameIndices, int sampleNum)
 {
@@ -19,6 +19,8 @@
  * Create: 2026
  * History: NA
  */
+#include <cstring>
+#include <fstream>
 #include <vector>
 #include <gtest/gtest.h>
 #include <dirent.h>
@@ -180,6 +182,34 @@ TEST_F(AudioTest, LoadAudioBatch_ShouldReturnError_WhenAnyAudioPathIsInvalid)
     ErrorCode ret = LoadAudioBatch(audioPaths, tensors, originalSrs, SAMPLE_RATE);
     EXPECT_EQ(ret, ERR_INVALID_PARAM);
 }
+
+TEST_F(AudioTest, LoadAudioFromBuffer_ShouldEqualFile_ForAllFormats)
+{
+    for (const char* path : {validAudioPath_, pcm24MonoPath_, pcm32MonoPath_, float32MonoPath_, pcm16StereoPath_}) {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<uint8_t> content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        Tensor fromBuffer;
+        Tensor fromFile;
+        int bufferSr = 0;
+        int fileSr = 0;
+        ASSERT_EQ(LoadAudioFromBuffer(content.data(), content.size(), fromBuffer, bufferSr, SAMPLE_RATE), SUCCESS);
+        ASSERT_EQ(LoadAudioSingle(path, fromFile, fileSr, SAMPLE_RATE), SUCCESS);
+        EXPECT_EQ(bufferSr, fileSr);
+        ASSERT_EQ(fromBuffer.NumBytes(), fromFile.NumBytes());
+        EXPECT_EQ(memcmp(fromBuffer.Ptr(), fromFile.Ptr(), fromFile.NumBytes()), 0) << path;
+    }
+}
+
+TEST_F(AudioTest, LoadAudioFromBuffer_ShouldReturnError_WhenBufferIsInvalid)
+{
+    Tensor tensor;
+    int originalSr = 0;
+    const uint8_t truncated[] = {'R', 'I', 'F', 'F'};
+    EXPECT_EQ(LoadAudioFromBuffer(nullptr, 0, tensor, originalSr), ERR_INVALID_POINTER);
+    EXPECT_EQ(LoadAudioFromBuffer(truncated, 0, tensor, originalSr), ERR_INVALID_FILE_SIZE);
+    EXPECT_EQ(LoadAudioFromBuffer(truncated, sizeof(truncated), tensor, originalSr), ERR_INVALID_PARAM);
+    EXPECT_EQ(LoadAudioFromBuffer(truncated, sizeof(truncated), tensor, originalSr, 0), ERR_INVALID_PARAM);
+}
 } // namespace
 
 int main(int argc, char* argv[])
@@ -0,0 +1,149 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: ImageUtilsBenchmark Cpp file, jpeg thumbnail decoding with a fresh against a cached handle.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "acc/ErrorCode.h"
+#include "acc/utils/ImageUtils.h"
+
+using namespace Acc;
+namespace {
+constexpr int THUMB_WIDTH = 96;
+constexpr int THUMB_HEIGHT = 64;
+constexpr int THUMB_QUALITY = 85;
+constexpr size_t CORPUS_SIZE = 64;
+constexpr int DEFAULT_LOOPS = 10;
+constexpr size_t THREE_CHANNEL = 3;
+constexpr int NOISE_AMPLITUDE = 16;
+
+// gradients shifted per image plus noise, so that every file takes a different entropy path
+bool WriteCorpus(const std::filesystem::path& dir, std::vector<std::string>& corpus)
+{
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<int> noise(0, NOISE_AMPLITUDE);
+    std::vector<uint8_t> pixels(THUMB_WIDTH * THUMB_HEIGHT * THREE_CHANNEL);
+    tjhandle compressor = GetJpegCompressor();
+    if (compressor == nullptr) {
+        return false;
+    }
+    for (size_t n = 0; n < CORPUS_SIZE; n++) {
+        for (int h = 0; h < THUMB_HEIGHT; h++) {
+            for (int w = 0; w < THUMB_WIDTH; w++) {
+                uint8_t* px = pixels.data() + (h * THUMB_WIDTH + w) * THREE_CHANNEL;
+                px[0] = static_cast<uint8_t>((w * 2 + n * 3) + noise(gen));
+                px[1] = static_cast<uint8_t>((h * 3 + n * 5) + noise(gen));
+                px[2] = static_cast<uint8_t>((w + h + n * 7) + noise(gen));
+            }
+        }
+        unsigned char* jpegBuf = nullptr;
+        unsigned long jpegSize = 0;
+        if (tjCompress2(compressor, pixels.data(), THUMB_WIDTH, 0, THUMB_HEIGHT, TJPF_RGB, &jpegBuf, &jpegSize,
+                        TJSAMP_420, THUMB_QUALITY, 0) != 0) {
+            return false;
+        }
+        auto path = dir / ("thumb_" + std::to_string(n) + ".jpg");
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(jpegBuf), static_cast<std::streamsize>(jpegSize));
+        tjFree(jpegBuf);
+        corpus.push_back(path.string());
+    }
+    return true;
+}
+
+// Decoding as done before the handles were cached, a fresh decompressor for every image.
+bool DecodeWithFreshHandle(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    std::vector<uint8_t> raw((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    tjhandle handle = tjInitDecompress();
+    if (handle == nullptr) {
+        return false;
+    }
+    int width = 0;
+    int height = 0;
+    int subSample = 0;
+    int ret = tjDecompressHeader2(handle, raw.data(), raw.size(), &width, &height, &subSample);
+    std::vector<uint8_t> decoded(static_cast<size_t>(width) * static_cast<size_t>(height) * THREE_CHANNEL);
+    ret = (ret == 0) ? tjDecompress2(handle, raw.data(), raw.size(), decoded.data(), width, 0, height, TJPF_RGB, 0)
+                     : ret;
+    tjDestroy(handle);
+    return ret == 0;
+}
+
+bool DecodeWithCachedHandle(const std::string& path)
+{
+    std::shared_ptr<unsigned char[]> decoded;
+    int width = 0;
+    int height = 0;
+    return ReadJpegData(path.c_str(), width, height, decoded) == SUCCESS;
+}
+
+// average microseconds per image, negative when a decode failed
+template<typename F>
+double MicrosPerImage(const std::vector<std::string>& corpus, int loops, F&& decode)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; i++) {
+        for (const auto& path : corpus) {
+            if (!decode(path)) {
+                return -1.0;
+            }
+        }
+    }
+    auto total = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    return total / static_cast<double>(loops * corpus.size());
+}
+} // namespace
+
+/**
+ * Usage: ImageUtilsBenchmark [loops]
+ * Prints the average decode time of a thumbnail with a fresh and with the cached thread local decompressor.
+ */
+int main(int argc, char* argv[])
+{
+    int loops = argc > 1 ? std::atoi(argv[1]) : DEFAULT_LOOPS;
+    if (loops <= 0) {
+        std::cerr << "loops must be > 0" << std::endl;
+        return EXIT_FAILURE;
+    }
+    auto dir = std::filesystem::temp_directory_path() / "acc_image_utils_benchmark";
+    std::filesystem::create_directories(dir);
+    std::vector<std::string> corpus;
+    bool written = WriteCorpus(dir, corpus);
+    double fresh = written ? MicrosPerImage(corpus, loops, DecodeWithFreshHandle) : -1.0;
+    double cached = written ? MicrosPerImage(corpus, loops, DecodeWithCachedHandle) : -1.0;
+    std::filesystem::remove_all(dir);
+    if (fresh < 0 || cached < 0) {
+        std::cerr << "Encode or decode of the thumbnails failed." << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Jpeg decode " << THUMB_WIDTH << "x" << THUMB_HEIGHT << ": fresh handle " << fresh
+              << " us/image, cached handle " << cached << " us/image" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,76 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: TensorBenchmark Cpp file, cost of creating and copying a small tensor.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "acc/tensor/Tensor.h"
+
+using namespace Acc;
+namespace {
+constexpr char CPU[] = "cpu";
+constexpr int TOTAL_BYTES = 10;
+constexpr size_t SHAPE_H = 2;
+constexpr size_t SHAPE_W = 5;
+constexpr int DEFAULT_LOOPS = 1000000;
+} // namespace
+
+/**
+ * Usage: TensorBenchmark [loops]
+ * Prints the average time to construct a tensor around an existing buffer and to copy assign it.
+ */
+int main(int argc, char* argv[])
+{
+    int loops = argc > 1 ? std::atoi(argv[1]) : DEFAULT_LOOPS;
+    if (loops <= 0) {
+        std::cerr << "loops must be > 0" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::shared_ptr<void> arr(new std::int8_t[TOTAL_BYTES], std::default_delete<std::int8_t[]>());
+    const TensorDims tensorShape = {1, 1, SHAPE_H, SHAPE_W};
+    // the checksum keeps the loops from being optimized away
+    size_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; i++) {
+        Tensor tensor(arr, tensorShape, DataType::INT8, TensorFormat::NCHW, CPU);
+        checksum += tensor.NumBytes();
+    }
+    auto create = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    Tensor tensor(arr, tensorShape, DataType::INT8, TensorFormat::NCHW, CPU);
+    std::vector<Tensor> copies(1);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; i++) {
+        copies[0] = tensor;
+        checksum += copies[0].Shape().size();
+    }
+    auto copy = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    if (checksum != static_cast<size_t>(loops) * (TOTAL_BYTES + tensorShape.size())) {
+        std::cerr << "Unexpected tensor size during the benchmark." << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Tensor create " << create / loops << " ns, copy " << copy / loops << " ns" << std::endl;
+    return EXIT_SUCCESS;
+}
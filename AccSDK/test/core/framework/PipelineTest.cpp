@@ -142,6 +142,153 @@ TEST_F(PipelineTest, Test_Pipeline_Run_Normalize_Should_Success)
     }
 }
 
+TEST_F(PipelineTest, Test_Pipeline_Run_Output_Should_Not_Alias_Shared_Input)
+{
+    std::vector<size_t> tensorShape = {BATCH_SIZE, HEIGHT, WIDTH, CHANNEL};
+    const size_t numElements = BATCH_SIZE * HEIGHT * WIDTH * CHANNEL;
+    std::vector<float> inputData(numElements, UNIFORM_VALUE_FLOAT);
+    Tensor inputTensor(static_cast<void*>(inputData.data()), tensorShape, DataType::FLOAT32, TensorFormat::NHWC,
+                       "cpu");
+
+    // the output of this graph is the external source, shared from the input when copy is false
+    Pipeline pipeline(VALID_THREAD_NUM, true);
+    auto externalInput = AccDataOpSpec::Create("ExternalSource");
+    externalInput->AddOutput("ExternalSourceOutput", "cpu");
+    int ret = pipeline.Build({externalInput}, "ExternalSourceOutput");
+    EXPECT_EQ(ret, SUCCESS);
+    std::unordered_map<std::string, std::vector<Tensor>> inputs;
+    inputs["ExternalSourceOutput"].push_back(inputTensor);
+    Tensor output;
+    ret = pipeline.Run(inputs, output, false);
+    EXPECT_EQ(ret, SUCCESS);
+    EXPECT_NE(output.Ptr(), inputTensor.Ptr());
+    inputData.assign(numElements, 0.0f);
+    float* outputDataPtr = static_cast<float*>(output.Ptr());
+    for (size_t i = 0; i < numElements; i++) {
+        EXPECT_EQ(outputDataPtr[i], UNIFORM_VALUE_FLOAT) << "Mismatch at index " << i;
+    }
+}
+
+TEST_F(PipelineTest, Test_Pipeline_Run_Output_Should_Survive_Next_Run)
+{
+    std::vector<size_t> tensorShape = {BATCH_SIZE, HEIGHT, WIDTH, CHANNEL};
+    const size_t numElements = BATCH_SIZE * HEIGHT * WIDTH * CHANNEL;
+    std::vector<float> inputData(numElements, UNIFORM_VALUE_FLOAT);
+    Tensor inputTensor(static_cast<void*>(inputData.data()), tensorShape, DataType::FLOAT32, TensorFormat::NHWC,
+                       "cpu");
+
+    Pipeline pipeline(VALID_THREAD_NUM, true);
+    auto externalInput = AccDataOpSpec::Create("ExternalSource");
+    externalInput->AddOutput("ExternalSourceOutput", "cpu");
+    auto normalize = AccDataOpSpec::Create("Normalize");
+    std::vector<float> mean = {DEFAULT_MEAN, DEFAULT_MEAN, DEFAULT_MEAN};
+    std::vector<float> std = {DEFAULT_STD, DEFAULT_STD, DEFAULT_STD};
+    normalize->AddInput("ExternalSourceOutput", "cpu");
+    normalize->AddArg("mean", mean);
+    normalize->AddArg("stddev", std);
+    normalize->AddOutput("NormalizeOutput", "cpu");
+    int ret = pipeline.Build({externalInput, normalize}, "NormalizeOutput");
+    EXPECT_EQ(ret, SUCCESS);
+    std::unordered_map<std::string, std::vector<Tensor>> inputs;
+    inputs["ExternalSourceOutput"].push_back(inputTensor);
+
+    // the outputs of later runs must not reuse a buffer that was handed out
+    std::vector<Tensor> outputs(DEFAULT_PIPELINE_DEPTH + 1);
+    for (auto& output : outputs) {
+        ret = pipeline.Run(inputs, output, false);
+        EXPECT_EQ(ret, SUCCESS);
+        inputData.assign(numElements, 0.0f);
+    }
+    const float expectedValue = (UNIFORM_VALUE_FLOAT - DEFAULT_MEAN) / DEFAULT_STD;
+    float* outputDataPtr = static_cast<float*>(outputs[0].Ptr());
+    for (size_t i = 0; i < numElements; i++) {
+        EXPECT_NEAR(outputDataPtr[i], expectedValue, 1e-5f) << "Mismatch at index " << i;
+    }
+}
+
+TEST_F(PipelineTest, Test_Pipeline_Run_Into_Should_Write_Preallocated_Output)
+{
+    std::vector<size_t> tensorShape = {BATCH_SIZE, HEIGHT, WIDTH, CHANNEL};
+    const size_t numElements = BATCH_SIZE * HEIGHT * WIDTH * CHANNEL;
+    std::vector<float> inputData(numElements, UNIFORM_VALUE_FLOAT);
+    Tensor inputTensor(static_cast<void*>(inputData.data()), tensorShape, DataType::FLOAT32, TensorFormat::NHWC,
+                       "cpu");
+
+    Pipeline pipeline(VALID_THREAD_NUM, true);
+    auto externalInput = AccDataOpSpec::Create("ExternalSource");
+    externalInput->AddOutput("ExternalSourceOutput", "cpu");
+    auto normalize = AccDataOpSpec::Create("Normalize");
+    std::vector<float> mean = {DEFAULT_MEAN, DEFAULT_MEAN, DEFAULT_MEAN};
+    std::vector<float> std = {DEFAULT_STD, DEFAULT_STD, DEFAULT_STD};
+    normalize->AddInput("ExternalSourceOutput", "cpu");
+    normalize->AddArg("mean", mean);
+    normalize->AddArg("stddev", std);
+    normalize->AddOutput("NormalizeOutput", "cpu");
+    int ret = pipeline.Build({externalInput, normalize}, "NormalizeOutput");
+    EXPECT_EQ(ret, SUCCESS);
+    std::unordered_map<std::string, std::vector<Tensor>> inputs;
+    inputs["ExternalSourceOutput"].push_back(inputTensor);
+
+    std::vector<float> outputData(numElements, 0.0f);
+    Tensor output(static_cast<void*>(outputData.data()), tensorShape, DataType::FLOAT32, TensorFormat::NHWC, "cpu");
+    ret = pipeline.RunInto(inputs, output, false);
+    EXPECT_EQ(ret, SUCCESS);
+    EXPECT_EQ(output.Ptr(), static_cast<void*>(outputData.data()));
+    const float expectedValue = (UNIFORM_VALUE_FLOAT - DEFAULT_MEAN) / DEFAULT_STD;
+    for (size_t i = 0; i < numElements; i++) {
+        EXPECT_NEAR(outputData[i], expectedValue, 1e-5f) << "Mismatch at index " << i;
+    }
+
+    // the caller's memory is released from the pipeline, later runs write their own buffers
+    inputData.assign(numElements, 0.0f);
+    for (int i = 0; i < DEFAULT_PIPELINE_DEPTH + 1; i++) {
+        Tensor next;
+        ret = pipeline.Run(inputs, next, false);
+        EXPECT_EQ(ret, SUCCESS);
+        EXPECT_NE(next.Ptr(), static_cast<void*>(outputData.data()));
+    }
+    for (size_t i = 0; i < numElements; i++) {
+        EXPECT_NEAR(outputData[i], expectedValue, 1e-5f) << "Mismatch at index " << i;
+    }
+}
+
+TEST_F(PipelineTest, Test_Pipeline_Run_Into_With_Mismatched_Output_Should_Fail)
+{
+    std::vector<size_t> tensorShape = {BATCH_SIZE, HEIGHT, WIDTH, CHANNEL};
+    const size_t numElements = BATCH_SIZE * HEIGHT * WIDTH * CHANNEL;
+    std::vector<float> inputData(numElements, UNIFORM_VALUE_FLOAT);
+    Tensor inputTensor(static_cast<void*>(inputData.data()), tensorShape, DataType::FLOAT32, TensorFormat::NHWC,
+                       "cpu");
+
+    Pipeline pipeline(VALID_THREAD_NUM, true);
+    auto externalInput = AccDataOpSpec::Create("ExternalSource");
+    externalInput->AddOutput("ExternalSourceOutput", "cpu");
+    auto normalize = AccDataOpSpec::Create("Normalize");
+    std::vector<float> mean = {DEFAULT_MEAN, DEFAULT_MEAN, DEFAULT_MEAN};
+    std::vector<float> std = {DEFAULT_STD, DEFAULT_STD, DEFAULT_STD};
+    normalize->AddInput("ExternalSourceOutput", "cpu");
+    normalize->AddArg("mean", mean);
+    normalize->AddArg("stddev", std);
+    normalize->AddOutput("NormalizeOutput", "cpu");
+    int ret = pipeline.Build({externalInput, normalize}, "NormalizeOutput");
+    EXPECT_EQ(ret, SUCCESS);
+    std::unordered_map<std::string, std::vector<Tensor>> inputs;
+    inputs["ExternalSourceOutput"].push_back(inputTensor);
+
+    Tensor empty;
+    ret = pipeline.RunInto(inputs, empty, false);
+    EXPECT_EQ(ret, ERR_INVALID_PARAM);
+
+    std::vector<float> outputData(numElements / CHANNEL, 0.0f);
+    Tensor small(static_cast<void*>(outputData.data()), {BATCH_SIZE, HEIGHT, WIDTH, 1}, DataType::FLOAT32,
+                 TensorFormat::NHWC, "cpu");
+    ret = pipeline.RunInto(inputs, small, false);
+    EXPECT_EQ(ret, ERR_INVALID_PARAM);
+    for (size_t i = 0; i < outputData.size(); i++) {
+        EXPECT_EQ(outputData[i], 0.0f) << "Mismatch at index " << i;
+    }
+}
+
 TEST_F(PipelineTest, Test_Pipeline_Run_With_Invalid_Tensor_DataType_Should_Fail)
 {
     std::vector<size_t> tensorShape = {BATCH_SIZE, HEIGHT, WIDTH, CHANNEL};
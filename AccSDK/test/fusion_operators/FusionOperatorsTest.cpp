@@ -22,6 +22,7 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <cstring>
 #include <vector>
 #include "acc/fusion_operators/FusionOperators.h"
 #include "acc/image/Image.h"
@@ -138,6 +139,325 @@ TEST_F(QwenFusionTestFixture, Preprocess_Different_Sizes_And_Layouts)
     EXPECT_EQ(outputs.size(), images.size());
 }
 
+TEST_F(QwenFusionTestFixture, Preprocess_Flatten_Patches_Success)
+{
+    std::vector<std::shared_ptr<Image>> images = {validImage, CreateValidImage()};
+    std::vector<Tensor> outputs;
+
+    QwenPreprocessConfig cfg = validConfig;
+    cfg.flattenPatches = true;
+    EXPECT_EQ(fusion.Qwen2VLImagePreprocess(images, cfg, outputs), SUCCESS);
+    ASSERT_EQ(outputs.size(), images.size());
+    size_t gridH = static_cast<size_t>(cfg.resizeH / cfg.patchSize);
+    size_t gridW = static_cast<size_t>(cfg.resizeW / cfg.patchSize);
+    size_t patchDim = static_cast<size_t>(3 * cfg.temporalPatchSize * cfg.patchSize * cfg.patchSize);
+    for (const auto& output : outputs) {
+        EXPECT_EQ(output.Shape(), (std::vector<size_t>{gridH * gridW, patchDim}));
+        EXPECT_EQ(output.DType(), DataType::FLOAT32);
+    }
+}
+
+TEST_F(QwenFusionTestFixture, Flatten_Patches_Invalid_Params_Should_Fail)
+{
+    std::vector<std::shared_ptr<Image>> images = {validImage};
+    std::vector<Tensor> outputs;
+
+    QwenPreprocessConfig cfg = validConfig;
+    cfg.flattenPatches = true;
+    cfg.resizeW = 220;
+    EXPECT_NE(fusion.Qwen2VLImagePreprocess(images, cfg, outputs), SUCCESS);
+
+    cfg = validConfig;
+    cfg.flattenPatches = true;
+    cfg.temporalPatchSize = 3;
+    EXPECT_NE(fusion.Qwen2VLImagePreprocess(images, cfg, outputs), SUCCESS);
+}
+
+TEST_F(QwenFusionTestFixture, Flatten_Patches_Per_Image_Sizes_Success)
+{
+    static std::vector<uint8_t> buffer(800 * 600 * 3, 50);
+    auto small = std::make_shared<Image>(std::shared_ptr<void>(&buffer[0], [](void*) {}),
+                                         std::vector<size_t>{800, 600}, ImageFormat::RGB, DataType::UINT8, "cpu");
+    std::vector<std::shared_ptr<Image>> images = {validImage, small, small, small};
+    std::vector<Tensor> outputs;
+
+    QwenPreprocessConfig cfg = validConfig;
+    cfg.flattenPatches = true;
+    cfg.resizeSizes = {{728, 1288}, {224, 280}, {56, 56}, {112, 84}};
+    EXPECT_EQ(fusion.Qwen2VLImagePreprocess(images, cfg, outputs), SUCCESS);
+    ASSERT_EQ(outputs.size(), images.size());
+    size_t patchDim = static_cast<size_t>(3 * cfg.temporalPatchSize * cfg.patchSize * cfg.patchSize);
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        size_t gridH = static_cast<size_t>(cfg.resizeSizes[i].first / cfg.patchSize);
+        size_t gridW = static_cast<size_t>(cfg.resizeSizes[i].second / cfg.patchSize);
+        EXPECT_EQ(outputs[i].Shape(), (std::vector<size_t>{gridH * gridW, patchDim}));
+    }
+
+    cfg.resizeSizes.pop_back();
+    EXPECT_NE(fusion.Qwen2VLImagePreprocess(images, cfg, outputs), SUCCESS);
+    cfg.resizeSizes.push_back({112, 90});
+    EXPECT_NE(fusion.Qwen2VLImagePreprocess(images, cfg, outputs), SUCCESS);
+}
+
+TEST_F(QwenFusionTestFixture, Image_Patches_Match_Per_Image_Outputs)
+{
+    static std::vector<uint8_t> buffer(800 * 600 * 3, 50);
+    auto small = std::make_shared<Image>(std::shared_ptr<void>(&buffer[0], [](void*) {}),
+                                         std::vector<size_t>{800, 600}, ImageFormat::RGB, DataType::UINT8, "cpu");
+    std::vector<std::shared_ptr<Image>> images = {validImage, small, small};
+
+    QwenPreprocessConfig cfg = validConfig;
+    cfg.flattenPatches = true;
+    cfg.resizeSizes = {{728, 1288}, {224, 280}, {56, 56}};
+    std::vector<Tensor> outputs;
+    ASSERT_EQ(fusion.Qwen2VLImagePreprocess(images, cfg, outputs), SUCCESS);
+
+    Tensor pixelValues;
+    std::vector<size_t> gridThw;
+    ASSERT_EQ(fusion.Qwen2VLImagePatches(images, cfg, pixelValues, gridThw), SUCCESS);
+    EXPECT_EQ(gridThw, (std::vector<size_t>{1, 52, 92, 1, 16, 20, 1, 4, 4}));
+    size_t patchDim = static_cast<size_t>(3 * cfg.temporalPatchSize * cfg.patchSize * cfg.patchSize);
+    EXPECT_EQ(pixelValues.Shape(), (std::vector<size_t>{52 * 92 + 16 * 20 + 4 * 4, patchDim}));
+    // every image's rows follow the previous image without any gap
+    const char* data = static_cast<const char*>(pixelValues.Ptr());
+    for (const auto& output : outputs) {
+        EXPECT_EQ(std::memcmp(data, output.Ptr(), output.NumBytes()), 0);
+        data += output.NumBytes();
+    }
+
+    std::vector<float> wrongData(patchDim);
+    std::vector<Tensor> wrongOutputs = {Tensor(static_cast<void*>(wrongData.data()), {1, patchDim})};
+    cfg.resizeSizes = {{56, 56}};
+    EXPECT_EQ(fusion.Qwen2VLImagePreprocess({validImage}, cfg, wrongOutputs), ERR_INVALID_PARAM);
+}
+
+TEST_F(QwenFusionTestFixture, Flatten_Patches_Smart_Resize_Success)
+{
+    static std::vector<uint8_t> buffer(800 * 600 * 3, 50);
+    auto small = std::make_shared<Image>(std::shared_ptr<void>(&buffer[0], [](void*) {}),
+                                         std::vector<size_t>{800, 600}, ImageFormat::RGB, DataType::UINT8, "cpu");
+    std::vector<std::shared_ptr<Image>> images = {validImage, small};
+    std::vector<Tensor> outputs;
+
+    QwenPreprocessConfig cfg = validConfig;
+    cfg.flattenPatches = true;
+    cfg.resizeW = 0;
+    cfg.resizeH = 0;
+    EXPECT_EQ(fusion.Qwen2VLImagePreprocess(images, cfg, outputs), SUCCESS);
+    ASSERT_EQ(outputs.size(), images.size());
+    // 1920 x 1080 is capped by maxPixels to 1316 x 728, 800 x 600 is rounded to 812 x 588
+    size_t patchDim = static_cast<size_t>(3 * cfg.temporalPatchSize * cfg.patchSize * cfg.patchSize);
+    EXPECT_EQ(outputs[0].Shape(), (std::vector<size_t>{52 * 94, patchDim}));
+    EXPECT_EQ(outputs[1].Shape(), (std::vector<size_t>{42 * 58, patchDim}));
+
+    int resizeH = 0;
+    int resizeW = 0;
+    EXPECT_EQ(fusion.Qwen2VLSmartResize(1080, 1920, cfg, resizeH, resizeW), SUCCESS);
+    EXPECT_EQ(resizeH, 728);
+    EXPECT_EQ(resizeW, 1316);
+    EXPECT_EQ(fusion.Qwen2VLSmartResize(10, 10, cfg, resizeH, resizeW), ERR_INVALID_PARAM);
+    EXPECT_EQ(fusion.Qwen2VLSmartResize(28, 28 * 201, cfg, resizeH, resizeW), ERR_INVALID_PARAM);
+
+    std::vector<std::pair<int, int>> sizes;
+    EXPECT_EQ(fusion.Qwen2VLResolveResizeSizes(images, cfg, sizes), SUCCESS);
+    EXPECT_EQ(sizes, (std::vector<std::pair<int, int>>{{728, 1316}, {588, 812}}));
+    cfg.resizeH = 224;
+    cfg.resizeW = 224;
+    EXPECT_EQ(fusion.Qwen2VLResolveResizeSizes(images, cfg, sizes), SUCCESS);
+    EXPECT_TRUE(sizes.empty());
+    cfg.resizeSizes = {{224, 224}};
+    EXPECT_EQ(fusion.Qwen2VLResolveResizeSizes(images, cfg, sizes), ERR_INVALID_PARAM);
+}
+
+TEST_F(QwenFusionTestFixture, Video_Preprocess_Merges_Frames_Into_Temporal_Groups)
+{
+    std::vector<std::shared_ptr<Image>> frames;
+    for (int i = 0; i < 5; ++i) {
+        frames.push_back(CreateValidImage());
+    }
+    static std::vector<uint8_t> buffer(800 * 600 * 3, 50);
+    frames.push_back(std::make_shared<Image>(std::shared_ptr<void>(&buffer[0], [](void*) {}),
+                                             std::vector<size_t>{800, 600}, ImageFormat::RGB, DataType::UINT8, "cpu"));
+    frames.push_back(CreateValidImage());
+    Tensor output;
+
+    EXPECT_EQ(fusion.Qwen2VLVideoPreprocess(frames, validConfig, output), SUCCESS);
+    size_t gridT = (frames.size() + 1) / 2;
+    size_t gridH = static_cast<size_t>(validConfig.resizeH / validConfig.patchSize);
+    size_t gridW = static_cast<size_t>(validConfig.resizeW / validConfig.patchSize);
+    size_t patchDim = static_cast<size_t>(3 * validConfig.temporalPatchSize * validConfig.patchSize *
+                                          validConfig.patchSize);
+    EXPECT_EQ(output.Shape(), (std::vector<size_t>{gridT * gridH * gridW, patchDim}));
+
+    std::vector<std::shared_ptr<Image>> empty;
+    EXPECT_NE(fusion.Qwen2VLVideoPreprocess(empty, validConfig, output), SUCCESS);
+}
+
+class InternVL2FusionTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        static std::vector<uint8_t> buffer(1920 * 1080 * 3, 100);
+        validImage = std::make_shared<Image>(std::shared_ptr<void>(&buffer[0], [](void*) {}),
+                                             std::vector<size_t>{1920, 1080}, ImageFormat::RGB, DataType::UINT8, "cpu");
+        validConfig.mean = {0.485f, 0.456f, 0.406f};
+        validConfig.std = {0.229f, 0.224f, 0.225f};
+        validConfig.inputSize = 448;
+        validConfig.minNum = 1;
+        validConfig.maxNum = 12;
+        validConfig.useThumbnail = true;
+    }
+
+    std::shared_ptr<Image> validImage;
+    InternVL2PreprocessConfig validConfig;
+};
+
+TEST_F(InternVL2FusionTestFixture, Preprocess_Should_Return_Tiles_And_Thumbnail)
+{
+    Tensor output;
+    EXPECT_EQ(FusionOperator::InternVL2ImagePreprocess(validImage, validConfig, output), SUCCESS);
+    // 1920x1080 picks the 4x2 grid, plus one thumbnail
+    EXPECT_EQ(output.Shape(), (std::vector<size_t>{9, 3, 448, 448}));
+    EXPECT_EQ(output.DType(), DataType::FLOAT32);
+    EXPECT_EQ(output.Format(), TensorFormat::NCHW);
+    const float* data = static_cast<const float*>(output.Ptr());
+    const float expectR = (100.0f / 255.0f - 0.485f) / 0.229f;
+    const float expectB = (100.0f / 255.0f - 0.406f) / 0.225f;
+    const size_t plane = 448 * 448;
+    EXPECT_NEAR(data[0], expectR, 1e-5);
+    EXPECT_NEAR(data[8 * 3 * plane + 2 * plane + plane - 1], expectB, 1e-5);
+}
+
+TEST_F(InternVL2FusionTestFixture, Preprocess_Single_Tile_Should_Skip_Thumbnail)
+{
+    Tensor output;
+    InternVL2PreprocessConfig cfg = validConfig;
+    cfg.maxNum = 1;
+    EXPECT_EQ(FusionOperator::InternVL2ImagePreprocess(validImage, cfg, output), SUCCESS);
+    EXPECT_EQ(output.Shape(), (std::vector<size_t>{1, 3, 448, 448}));
+}
+
+TEST_F(InternVL2FusionTestFixture, Invalid_Params_Should_Fail)
+{
+    Tensor output;
+    InternVL2PreprocessConfig cfg = validConfig;
+    cfg.minNum = 0;
+    EXPECT_NE(FusionOperator::InternVL2ImagePreprocess(validImage, cfg, output), SUCCESS);
+
+    cfg = validConfig;
+    cfg.minNum = 13;
+    EXPECT_NE(FusionOperator::InternVL2ImagePreprocess(validImage, cfg, output), SUCCESS);
+
+    cfg = validConfig;
+    cfg.std[1] = 0.0f;
+    EXPECT_NE(FusionOperator::InternVL2ImagePreprocess(validImage, cfg, output), SUCCESS);
+
+    cfg = validConfig;
+    cfg.inputSize = 4096;
+    EXPECT_NE(FusionOperator::InternVL2ImagePreprocess(validImage, cfg, output), SUCCESS);
+
+    EXPECT_NE(FusionOperator::InternVL2ImagePreprocess(nullptr, validConfig, output), SUCCESS);
+}
+
+TEST(TokenEstimateTest, Qwen2VL_Estimate_Should_Match_Preprocess_Grid)
+{
+    QwenPreprocessConfig config;
+    std::vector<size_t> gridThw;
+    size_t numTokens = 0;
+    EXPECT_EQ(FusionOperator::Qwen2VLEstimateTokens(1080, 1920, 1, config, gridThw, numTokens), SUCCESS);
+    EXPECT_EQ(gridThw, (std::vector<size_t>{1, 52, 94}));
+    EXPECT_EQ(numTokens, 52 * 94 / 4);
+
+    EXPECT_EQ(FusionOperator::Qwen2VLEstimateTokens(1080, 1920, 5, config, gridThw, numTokens), SUCCESS);
+    EXPECT_EQ(gridThw, (std::vector<size_t>{3, 52, 94}));
+    EXPECT_EQ(numTokens, 3 * 52 * 94 / 4);
+
+    config.resizeW = 448;
+    config.resizeH = 448;
+    EXPECT_EQ(FusionOperator::Qwen2VLEstimateTokens(1080, 1920, 1, config, gridThw, numTokens), SUCCESS);
+    EXPECT_EQ(gridThw, (std::vector<size_t>{1, 32, 32}));
+    EXPECT_EQ(numTokens, 256);
+
+    EXPECT_NE(FusionOperator::Qwen2VLEstimateTokens(1080, 1920, 0, config, gridThw, numTokens), SUCCESS);
+    config.resizeW = 450;
+    EXPECT_NE(FusionOperator::Qwen2VLEstimateTokens(1080, 1920, 1, config, gridThw, numTokens), SUCCESS);
+}
+
+TEST(TokenEstimateTest, InternVL2_Estimate_Should_Count_Tiles_And_Thumbnail)
+{
+    InternVL2PreprocessConfig config{{}, {}, 448, 1, 12, true};
+    size_t numTiles = 0;
+    size_t numTokens = 0;
+    EXPECT_EQ(FusionOperator::InternVL2EstimateTokens(1080, 1920, config, 256, numTiles, numTokens), SUCCESS);
+    // 16:9 ties between the 2x1 and 4x2 grids, the larger one wins for a large image, plus the thumbnail
+    EXPECT_EQ(numTiles, 9);
+    EXPECT_EQ(numTokens, 9 * 256);
+
+    EXPECT_EQ(FusionOperator::InternVL2EstimateTokens(448, 448, config, 256, numTiles, numTokens), SUCCESS);
+    EXPECT_EQ(numTiles, 1);
+
+    config.maxNum = 0;
+    EXPECT_NE(FusionOperator::InternVL2EstimateTokens(1080, 1920, config, 256, numTiles, numTokens), SUCCESS);
+}
+
+class ClipFusionTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        static std::vector<uint8_t> wide(640 * 480 * 3, 100);
+        static std::vector<uint8_t> tall(300 * 500 * 3, 200);
+        wideImage = std::make_shared<Image>(std::shared_ptr<void>(&wide[0], [](void*) {}),
+                                            std::vector<size_t>{640, 480}, ImageFormat::RGB, DataType::UINT8, "cpu");
+        tallImage = std::make_shared<Image>(std::shared_ptr<void>(&tall[0], [](void*) {}),
+                                            std::vector<size_t>{300, 500}, ImageFormat::RGB, DataType::UINT8, "cpu");
+    }
+
+    std::shared_ptr<Image> wideImage;
+    std::shared_ptr<Image> tallImage;
+    ClipPreprocessConfig validConfig;
+};
+
+TEST_F(ClipFusionTestFixture, Preprocess_Should_Return_Normalized_Crops)
+{
+    std::vector<std::shared_ptr<Image>> images = {wideImage, tallImage, wideImage};
+    Tensor output;
+    EXPECT_EQ(FusionOperator::ClipImagePreprocess(images, validConfig, output), SUCCESS);
+    EXPECT_EQ(output.Shape(), (std::vector<size_t>{3, 3, 224, 224}));
+    EXPECT_EQ(output.DType(), DataType::FLOAT32);
+    EXPECT_EQ(output.Format(), TensorFormat::NCHW);
+    const float* data = static_cast<const float*>(output.Ptr());
+    const size_t imageElements = 3 * 224 * 224;
+    EXPECT_NEAR(data[0], (100.0f / 255.0f - validConfig.mean[0]) / validConfig.std[0], 1e-5);
+    EXPECT_NEAR(data[2 * imageElements - 1], (200.0f / 255.0f - validConfig.mean[2]) / validConfig.std[2], 1e-5);
+    EXPECT_NEAR(data[3 * imageElements - 1], (100.0f / 255.0f - validConfig.mean[2]) / validConfig.std[2], 1e-5);
+
+    ClipPreprocessConfig cfg = validConfig;
+    cfg.resizeW = 672;
+    cfg.resizeH = 672;
+    EXPECT_EQ(FusionOperator::ClipImagePreprocess(images, cfg, output), SUCCESS);
+    EXPECT_EQ(output.Shape(), (std::vector<size_t>{3, 3, 224, 224}));
+}
+
+TEST_F(ClipFusionTestFixture, Invalid_Params_Should_Fail)
+{
+    std::vector<std::shared_ptr<Image>> images = {wideImage};
+    Tensor output;
+    ClipPreprocessConfig cfg = validConfig;
+    cfg.cropW = 256;
+    EXPECT_NE(FusionOperator::ClipImagePreprocess(images, cfg, output), SUCCESS);
+
+    cfg = validConfig;
+    cfg.std[1] = 0.0f;
+    EXPECT_NE(FusionOperator::ClipImagePreprocess(images, cfg, output), SUCCESS);
+
+    cfg = validConfig;
+    cfg.resizeW = 672;
+    EXPECT_NE(FusionOperator::ClipImagePreprocess(images, cfg, output), SUCCESS);
+
+    std::vector<std::shared_ptr<Image>> empty;
+    EXPECT_NE(FusionOperator::ClipImagePreprocess(empty, validConfig, output), SUCCESS);
+}
+
 } // namespace
 
 // -------------------- main --------------------
@@ -19,9 +19,13 @@
  * Create: 2025
  * History: NA
  */
+#include <cmath>
+#include <cstring>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include "acc/image/Image.h"
 #include "acc/image/ImageOps.h"
+#include "acc/utils/ImageUtils.h"
 using namespace Acc;
 namespace {
 constexpr size_t BATCH_SIZE_ONE = 1;
@@ -37,6 +41,72 @@ constexpr uint8_t VALID_VALUE = 100;
 constexpr char* CPU = "cpu";
 std::vector<uint8_t> g_vector1080PUint8Value100(SHAPE_1920* SHAPE_1080* CHANNEL_THREE, VALID_VALUE);
 std::vector<uint8_t> g_vector1080PHalfUint8Value100(SHAPE_960* SHAPE_540* CHANNEL_THREE, VALID_VALUE);
+constexpr size_t SHAPE_448 = 448;
+constexpr size_t SHAPE_224 = 224;
+constexpr size_t SHAPE_480 = 480;
+constexpr size_t SHAPE_270 = 270;
+constexpr double MIN_SCALED_DECODE_PSNR = 30.0;
+constexpr double MAX_PIXEL_VALUE = 255.0;
+constexpr double MIN_YUV_RESIZE_PSNR = 30.0;
+constexpr float NORMALIZE_TOLERANCE = 1e-5f;
+constexpr size_t SHAPE_10 = 10;
+const std::string DOG_JPEG_PATH =
+    (std::filesystem::path(__FILE__).parent_path() / "assets" / "dog_1920_1080.jpg").string();
+const std::string DOG_PNG_PATH =
+    (std::filesystem::path(__FILE__).parent_path() / "assets" / "dog_1920_1080.png").string();
+
+double Psnr(const Image& lhs, const Image& rhs)
+{
+    const auto* a = static_cast<const uint8_t*>(lhs.Ptr());
+    const auto* b = static_cast<const uint8_t*>(rhs.Ptr());
+    double sum = 0.0;
+    for (size_t i = 0; i < lhs.NumBytes(); i++) {
+        double diff = static_cast<double>(a[i]) - static_cast<double>(b[i]);
+        sum += diff * diff;
+    }
+    double mse = sum / static_cast<double>(lhs.NumBytes());
+    return mse <= 0.0 ? INFINITY : 10.0 * std::log10(MAX_PIXEL_VALUE * MAX_PIXEL_VALUE / mse);
+}
+
+// BT.601 limited range, chroma averaged over each 2x2 block, the Y plane followed by U and V or interleaved UV
+std::vector<uint8_t> RgbToYuv420(const Image& rgb, bool nv12)
+{
+    size_t width = rgb.Width();
+    size_t height = rgb.Height();
+    const auto* src = static_cast<const uint8_t*>(rgb.Ptr());
+    std::vector<uint8_t> yuv(width * height * CHANNEL_THREE / 2);
+    for (size_t i = 0; i < width * height; i++) {
+        const uint8_t* p = src + i * CHANNEL_THREE;
+        yuv[i] = static_cast<uint8_t>(16 + (66 * p[0] + 129 * p[1] + 25 * p[2] + 128) / 256);
+    }
+    uint8_t* chroma = yuv.data() + width * height;
+    size_t quarter = width * height / 4;
+    for (size_t y = 0; y < height / 2; y++) {
+        for (size_t x = 0; x < width / 2; x++) {
+            double rgbSum[CHANNEL_THREE] = {0.0, 0.0, 0.0};
+            for (size_t dy = 0; dy < 2; dy++) {
+                for (size_t dx = 0; dx < 2; dx++) {
+                    const uint8_t* p = src + ((2 * y + dy) * width + 2 * x + dx) * CHANNEL_THREE;
+                    for (size_t c = 0; c < CHANNEL_THREE; c++) {
+                        rgbSum[c] += p[c] / 4.0;
+                    }
+                }
+            }
+            auto u = static_cast<uint8_t>(
+                128 + std::lround(-0.148 * rgbSum[0] - 0.291 * rgbSum[1] + 0.439 * rgbSum[2]));
+            auto v = static_cast<uint8_t>(128 + std::lround(0.439 * rgbSum[0] - 0.368 * rgbSum[1] - 0.071 * rgbSum[2]));
+            if (nv12) {
+                chroma[y * width + 2 * x] = u;
+                chroma[y * width + 2 * x + 1] = v;
+            } else {
+                chroma[y * (width / 2) + x] = u;
+                chroma[quarter + y * (width / 2) + x] = v;
+            }
+        }
+    }
+    return yuv;
+}
+
 class ImageOpsTest : public testing::Test {
 };
 
@@ -88,6 +158,161 @@ TEST_F(ImageOpsTest, Test_ImageCrop_Failed_With_Invalid_Params)
     auto ret = ImageCrop(src, dst, 0, 0, CROP_HEIGHT, CROP_WIDTH, DeviceMode::CPU);
     EXPECT_EQ(ret, ERR_INVALID_PARAM);
 }
+TEST_F(ImageOpsTest, Test_ImageDecodeResize_Should_Match_Full_Decode)
+{
+    for (auto size : {std::pair<size_t, size_t>{SHAPE_448, SHAPE_448}, {SHAPE_224, SHAPE_224}}) {
+        Image full(DOG_JPEG_PATH.c_str(), CPU);
+        Image expect;
+        ASSERT_EQ(ImageResize(full, expect, size.first, size.second, Interpolation::BICUBIC, DeviceMode::CPU), SUCCESS);
+
+        Image result;
+        ASSERT_EQ(ImageDecodeResize(DOG_JPEG_PATH.c_str(), result, size.first, size.second), SUCCESS);
+        ASSERT_EQ(result.Width(), size.first);
+        ASSERT_EQ(result.Height(), size.second);
+        ASSERT_EQ(result.Format(), ImageFormat::RGB);
+        EXPECT_GE(Psnr(expect, result), MIN_SCALED_DECODE_PSNR);
+    }
+}
+
+TEST_F(ImageOpsTest, Test_ImageDecodeResize_Should_Equal_Scaled_Decode_And_Resize)
+{
+    // the band-wise resize during decoding must not change a single pixel compared to resizing afterwards
+    for (auto size : {std::pair<size_t, size_t>{SHAPE_448, SHAPE_224}, {SHAPE_1920 + SHAPE_448, SHAPE_1080}}) {
+        std::shared_ptr<unsigned char[]> decoded;
+        int width = 0;
+        int height = 0;
+        ASSERT_EQ(ReadJpegData(DOG_JPEG_PATH.c_str(), width, height, decoded, size.first, size.second),
+                  SUCCESS);
+        std::shared_ptr<void> decodedRgbData(decoded.get(), [decoded](void*) mutable { decoded.reset(); });
+        Image scaled(decodedRgbData, {static_cast<size_t>(width), static_cast<size_t>(height)});
+        Image expect;
+        ASSERT_EQ(ImageResize(scaled, expect, size.first, size.second), SUCCESS);
+
+        Image result;
+        ASSERT_EQ(ImageDecodeResize(DOG_JPEG_PATH.c_str(), result, size.first, size.second), SUCCESS);
+        ASSERT_EQ(result.NumBytes(), expect.NumBytes());
+        EXPECT_EQ(std::memcmp(result.Ptr(), expect.Ptr(), result.NumBytes()), 0);
+    }
+}
+
+TEST_F(ImageOpsTest, Test_ImageDecodeResize_Success_With_Exact_Scale)
+{
+    // 1/4 of 1920x1080 is the target itself, no resize pass is needed
+    Image dst;
+    auto ret = ImageDecodeResize(DOG_JPEG_PATH.c_str(), dst, SHAPE_480, SHAPE_270);
+    EXPECT_EQ(ret, SUCCESS);
+    EXPECT_EQ(dst.Size(), (std::vector<size_t>{SHAPE_480, SHAPE_270}));
+}
+
+TEST_F(ImageOpsTest, Test_ImageDecodeResize_Png_Should_Equal_Decode_And_Resize)
+{
+    Image full(DOG_PNG_PATH.c_str(), CPU);
+    Image expect;
+    ASSERT_EQ(ImageResize(full, expect, SHAPE_448, SHAPE_224), SUCCESS);
+    Image result;
+    ASSERT_EQ(ImageDecodeResize(DOG_PNG_PATH.c_str(), result, SHAPE_448, SHAPE_224), SUCCESS);
+    ASSERT_EQ(result.NumBytes(), expect.NumBytes());
+    EXPECT_EQ(std::memcmp(result.Ptr(), expect.Ptr(), result.NumBytes()), 0);
+}
+
+TEST_F(ImageOpsTest, Test_ImageDecodeResize_Failed_With_Invalid_Params)
+{
+    Image dst;
+    EXPECT_EQ(ImageDecodeResize(DOG_JPEG_PATH.c_str(), dst, 0, SHAPE_224), ERR_INVALID_PARAM);
+    EXPECT_NE(ImageDecodeResize("not_exist.jpg", dst, SHAPE_224, SHAPE_224), SUCCESS);
+}
+TEST_F(ImageOpsTest, Test_ImageDecodeCrop_Should_Equal_Crop_After_Full_Decode)
+{
+    Image full(DOG_JPEG_PATH.c_str(), CPU);
+    // regions off the MCU grid, at the image corner and across the full width
+    std::vector<std::vector<uint32_t>> regions = {{37, 53, 200, 301}, {1000, 1900, 80, 20}, {517, 0, 563, 1920}};
+    for (const auto& region : regions) {
+        Image expect;
+        ASSERT_EQ(ImageCrop(full, expect, region[0], region[1], region[2], region[3]), SUCCESS);
+        Image result;
+        ASSERT_EQ(ImageDecodeCrop(DOG_JPEG_PATH.c_str(), result, region[0], region[1], region[2], region[3]), SUCCESS);
+        ASSERT_EQ(result.Size(), expect.Size());
+        ASSERT_EQ(result.NumBytes(), expect.NumBytes());
+        EXPECT_EQ(std::memcmp(result.Ptr(), expect.Ptr(), result.NumBytes()), 0);
+    }
+}
+
+TEST_F(ImageOpsTest, Test_ImageDecodeCrop_Failed_With_Invalid_Params)
+{
+    Image dst;
+    EXPECT_EQ(ImageDecodeCrop(DOG_JPEG_PATH.c_str(), dst, SHAPE_1080 - CROP_HEIGHT + 1, 0, CROP_HEIGHT, CROP_WIDTH),
+              ERR_OUT_OF_RANGE);
+    EXPECT_EQ(ImageDecodeCrop(DOG_JPEG_PATH.c_str(), dst, 0, SHAPE_1920, CROP_HEIGHT, CROP_WIDTH), ERR_OUT_OF_RANGE);
+    EXPECT_NE(ImageDecodeCrop(DOG_JPEG_PATH.c_str(), dst, 0, 0, 1, 1), SUCCESS);
+}
+
+TEST_F(ImageOpsTest, Test_ImageYuvToRgbResize_Should_Match_Rgb_Resize)
+{
+    Image rgb(DOG_JPEG_PATH.c_str(), CPU);
+    Image expect;
+    ASSERT_EQ(ImageResize(rgb, expect, SHAPE_224, SHAPE_224), SUCCESS);
+    std::vector<uint8_t> planar = RgbToYuv420(rgb, false);
+    std::vector<uint8_t> semiPlanar = RgbToYuv420(rgb, true);
+    Image yuv420p(planar.data(), {SHAPE_1920, SHAPE_1080}, ImageFormat::YUV420P, DataType::UINT8, CPU);
+    Image nv12(semiPlanar.data(), {SHAPE_1920, SHAPE_1080}, ImageFormat::NV12, DataType::UINT8, CPU);
+    EXPECT_EQ(yuv420p.NumBytes(), SHAPE_1920 * SHAPE_1080 * CHANNEL_THREE / 2);
+
+    Image fromPlanar;
+    ASSERT_EQ(ImageYuvToRgbResize(yuv420p, fromPlanar, SHAPE_224, SHAPE_224), SUCCESS);
+    Image fromNv12;
+    ASSERT_EQ(ImageYuvToRgbResize(nv12, fromNv12, SHAPE_224, SHAPE_224), SUCCESS);
+    ASSERT_EQ(fromPlanar.Format(), ImageFormat::RGB);
+    ASSERT_EQ(fromPlanar.Size(), expect.Size());
+    EXPECT_EQ(std::memcmp(fromPlanar.Ptr(), fromNv12.Ptr(), fromPlanar.NumBytes()), 0);
+    EXPECT_GT(Psnr(fromPlanar, expect), MIN_YUV_RESIZE_PSNR);
+}
+
+TEST_F(ImageOpsTest, Test_ImageYuvToRgbResizeNormalize_Should_Equal_Normalized_Rgb)
+{
+    Image rgb(DOG_JPEG_PATH.c_str(), CPU);
+    std::vector<uint8_t> semiPlanar = RgbToYuv420(rgb, true);
+    Image nv12(semiPlanar.data(), {SHAPE_1920, SHAPE_1080}, ImageFormat::NV12, DataType::UINT8, CPU);
+    Image resized;
+    ASSERT_EQ(ImageYuvToRgbResize(nv12, resized, SHAPE_448, SHAPE_224), SUCCESS);
+    std::vector<float> mean = {0.485f, 0.456f, 0.406f};
+    std::vector<float> std = {0.229f, 0.224f, 0.225f};
+    const auto* pixels = static_cast<const uint8_t*>(resized.Ptr());
+    size_t planeSize = SHAPE_448 * SHAPE_224;
+    for (auto format : {TensorFormat::NCHW, TensorFormat::NHWC}) {
+        Tensor dst;
+        ASSERT_EQ(ImageYuvToRgbResizeNormalize(nv12, dst, SHAPE_448, SHAPE_224, mean, std, format), SUCCESS);
+        ASSERT_EQ(dst.DType(), DataType::FLOAT32);
+        ASSERT_EQ(dst.Format(), format);
+        const auto* values = static_cast<const float*>(dst.Ptr());
+        for (size_t i = 0; i < planeSize; i++) {
+            for (size_t c = 0; c < CHANNEL_THREE; c++) {
+                float expect = (pixels[i * CHANNEL_THREE + c] / 255.0f - mean[c]) / std[c];
+                size_t index = format == TensorFormat::NCHW ? c * planeSize + i : i * CHANNEL_THREE + c;
+                ASSERT_NEAR(values[index], expect, NORMALIZE_TOLERANCE);
+            }
+        }
+    }
+}
+
+TEST_F(ImageOpsTest, Test_ImageYuvToRgbResize_Failed_With_Invalid_Params)
+{
+    std::vector<uint8_t> yuv(SHAPE_1920 * SHAPE_1080 * CHANNEL_THREE / 2, VALID_VALUE);
+    EXPECT_THROW(Image(yuv.data(), {SHAPE_11, SHAPE_10}, ImageFormat::NV12, DataType::UINT8, CPU),
+                 std::runtime_error);
+    Image nv12(yuv.data(), {SHAPE_1920, SHAPE_1080}, ImageFormat::NV12, DataType::UINT8, CPU);
+    Image rgb(g_vector1080PUint8Value100.data(), {SHAPE_1920, SHAPE_1080}, ImageFormat::RGB, DataType::UINT8, CPU);
+    Image dst;
+    EXPECT_EQ(ImageYuvToRgbResize(rgb, dst, SHAPE_224, SHAPE_224), ERR_INVALID_PARAM);
+    EXPECT_EQ(ImageYuvToRgbResize(nv12, dst, 1, SHAPE_224), ERR_INVALID_PARAM);
+    Tensor tensor;
+    EXPECT_EQ(ImageYuvToRgbResizeNormalize(nv12, tensor, SHAPE_224, SHAPE_224, {0.5f, 0.5f}, {0.5f, 0.5f}),
+              ERR_INVALID_PARAM);
+    EXPECT_EQ(ImageYuvToRgbResizeNormalize(nv12, tensor, SHAPE_224, SHAPE_224, {0.5f, 0.5f, 0.5f}, {0.5f, 0.0f, 0.5f}),
+              ERR_INVALID_PARAM);
+    EXPECT_EQ(ImageYuvToRgbResizeNormalize(nv12, tensor, SHAPE_224, SHAPE_224, {0.5f, 0.5f, 0.5f}, {0.5f, 0.5f, 0.5f},
+                                           TensorFormat::ND),
+              ERR_INVALID_PARAM);
+}
 } // namespace
 int main(int argc, char* argv[])
 {
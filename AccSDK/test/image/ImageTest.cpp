@@ -22,9 +22,12 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <vector>
+#include <utility>
 #include <cstdint>
 #include <fstream>
+#include <cmath>
 #include <cstring>
+#include <cstdio>
 #include <future>
 #include <filesystem>
 #include <gtest/gtest.h>
@@ -59,8 +62,9 @@ protected:
         return data;
     }
     std::filesystem::path validImPath = std::filesystem::path(__FILE__).parent_path() / "assets" / "dog_1920_1080.jpg";
+    std::filesystem::path pngImPath = std::filesystem::path(__FILE__).parent_path() / "assets" / "dog_1920_1080.png";
     std::filesystem::path invalidImPath =
-        std::filesystem::path(__FILE__).parent_path() / "assets" / "dog_1920_1080.png";
+        std::filesystem::path(__FILE__).parent_path().parent_path() / "data" / "audios" / "audio_test.wav";
 
     const size_t picWidth = 1920;
     const size_t picHeight = 1080;
@@ -157,6 +161,24 @@ TEST_F(ImageTest, Test_Create_Image_Clone_Should_Fail)
     ASSERT_EQ(ret, ERR_INVALID_PARAM);
 }
 
+TEST_F(ImageTest, Test_Image_Clone_Should_Share_Pixels_Until_MakeUnique)
+{
+    size_t nElem = IM_WIDTH * IM_HEIGHT * THREE_CHANNEL;
+    std::vector<uint8_t> imData = Create_Image_Data<uint8_t>(nElem);
+    Image img(imData.data(), {IM_WIDTH, IM_HEIGHT}, ImageFormat::RGB, DataType::UINT8, "cpu");
+    Image owned;
+    ASSERT_EQ(img.Clone(owned), SUCCESS);
+    // img wraps user memory so the first clone is a deep copy, clones of owned pixels share them
+    ASSERT_NE(owned.Ptr(), img.Ptr());
+    Image cloneImg;
+    ASSERT_EQ(owned.Clone(cloneImg), SUCCESS);
+    ASSERT_EQ(cloneImg.Ptr(), owned.Ptr());
+    ASSERT_EQ(cloneImg.MakeUnique(), SUCCESS);
+    ASSERT_NE(cloneImg.Ptr(), owned.Ptr());
+    ASSERT_EQ(std::memcmp(cloneImg.Ptr(), owned.Ptr(), owned.NumBytes()), 0);
+    ASSERT_EQ(cloneImg.Size(), owned.Size());
+}
+
 TEST_F(ImageTest, Test_Create_Image_On_CPU_Should_Success)
 {
     size_t nElem = IM_WIDTH * IM_HEIGHT * THREE_CHANNEL;
@@ -378,7 +400,7 @@ TEST_F(ImageTest, Test_Create_Image_From_Path_On_CPU_Should_Success)
     }
 }
 
-TEST_F(ImageTest, Test_Create_Image_From_Invalid_Postfix_On_CPU_Should_Fail)
+TEST_F(ImageTest, Test_Create_Image_From_Non_Image_File_On_CPU_Should_Fail)
 {
     const char* device = "cpu";
     bool isFailed = false;
@@ -412,6 +434,240 @@ TEST_F(ImageTest, Test_Create_Image_From_Path_Nullptr_Should_Fail)
     EXPECT_THROW(Image(nullptr, device), std::runtime_error);
 }
 
+TEST_F(ImageTest, Test_Create_Image_From_Buffer_On_CPU_Should_Success)
+{
+    std::string pathStr = validImPath.string();
+    chmod(pathStr.c_str(), 0640);
+    std::ifstream in(pathStr, std::ios::binary);
+    std::vector<uint8_t> jpeg((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    Image img(jpeg.data(), jpeg.size());
+    ASSERT_EQ(img.Size(), (std::vector<size_t>{picWidth, picHeight}));
+    ASSERT_EQ(img.Format(), ImageFormat::RGB);
+    Image expect(pathStr.c_str(), "cpu");
+    EXPECT_EQ(memcmp(img.Ptr(), expect.Ptr(), expect.NumBytes()), 0);
+
+    EXPECT_THROW(Image(jpeg.data(), jpeg.size() / 2), std::runtime_error);
+    EXPECT_THROW(Image(static_cast<const uint8_t*>(nullptr), jpeg.size()), std::runtime_error);
+    EXPECT_THROW(Image(jpeg.data(), jpeg.size(), "npu"), std::runtime_error);
+}
+
+TEST_F(ImageTest, Test_Decode_Image_Base64_On_CPU_Should_Success)
+{
+    std::string pathStr = validImPath.string();
+    chmod(pathStr.c_str(), 0640);
+    std::ifstream in(pathStr, std::ios::binary);
+    std::vector<uint8_t> jpeg((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string text = "data:image/jpeg;base64,";
+    size_t i = 0;
+    for (; i + 3 <= jpeg.size(); i += 3) {
+        uint32_t triple = (jpeg[i] << 16) | (jpeg[i + 1] << 8) | jpeg[i + 2];
+        for (int shift = 18; shift >= 0; shift -= 6) {
+            text += alphabet[(triple >> shift) & 0x3F];
+        }
+    }
+    // the padding is optional, a partial last group is enough
+    uint32_t rest = 0;
+    for (size_t j = i; j < jpeg.size(); j++) {
+        rest |= static_cast<uint32_t>(jpeg[j]) << (16 - 8 * (j - i));
+    }
+    for (size_t j = 0; j <= jpeg.size() - i && i < jpeg.size(); j++) {
+        text += alphabet[(rest >> (18 - 6 * j)) & 0x3F];
+    }
+    Image img;
+    ASSERT_EQ(DecodeImageBase64(text.data(), text.size(), img), SUCCESS);
+    Image expect(pathStr.c_str(), "cpu");
+    ASSERT_EQ(img.Size(), expect.Size());
+    EXPECT_EQ(memcmp(img.Ptr(), expect.Ptr(), expect.NumBytes()), 0);
+
+    text[text.size() / 2] = '*';
+    EXPECT_EQ(DecodeImageBase64(text.data(), text.size(), img), ERR_INVALID_PARAM);
+}
+
+TEST_F(ImageTest, Test_Create_Image_From_Png_On_CPU_Should_Success)
+{
+    std::string pathStr = pngImPath.string();
+    chmod(pathStr.c_str(), 0640);
+    Image img(pathStr.c_str(), "cpu");
+    ASSERT_EQ(img.Size(), (std::vector<size_t>{picWidth, picHeight}));
+    ASSERT_EQ(img.Format(), ImageFormat::RGB);
+
+    std::ifstream in(pathStr, std::ios::binary);
+    std::vector<uint8_t> png((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    Image fromBuffer(png.data(), png.size());
+    ASSERT_EQ(fromBuffer.NumBytes(), img.NumBytes());
+    EXPECT_EQ(memcmp(fromBuffer.Ptr(), img.Ptr(), img.NumBytes()), 0);
+    EXPECT_THROW(Image(png.data(), png.size() / 2), std::runtime_error);
+}
+
+TEST_F(ImageTest, Test_Create_Image_From_Any_Suffix_On_CPU_Should_Success)
+{
+    std::string jpegPath = validImPath.string();
+    std::string pngPath = pngImPath.string();
+    chmod(jpegPath.c_str(), 0640);
+    chmod(pngPath.c_str(), 0640);
+    // the decoder is picked from the file content, a misleading or missing suffix is fine
+    const std::vector<std::pair<std::string, std::string>> renamed = {
+        {jpegPath, "suffix_test_image.png"}, {pngPath, "suffix_test_image.JPG"}, {jpegPath, "suffix_test_image"}};
+    for (const auto& item : renamed) {
+        std::filesystem::copy_file(item.first, item.second, std::filesystem::copy_options::overwrite_existing);
+        chmod(item.second.c_str(), 0640);
+        Image expect(item.first.c_str(), "cpu");
+        Image img(item.second.c_str(), "cpu");
+        std::remove(item.second.c_str());
+        ASSERT_EQ(img.NumBytes(), expect.NumBytes());
+        EXPECT_EQ(memcmp(img.Ptr(), expect.Ptr(), expect.NumBytes()), 0);
+    }
+}
+
+TEST_F(ImageTest, Test_Decode_Images_With_Mixed_Formats_Should_Success)
+{
+    std::string jpegPath = validImPath.string();
+    std::string pngPath = pngImPath.string();
+    chmod(jpegPath.c_str(), 0640);
+    chmod(pngPath.c_str(), 0640);
+    std::vector<std::string> paths = {jpegPath, pngPath, jpegPath, pngPath};
+    std::vector<Image> images;
+    std::vector<ErrorCode> statuses;
+    ASSERT_EQ(DecodeImages(paths, images, statuses), SUCCESS);
+    Image expectJpeg(jpegPath.c_str(), "cpu");
+    Image expectPng(pngPath.c_str(), "cpu");
+    for (size_t i = 0; i < paths.size(); i++) {
+        const Image& expect = (i % 2 == 0) ? expectJpeg : expectPng;
+        ASSERT_EQ(images[i].NumBytes(), expect.NumBytes());
+        EXPECT_EQ(memcmp(images[i].Ptr(), expect.Ptr(), expect.NumBytes()), 0);
+    }
+}
+
+TEST_F(ImageTest, Test_Probe_Images_Should_Report_Size_Per_Path)
+{
+    std::string pathStr = validImPath.string();
+    chmod(pathStr.c_str(), 0640);
+    std::vector<std::string> paths = {pathStr, invalidImPath.string(), pathStr};
+    std::vector<ImageProbeInfo> infos;
+    ErrorCode ret = ProbeImages(paths, infos);
+    EXPECT_EQ(ret, ERR_INVALID_PARAM);
+    ASSERT_EQ(infos.size(), paths.size());
+    for (size_t i : {0, 2}) {
+        EXPECT_EQ(infos[i].status, SUCCESS);
+        EXPECT_EQ(infos[i].width, picWidth);
+        EXPECT_EQ(infos[i].height, picHeight);
+    }
+    EXPECT_EQ(infos[1].status, ERR_INVALID_PARAM);
+    EXPECT_EQ(infos[1].width, 0);
+
+    ImageProbeInfo info;
+    EXPECT_EQ(ProbeImage(nullptr, info), ERR_INVALID_PARAM);
+}
+
+TEST_F(ImageTest, Test_Decode_Images_Should_Report_Status_Per_Item)
+{
+    std::string pathStr = validImPath.string();
+    chmod(pathStr.c_str(), 0640);
+    std::vector<std::string> paths = {pathStr, invalidImPath.string(), pathStr};
+    std::vector<Image> images;
+    std::vector<ErrorCode> statuses;
+    ErrorCode ret = DecodeImages(paths, images, statuses);
+    EXPECT_EQ(ret, ERR_INVALID_PARAM);
+    ASSERT_EQ(images.size(), paths.size());
+    ASSERT_EQ(statuses.size(), paths.size());
+    Image expect(pathStr.c_str(), "cpu");
+    for (size_t i : {0, 2}) {
+        EXPECT_EQ(statuses[i], SUCCESS);
+        ASSERT_EQ(images[i].Size(), (std::vector<size_t>{picWidth, picHeight}));
+        ASSERT_EQ(images[i].Format(), ImageFormat::RGB);
+        EXPECT_EQ(memcmp(images[i].Ptr(), expect.Ptr(), expect.NumBytes()), 0);
+    }
+    EXPECT_EQ(statuses[1], ERR_INVALID_PARAM);
+    EXPECT_EQ(images[1].Ptr(), nullptr);
+}
+
+TEST_F(ImageTest, Test_Decode_Images_From_Buffers_With_Resize_Should_Success)
+{
+    std::string pathStr = validImPath.string();
+    chmod(pathStr.c_str(), 0640);
+    std::ifstream in(pathStr, std::ios::binary);
+    std::vector<uint8_t> jpeg((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    const size_t batchSize = 2 * static_cast<size_t>(numThread);
+    std::vector<ImageBuffer> buffers(batchSize, ImageBuffer{jpeg.data(), jpeg.size()});
+    buffers[1] = ImageBuffer{jpeg.data(), jpeg.size() / 2};
+    ImageDecodeOptions options;
+    options.resizeWidth = IM_WIDTH;
+    options.resizeHeight = IM_HEIGHT;
+    std::vector<Image> images;
+    std::vector<ErrorCode> statuses;
+    EXPECT_NE(DecodeImages(buffers, images, statuses, options), SUCCESS);
+    ASSERT_EQ(statuses.size(), batchSize);
+    EXPECT_NE(statuses[1], SUCCESS);
+    for (size_t i = 0; i < batchSize; i++) {
+        if (i == 1) {
+            continue;
+        }
+        ASSERT_EQ(statuses[i], SUCCESS);
+        ASSERT_EQ(images[i].Size(), (std::vector<size_t>{IM_WIDTH, IM_HEIGHT}));
+        EXPECT_EQ(memcmp(images[i].Ptr(), images[0].Ptr(), images[0].NumBytes()), 0);
+    }
+
+    options.resizeHeight = 0;
+    EXPECT_EQ(DecodeImages(buffers, images, statuses, options), ERR_INVALID_PARAM);
+    EXPECT_EQ(statuses[0], ERR_INVALID_PARAM);
+}
+
+TEST_F(ImageTest, Test_Encode_Jpeg_Should_Decode_Back_Close_To_Source)
+{
+    std::string pathStr = validImPath.string();
+    chmod(pathStr.c_str(), 0640);
+    Image src(pathStr.c_str(), "cpu");
+    std::vector<uint8_t> encoded;
+    ASSERT_EQ(src.EncodeJpeg(encoded), SUCCESS);
+    EXPECT_EQ(encoded.capacity(), encoded.size());
+    Image decoded(encoded.data(), encoded.size(), "cpu");
+    ASSERT_EQ(decoded.Size(), src.Size());
+    const auto* a = static_cast<const uint8_t*>(src.Ptr());
+    const auto* b = static_cast<const uint8_t*>(decoded.Ptr());
+    double sum = 0.0;
+    for (size_t i = 0; i < src.NumBytes(); i++) {
+        sum += std::abs(static_cast<int>(a[i]) - static_cast<int>(b[i]));
+    }
+    const double maxMeanAbsDiff = 3.0;
+    EXPECT_LT(sum / static_cast<double>(src.NumBytes()), maxMeanAbsDiff);
+
+    std::vector<uint8_t> smaller;
+    const int lowQuality = 30;
+    ASSERT_EQ(src.EncodeJpeg(smaller, lowQuality), SUCCESS);
+    EXPECT_LT(smaller.size(), encoded.size());
+    EXPECT_EQ(src.EncodeJpeg(smaller, 0), ERR_INVALID_PARAM);
+    EXPECT_EQ(src.EncodeJpeg(smaller, 101), ERR_INVALID_PARAM);
+}
+
+TEST_F(ImageTest, Test_Encode_Jpegs_Should_Report_Status_Per_Item)
+{
+    size_t nElem = IM_WIDTH * IM_HEIGHT * THREE_CHANNEL;
+    std::vector<uint8_t> imData = Create_Image_Data<uint8_t>(nElem);
+    Image rgb(imData.data(), {IM_WIDTH, IM_HEIGHT}, ImageFormat::RGB, DataType::UINT8, "cpu");
+    Image planar(imData.data(), {IM_WIDTH, IM_HEIGHT}, ImageFormat::RGB_PLANAR, DataType::UINT8, "cpu");
+    std::vector<uint8_t> expect;
+    ASSERT_EQ(rgb.EncodeJpeg(expect), SUCCESS);
+
+    const size_t batchSize = 2 * static_cast<size_t>(numThread);
+    std::vector<Image> images(batchSize, rgb);
+    images[1] = planar;
+    std::vector<std::vector<uint8_t>> encoded;
+    std::vector<ErrorCode> statuses;
+    EXPECT_EQ(EncodeJpegs(images, encoded, statuses), ERR_INVALID_PARAM);
+    ASSERT_EQ(statuses.size(), batchSize);
+    ASSERT_EQ(encoded.size(), batchSize);
+    EXPECT_EQ(statuses[1], ERR_INVALID_PARAM);
+    EXPECT_TRUE(encoded[1].empty());
+    for (size_t i = 0; i < batchSize; i++) {
+        if (i == 1) {
+            continue;
+        }
+        ASSERT_EQ(statuses[i], SUCCESS);
+        EXPECT_EQ(encoded[i], expect);
+    }
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,258 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: ImageUtilsTest Cpp file, jpeg and png decoding on synthetic thumbnails.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <png.h>
+#include "acc/ErrorCode.h"
+#include "acc/utils/ImageUtils.h"
+
+using namespace Acc;
+namespace {
+constexpr int THUMB_WIDTH = 96;
+constexpr int THUMB_HEIGHT = 64;
+constexpr int THUMB_QUALITY = 85;
+constexpr size_t CORPUS_SIZE = 64;
+constexpr size_t THREE_CHANNEL = 3;
+constexpr size_t FOUR_CHANNEL = 4;
+constexpr size_t NUM_THREADS = 4;
+constexpr int NOISE_AMPLITUDE = 16;
+
+class ImageUtilsTest : public testing::Test {
+protected:
+    static void SetUpTestSuite()
+    {
+        corpusDir_ = std::filesystem::temp_directory_path() / "acc_image_utils_test";
+        std::filesystem::create_directories(corpusDir_);
+        std::mt19937 gen(0);
+        std::uniform_int_distribution<int> noise(0, NOISE_AMPLITUDE);
+        std::vector<uint8_t> pixels(THUMB_WIDTH * THUMB_HEIGHT * THREE_CHANNEL);
+        tjhandle compressor = GetJpegCompressor();
+        ASSERT_NE(compressor, nullptr);
+        for (size_t n = 0; n < CORPUS_SIZE; n++) {
+            // gradients shifted per image plus noise, so that every file takes a different entropy path
+            for (int h = 0; h < THUMB_HEIGHT; h++) {
+                for (int w = 0; w < THUMB_WIDTH; w++) {
+                    uint8_t* px = pixels.data() + (h * THUMB_WIDTH + w) * THREE_CHANNEL;
+                    px[0] = static_cast<uint8_t>((w * 2 + n * 3) + noise(gen));
+                    px[1] = static_cast<uint8_t>((h * 3 + n * 5) + noise(gen));
+                    px[2] = static_cast<uint8_t>((w + h + n * 7) + noise(gen));
+                }
+            }
+            unsigned char* jpegBuf = nullptr;
+            unsigned long jpegSize = 0;
+            int ret = tjCompress2(compressor, pixels.data(), THUMB_WIDTH, 0, THUMB_HEIGHT, TJPF_RGB, &jpegBuf,
+                                  &jpegSize, TJSAMP_420, THUMB_QUALITY, 0);
+            ASSERT_EQ(ret, 0);
+            auto path = corpusDir_ / ("thumb_" + std::to_string(n) + ".jpg");
+            std::ofstream out(path, std::ios::binary);
+            out.write(reinterpret_cast<const char*>(jpegBuf), static_cast<std::streamsize>(jpegSize));
+            tjFree(jpegBuf);
+            corpus_.push_back(path.string());
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        std::filesystem::remove_all(corpusDir_);
+        corpus_.clear();
+    }
+
+    // Encode a synthetic image losslessly, the png decoder must give back the exact pixels.
+    static std::vector<uint8_t> EncodePng(const std::vector<uint8_t>& pixels, png_uint_32 format)
+    {
+        png_image image{};
+        image.version = PNG_IMAGE_VERSION;
+        image.width = THUMB_WIDTH;
+        image.height = THUMB_HEIGHT;
+        image.format = format;
+        png_alloc_size_t size = 0;
+        if (png_image_write_get_memory_size(image, size, 0, pixels.data(), 0, nullptr) == 0) {
+            return {};
+        }
+        std::vector<uint8_t> png(size);
+        if (png_image_write_to_memory(&image, png.data(), &size, 0, pixels.data(), 0, nullptr) == 0) {
+            return {};
+        }
+        png.resize(size);
+        return png;
+    }
+
+    static std::filesystem::path corpusDir_;
+    static std::vector<std::string> corpus_;
+};
+
+std::filesystem::path ImageUtilsTest::corpusDir_;
+std::vector<std::string> ImageUtilsTest::corpus_;
+
+TEST_F(ImageUtilsTest, Test_GetJpegDecompressor_Should_Return_Same_Handle_In_Thread)
+{
+    tjhandle first = GetJpegDecompressor();
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(GetJpegDecompressor(), first);
+    EXPECT_NE(GetJpegCompressor(), first);
+
+    tjhandle other = nullptr;
+    std::thread worker([&other]() { other = GetJpegDecompressor(); });
+    worker.join();
+    EXPECT_NE(other, nullptr);
+    EXPECT_NE(other, first);
+}
+
+TEST_F(ImageUtilsTest, Test_ReadJpegData_Should_Success_With_Reused_Handle)
+{
+    for (const auto& path : corpus_) {
+        std::shared_ptr<unsigned char[]> decoded;
+        int width = 0;
+        int height = 0;
+        ASSERT_EQ(ReadJpegData(path.c_str(), width, height, decoded), SUCCESS);
+        EXPECT_EQ(width, THUMB_WIDTH);
+        EXPECT_EQ(height, THUMB_HEIGHT);
+        ASSERT_NE(decoded, nullptr);
+    }
+}
+
+TEST_F(ImageUtilsTest, Test_ReadJpegData_Should_Recover_After_Invalid_Data)
+{
+    auto broken = corpusDir_ / "broken.jpg";
+    {
+        std::ofstream out(broken, std::ios::binary);
+        out << "not a jpeg file";
+    }
+    std::shared_ptr<unsigned char[]> decoded;
+    int width = 0;
+    int height = 0;
+    EXPECT_NE(ReadJpegData(broken.string().c_str(), width, height, decoded), SUCCESS);
+    // the cached handle keeps working after a failed decode
+    EXPECT_EQ(ReadJpegData(corpus_[0].c_str(), width, height, decoded), SUCCESS);
+    std::filesystem::remove(broken);
+}
+
+TEST_F(ImageUtilsTest, Test_ReadJpeg_Should_Check_Content_Instead_Of_Suffix)
+{
+    auto renamed = corpusDir_ / "thumb.bin";
+    std::filesystem::copy_file(corpus_[0], renamed, std::filesystem::copy_options::overwrite_existing);
+    auto fake = corpusDir_ / "fake.jpg";
+    {
+        const uint8_t png[] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+        std::ofstream out(fake, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(png), sizeof(png));
+    }
+    std::shared_ptr<unsigned char[]> decoded;
+    int width = 0;
+    int height = 0;
+    EXPECT_EQ(ReadJpegHeader(renamed.string().c_str(), width, height), SUCCESS);
+    EXPECT_EQ(ReadJpegData(renamed.string().c_str(), width, height, decoded), SUCCESS);
+    EXPECT_EQ(ReadJpegHeader(fake.string().c_str(), width, height), ERR_UNSUPPORTED_TYPE);
+    EXPECT_EQ(ReadJpegData(fake.string().c_str(), width, height, decoded), ERR_UNSUPPORTED_TYPE);
+    EXPECT_EQ(ReadJpegResized(fake.string().c_str(), THUMB_WIDTH, THUMB_HEIGHT, decoded), ERR_UNSUPPORTED_TYPE);
+    EXPECT_EQ(ReadJpegRegion(fake.string().c_str(), 0, 0, THUMB_HEIGHT, THUMB_WIDTH, decoded), ERR_UNSUPPORTED_TYPE);
+    std::filesystem::remove(renamed);
+    std::filesystem::remove(fake);
+}
+
+TEST_F(ImageUtilsTest, Test_ReadJpegData_Should_Success_With_Multi_Threads)
+{
+    std::vector<std::thread> workers;
+    std::vector<int> failures(NUM_THREADS, 0);
+    for (size_t t = 0; t < NUM_THREADS; t++) {
+        workers.emplace_back([t, &failures]() {
+            for (size_t i = t; i < corpus_.size(); i += NUM_THREADS) {
+                std::shared_ptr<unsigned char[]> decoded;
+                int width = 0;
+                int height = 0;
+                failures[t] += ReadJpegData(corpus_[i].c_str(), width, height, decoded) != SUCCESS;
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (size_t t = 0; t < NUM_THREADS; t++) {
+        EXPECT_EQ(failures[t], 0);
+    }
+}
+
+TEST_F(ImageUtilsTest, Test_SniffImageCodec_Should_Detect_Magic_Bytes)
+{
+    std::ifstream in(corpus_[0], std::ios::binary);
+    std::vector<uint8_t> jpeg((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(SniffImageCodec(jpeg.data(), jpeg.size()), ImageCodec::JPEG);
+    const uint8_t png[] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+    EXPECT_EQ(SniffImageCodec(png, sizeof(png)), ImageCodec::PNG);
+    EXPECT_EQ(SniffImageCodec(png, sizeof(png) - 1), ImageCodec::UNKNOWN);
+    const uint8_t webp[] = {'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'E', 'B', 'P'};
+    EXPECT_EQ(SniffImageCodec(webp, sizeof(webp)), ImageCodec::WEBP);
+    const uint8_t wav[] = {'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E'};
+    EXPECT_EQ(SniffImageCodec(wav, sizeof(wav)), ImageCodec::UNKNOWN);
+    EXPECT_EQ(SniffImageCodec(nullptr, sizeof(png)), ImageCodec::UNKNOWN);
+
+    int width = 0;
+    int height = 0;
+    std::shared_ptr<unsigned char[]> decoded;
+    EXPECT_EQ(DecodeImageData(wav, sizeof(wav), width, height, decoded), ERR_UNSUPPORTED_TYPE);
+}
+
+TEST_F(ImageUtilsTest, Test_DecodeImageData_Png_Should_Return_Exact_Pixels)
+{
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<int> value(0, UINT8_MAX);
+    std::vector<uint8_t> rgba(THUMB_WIDTH * THUMB_HEIGHT * FOUR_CHANNEL);
+    for (auto& v : rgba) {
+        v = static_cast<uint8_t>(value(gen));
+    }
+    std::vector<uint8_t> rgb(THUMB_WIDTH * THUMB_HEIGHT * THREE_CHANNEL);
+    for (size_t i = 0; i < THUMB_WIDTH * THUMB_HEIGHT; i++) {
+        std::copy_n(rgba.data() + i * FOUR_CHANNEL, THREE_CHANNEL, rgb.data() + i * THREE_CHANNEL);
+    }
+    // the alpha channel is dropped, not composited
+    for (bool withAlpha : {false, true}) {
+        std::vector<uint8_t> png = withAlpha ? EncodePng(rgba, PNG_FORMAT_RGBA) : EncodePng(rgb, PNG_FORMAT_RGB);
+        ASSERT_FALSE(png.empty());
+        int width = 0;
+        int height = 0;
+        std::shared_ptr<unsigned char[]> decoded;
+        ASSERT_EQ(DecodeImageData(png.data(), png.size(), width, height, decoded), SUCCESS);
+        ASSERT_EQ(width, THUMB_WIDTH);
+        ASSERT_EQ(height, THUMB_HEIGHT);
+        EXPECT_EQ(std::memcmp(decoded.get(), rgb.data(), rgb.size()), 0);
+
+        EXPECT_EQ(DecodeImageData(png.data(), png.size() / 2, width, height, decoded), ERR_LIBPNG_READ_FILE_FAILURE);
+        ASSERT_EQ(DecodeImageDataResized(png.data(), png.size(), THUMB_WIDTH / 2, THUMB_HEIGHT / 2, decoded),
+                  SUCCESS);
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    return ret;
+}
@@ -70,7 +70,7 @@ class TestPyImage(BaseTestCase):
     @classmethod
     def setUpClass(cls):
         cls.valid_path = "../../image/assets/dog_1920_1080.jpg"
-        cls.invalid_path = "../../image/assets/dog_1920_1080.png"
+        cls.invalid_path = "../../data/audios/audio_test.wav"
 
     def test_create_empty_image_should_fail(self):
         is_failed = False
@@ -104,6 +104,58 @@ class TestQwenPreprocess(BaseTestCase):
         with self.assertRaises(RuntimeError):
             acc.Qwen2VLProcessor.Preprocess([img], MEAN, [0.1], DEFAULT_WIDTH, DEFAULT_HEIGHT)
 
+    def test_preprocess_patches_should_success(self):
+        images = []
+        for _ in range(2):
+            buf = create_buffer_ptr()
+            fake_np = FakeArray(buf, (DEFAULT_HEIGHT, DEFAULT_WIDTH, DEFAULT_CHANNEL), "|u1")
+            images.append(acc.Image.from_numpy(fake_np, acc.ImageFormat_RGB, b"cpu"))
+        resize = PATCH_SIZE * MERGE_SIZE * 2
+        result = acc.Qwen2VLProcessor.PreprocessPatches(images, MEAN, STD, resize, resize, PATCH_SIZE,
+                                                        TEMPORAL_PATCH_SIZE, MERGE_SIZE)
+        grid = resize // PATCH_SIZE
+        self.assertEqual(list(result.grid_thw), [1, grid, grid] * len(images))
+        self.assertEqual(list(result.pixel_values.shape),
+                         [len(images) * grid * grid,
+                          DEFAULT_CHANNEL * TEMPORAL_PATCH_SIZE * PATCH_SIZE * PATCH_SIZE])
+
+    def test_preprocess_patches_with_smart_resize_should_success(self):
+        sizes = [(DEFAULT_HEIGHT, DEFAULT_WIDTH), (DEFAULT_HEIGHT * 2, DEFAULT_WIDTH)]
+        images = []
+        for height, width in sizes:
+            buf = create_buffer_ptr(width, height)
+            fake_np = FakeArray(buf, (height, width, DEFAULT_CHANNEL), "|u1")
+            images.append(acc.Image.from_numpy(fake_np, acc.ImageFormat_RGB, b"cpu"))
+        # 64 x 64 is smart resized to 56 x 56 and 128 x 64 to 140 x 56
+        result = acc.Qwen2VLProcessor.PreprocessPatches(images, MEAN, STD, 0, 0, PATCH_SIZE,
+                                                        TEMPORAL_PATCH_SIZE, MERGE_SIZE)
+        self.assertEqual(list(result.grid_thw), [1, 4, 4, 1, 10, 4])
+        self.assertEqual(list(result.pixel_values.shape),
+                         [4 * 4 + 10 * 4, DEFAULT_CHANNEL * TEMPORAL_PATCH_SIZE * PATCH_SIZE * PATCH_SIZE])
+
+    def test_preprocess_video_patches_should_success(self):
+        frames = []
+        for _ in range(3):
+            buf = create_buffer_ptr()
+            fake_np = FakeArray(buf, (DEFAULT_HEIGHT, DEFAULT_WIDTH, DEFAULT_CHANNEL), "|u1")
+            frames.append(acc.Image.from_numpy(fake_np, acc.ImageFormat_RGB, b"cpu"))
+        resize = PATCH_SIZE * MERGE_SIZE * 2
+        result = acc.Qwen2VLProcessor.PreprocessVideoPatches(frames, MEAN, STD, resize, resize, PATCH_SIZE,
+                                                             TEMPORAL_PATCH_SIZE, MERGE_SIZE)
+        grid = resize // PATCH_SIZE
+        grid_t = (len(frames) + TEMPORAL_PATCH_SIZE - 1) // TEMPORAL_PATCH_SIZE
+        self.assertEqual(list(result.grid_thw), [grid_t, grid, grid])
+        self.assertEqual(list(result.pixel_values.shape),
+                         [grid_t * grid * grid, DEFAULT_CHANNEL * TEMPORAL_PATCH_SIZE * PATCH_SIZE * PATCH_SIZE])
+
+    def test_preprocess_patches_with_unaligned_size_should_fail(self):
+        buf = create_buffer_ptr()
+        fake_np = FakeArray(buf, (DEFAULT_HEIGHT, DEFAULT_WIDTH, DEFAULT_CHANNEL), "|u1")
+        img = acc.Image.from_numpy(fake_np, acc.ImageFormat_RGB, b"cpu")
+        with self.assertRaises(RuntimeError):
+            acc.Qwen2VLProcessor.PreprocessPatches([img], MEAN, STD, DEFAULT_WIDTH, DEFAULT_HEIGHT, PATCH_SIZE,
+                                                   TEMPORAL_PATCH_SIZE, MERGE_SIZE)
+
 
 if __name__ == "__main__":
     failed = TestQwenPreprocess.run_tests()
@@ -33,10 +33,10 @@
 using namespace Acc;
 namespace {
 constexpr char* CPU = "cpu";
-constexpr int TOTAL_BYTES = 100;
 constexpr size_t SHAPE_H = 10;
 constexpr size_t SHAPE_W = 11;
 constexpr size_t SHAPE_C = 3;
+constexpr size_t TOTAL_BYTES = SHAPE_H * SHAPE_W * SHAPE_C;
 constexpr size_t SMALL_H = 5;
 constexpr size_t SMALL_W = 6;
 constexpr size_t LARGE_H = 8193;
@@ -19,9 +19,12 @@
  * Create: 2025
  * History: NA
  */
+#include <cstring>
+#include <vector>
 #include <gtest/gtest.h>
 #include "acc/tensor/Tensor.h"
 #include "acc/tensor/TensorOps.h"
+#include "acc/utils/ThreadPool.h"
 using namespace Acc;
 namespace {
 constexpr size_t BATCH_SIZE_ONE = 1;
@@ -123,6 +126,26 @@ TEST_F(TensorOpsTest, Test_TensorResize_Success_Use_Cpu_With_ImplicitMalloc)
     EXPECT_EQ(ret, SUCCESS);
 }
 
+TEST_F(TensorOpsTest, Test_TensorResize_In_Pool_Task_Should_Match_Fan_Out)
+{
+    std::vector<uint8_t> data(SHAPE_1080 * SHAPE_1920 * CHANNEL_THREE);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i * 7 % 251);
+    }
+    Tensor src(data.data(), {BATCH_SIZE_ONE, SHAPE_1080, SHAPE_1920, CHANNEL_THREE}, DataType::UINT8,
+               TensorFormat::NHWC, CPU);
+    Tensor expect;
+    ASSERT_EQ(TensorResize(src, expect, SHAPE_540, SHAPE_960, Interpolation::BICUBIC, DeviceMode::CPU), SUCCESS);
+    // a resize issued from a pool worker runs its rows inline instead of waiting on nested pool tasks
+    Tensor inTask;
+    auto future = ThreadPool::GetInstance().Submit([&src, &inTask]() {
+        return TensorResize(src, inTask, SHAPE_540, SHAPE_960, Interpolation::BICUBIC, DeviceMode::CPU);
+    });
+    ASSERT_EQ(future.get(), SUCCESS);
+    ASSERT_EQ(inTask.NumBytes(), expect.NumBytes());
+    EXPECT_EQ(memcmp(inTask.Ptr(), expect.Ptr(), expect.NumBytes()), 0);
+}
+
 TEST_F(TensorOpsTest, Test_TensorResize_Should_Return_Failed_Use_Cpu_With_Invalid_Params)
 {
     Tensor src(g_vector1080PUint8Value100.data(), {BATCH_SIZE_ONE, SHAPE_1080, SHAPE_1920, CHANNEL_THREE},
@@ -227,12 +250,47 @@ TEST_F(TensorOpsTest, Test_TensorNormalize_Should_Return_Failed_With_Invalid_Par
 
 TEST_F(TensorOpsTest, Test_TensorNormalize_Should_Return_Failed_With_Invalid_Dtype)
 {
-    Tensor src(g_vector1080PUint8Value100.data(), {BATCH_SIZE_TWO, SHAPE_1080, SHAPE_1920, CHANNEL_THREE},
+    Tensor src(g_vector1080PUint8Value100.data(), {BATCH_SIZE_ONE, SHAPE_1080, SHAPE_1920, CHANNEL_THREE},
+               DataType::INT8, TensorFormat::NHWC, CPU);
+    Tensor dst;
+    std::vector<float> mean = {0.1f, 0.1f, 0.1f};
+    std::vector<float> std = {0.1f, 0.1f, 0.1f};
+    auto ret = TensorNormalize(src, dst, mean, std, DeviceMode::CPU);
+    EXPECT_EQ(ret, ERR_INVALID_PARAM);
+}
+
+TEST_F(TensorOpsTest, Test_TensorNormalize_Should_Return_Success_With_Uint8_Input)
+{
+    Tensor src(g_vector1080PUint8Value100.data(), {BATCH_SIZE_ONE, SHAPE_1080, SHAPE_1920, CHANNEL_THREE},
                DataType::UINT8, TensorFormat::NHWC, CPU);
     Tensor dst;
     std::vector<float> mean = {0.1f, 0.1f, 0.1f};
     std::vector<float> std = {0.1f, 0.1f, 0.1f};
     auto ret = TensorNormalize(src, dst, mean, std, DeviceMode::CPU);
+    EXPECT_EQ(ret, SUCCESS);
+    EXPECT_EQ(dst.DType(), DataType::FLOAT32);
+    EXPECT_EQ(dst.NumBytes(), src.NumBytes() * sizeof(float));
+}
+
+TEST_F(TensorOpsTest, Test_TensorNormalize_Should_Return_Success_With_Half_Output)
+{
+    Tensor src(g_vector1080PFloatValue100.data(), {BATCH_SIZE_ONE, SHAPE_1080, SHAPE_1920, CHANNEL_THREE},
+               DataType::FLOAT32, TensorFormat::NHWC, CPU);
+    std::vector<float> mean = {0.1f, 0.1f, 0.1f};
+    std::vector<float> std = {0.1f, 0.1f, 0.1f};
+    Tensor dst;
+    auto ret = TensorNormalize(src, dst, mean, std, DeviceMode::CPU, DataType::FLOAT16);
+    EXPECT_EQ(ret, SUCCESS);
+    EXPECT_EQ(dst.DType(), DataType::FLOAT16);
+    EXPECT_EQ(dst.NumBytes(), src.NumBytes() / 2);
+
+    Tensor dst2;
+    ret = TensorNormalize(src, dst2, mean, std, DeviceMode::CPU, DataType::BFLOAT16);
+    EXPECT_EQ(ret, SUCCESS);
+    EXPECT_EQ(dst2.DType(), DataType::BFLOAT16);
+
+    Tensor dst3;
+    ret = TensorNormalize(src, dst3, mean, std, DeviceMode::CPU, DataType::UINT8);
     EXPECT_EQ(ret, ERR_INVALID_PARAM);
 }
 
@@ -249,6 +307,21 @@ TEST_F(TensorOpsTest, Test_TensorToTensor_Should_Return_Success)
     EXPECT_EQ(ret, SUCCESS);
 }
 
+TEST_F(TensorOpsTest, Test_TensorToTensor_Should_Return_Success_With_Half_Output)
+{
+    Tensor src(g_vector1080PUint8Value100.data(), {BATCH_SIZE_ONE, SHAPE_1080, SHAPE_1920, CHANNEL_THREE},
+               DataType::UINT8, TensorFormat::NHWC, CPU);
+    Tensor dst;
+    auto ret = TensorToTensor(src, dst, TensorFormat::NCHW, DeviceMode::CPU, DataType::BFLOAT16);
+    EXPECT_EQ(ret, SUCCESS);
+    EXPECT_EQ(dst.DType(), DataType::BFLOAT16);
+    EXPECT_EQ(dst.NumBytes(), src.NumBytes() * 2);
+
+    Tensor dst2;
+    ret = TensorToTensor(src, dst2, TensorFormat::NCHW, DeviceMode::CPU, DataType::INT8);
+    EXPECT_EQ(ret, ERR_INVALID_PARAM);
+}
+
 TEST_F(TensorOpsTest, Test_TensorToTensor_Should_Return_Failed_With_Invalid_Target_format)
 {
     Tensor src(g_vector1080PUint8Value100.data(), {BATCH_SIZE_ONE, SHAPE_1080, SHAPE_1920, CHANNEL_THREE},
@@ -21,10 +21,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <climits>
 #include "acc/tensor/Tensor.h"
+#include "acc/tensor/TensorOps.h"
 
 using namespace Acc;
 namespace {
@@ -33,6 +35,10 @@ constexpr char* CPU = "cpu";
 constexpr int TOTAL_BYTES = 10;
 constexpr int SHAPE_H = 2;
 constexpr int SHAPE_W = 5;
+constexpr size_t OP_SRC_SIZE = 16;
+constexpr size_t OP_DST_SIZE = 10;
+constexpr size_t OP_CHANNEL = 3;
+constexpr std::uint8_t OP_SRC_VALUE = 100;
 class TensorTest : public testing::Test {
 };
 
@@ -44,7 +50,7 @@ TEST_F(TensorTest, Test_Tensor_Construct_With_SharedPtr_Should_Return_Success_Wh
     Tensor tensor(arr, tensorShape, DataType::INT8, TensorFormat::ND, CPU);
     EXPECT_EQ(tensor.Shape(), tensorShape);
     EXPECT_EQ(tensor.DType(), DataType::INT8);
-    EXPECT_STREQ(tensor.Device().get(), CPU);
+    EXPECT_STREQ(tensor.Device(), CPU);
     EXPECT_EQ(tensor.Format(), TensorFormat::ND);
     EXPECT_EQ(tensor.NumBytes(), tensorShape[0] * tensorShape[1]);
     EXPECT_EQ(tensor.Ptr(), arr.get());
@@ -74,7 +80,7 @@ TEST_F(TensorTest, Test_Tensor_Construct_With_Ptr_Should_Return_Success_When_Eve
     Tensor tensor(arr, tensorShape, DataType::INT8, TensorFormat::ND, CPU);
     EXPECT_EQ(tensor.Shape(), tensorShape);
     EXPECT_EQ(tensor.DType(), DataType::INT8);
-    EXPECT_STREQ(tensor.Device().get(), CPU);
+    EXPECT_STREQ(tensor.Device(), CPU);
     EXPECT_EQ(tensor.Format(), TensorFormat::ND);
     EXPECT_EQ(tensor.NumBytes(), tensorShape[0] * tensorShape[1]);
     EXPECT_EQ(tensor.Ptr(), arr);
@@ -110,17 +116,78 @@ TEST_F(TensorTest, Test_Tensor_Clone_Return_Success_When_Everything_Is_Ok)
     EXPECT_EQ(ret, 0);
     EXPECT_EQ(anotherTensor.Shape(), tensorShape);
     EXPECT_EQ(anotherTensor.DType(), DataType::INT8);
-    EXPECT_STREQ(anotherTensor.Device().get(), CPU);
+    EXPECT_STREQ(anotherTensor.Device(), CPU);
     EXPECT_EQ(anotherTensor.Format(), TensorFormat::ND);
     EXPECT_EQ(anotherTensor.NumBytes(), tensorShape[0] * tensorShape[1]);
 }
 
+TEST_F(TensorTest, Test_Tensor_Clone_Shares_Buffer_Until_MakeUnique)
+{
+    std::int8_t* data = new std::int8_t[TOTAL_BYTES]();
+    std::shared_ptr<std::int8_t> arr(data, std::default_delete<std::int8_t[]>());
+    Tensor tensor(arr, {SHAPE_H, SHAPE_W}, DataType::INT8, TensorFormat::ND, CPU);
+    Tensor anotherTensor;
+    ASSERT_EQ(tensor.Clone(anotherTensor), SUCCESS);
+    EXPECT_EQ(anotherTensor.Ptr(), tensor.Ptr());
+
+    ASSERT_EQ(anotherTensor.MakeUnique(), SUCCESS);
+    EXPECT_NE(anotherTensor.Ptr(), tensor.Ptr());
+    static_cast<std::int8_t*>(anotherTensor.Ptr())[0] = 1;
+    EXPECT_EQ(data[0], 0);
+    EXPECT_EQ(anotherTensor.Shape(), tensor.Shape());
+    EXPECT_EQ(anotherTensor.NumBytes(), tensor.NumBytes());
+
+    // both sides own their buffer now, nothing left to copy
+    arr.reset();
+    void* ptr = anotherTensor.Ptr();
+    ASSERT_EQ(anotherTensor.MakeUnique(), SUCCESS);
+    EXPECT_EQ(anotherTensor.Ptr(), ptr);
+    ASSERT_EQ(tensor.MakeUnique(), SUCCESS);
+    EXPECT_EQ(tensor.Ptr(), data);
+}
+
+TEST_F(TensorTest, Test_Tensor_Ops_Into_Clone_Keep_Source_Unchanged)
+{
+    size_t srcBytes = OP_SRC_SIZE * OP_SRC_SIZE * OP_CHANNEL;
+    size_t dstBytes = OP_DST_SIZE * OP_DST_SIZE * OP_CHANNEL;
+    std::shared_ptr<std::uint8_t> srcData(new std::uint8_t[srcBytes], std::default_delete<std::uint8_t[]>());
+    std::fill(srcData.get(), srcData.get() + srcBytes, OP_SRC_VALUE);
+    std::shared_ptr<std::uint8_t> dstData(new std::uint8_t[dstBytes](), std::default_delete<std::uint8_t[]>());
+    Tensor src(srcData, {1, OP_SRC_SIZE, OP_SRC_SIZE, OP_CHANNEL}, DataType::UINT8, TensorFormat::NHWC, CPU);
+    Tensor tensor(dstData, {1, OP_DST_SIZE, OP_DST_SIZE, OP_CHANNEL}, DataType::UINT8, TensorFormat::NHWC, CPU);
+
+    Tensor cropped;
+    ASSERT_EQ(tensor.Clone(cropped), SUCCESS);
+    ASSERT_EQ(TensorCrop(src, cropped, 0, 0, OP_DST_SIZE, OP_DST_SIZE, DeviceMode::CPU), SUCCESS);
+    Tensor resized;
+    ASSERT_EQ(tensor.Clone(resized), SUCCESS);
+    ASSERT_EQ(TensorResize(src, resized, OP_DST_SIZE, OP_DST_SIZE, Interpolation::BICUBIC, DeviceMode::CPU), SUCCESS);
+
+    EXPECT_EQ(tensor.Ptr(), dstData.get());
+    for (size_t i = 0; i < dstBytes; i++) {
+        ASSERT_EQ(dstData.get()[i], 0);
+        ASSERT_EQ(static_cast<std::uint8_t*>(cropped.Ptr())[i], OP_SRC_VALUE);
+        ASSERT_EQ(static_cast<std::uint8_t*>(resized.Ptr())[i], OP_SRC_VALUE);
+    }
+}
+
+TEST_F(TensorTest, Test_Tensor_Clone_Copies_User_Memory)
+{
+    std::int8_t data[TOTAL_BYTES] = {0};
+    Tensor tensor(data, {SHAPE_H, SHAPE_W}, DataType::INT8, TensorFormat::ND, CPU);
+    Tensor anotherTensor;
+    ASSERT_EQ(tensor.Clone(anotherTensor), SUCCESS);
+    EXPECT_NE(anotherTensor.Ptr(), tensor.Ptr());
+    data[0] = 1;
+    EXPECT_EQ(static_cast<std::int8_t*>(anotherTensor.Ptr())[0], 0);
+}
+
 TEST_F(TensorTest, Test_Tensor_GetProperties_Return_Success_When_Default_Construct)
 {
     Tensor tensor;
     EXPECT_EQ(tensor.Shape().size(), 0);
     EXPECT_EQ(tensor.DType(), DataType::FLOAT32);
-    EXPECT_STREQ(tensor.Device().get(), CPU);
+    EXPECT_STREQ(tensor.Device(), CPU);
     EXPECT_EQ(tensor.Format(), TensorFormat::ND);
     EXPECT_EQ(tensor.NumBytes(), 0);
     EXPECT_EQ(tensor.Ptr(), nullptr);
@@ -163,6 +230,10 @@ TEST_F(TensorTest, Test_GetByteSize_Success_With_Correct_DataType)
     EXPECT_EQ(bSize, ONE_BYTE);
     bSize = GetByteSize(DataType::FLOAT32);
     EXPECT_EQ(bSize, FOUR_BYTE);
+    bSize = GetByteSize(DataType::FLOAT16);
+    EXPECT_EQ(bSize, TWO_BYTE);
+    bSize = GetByteSize(DataType::BFLOAT16);
+    EXPECT_EQ(bSize, TWO_BYTE);
 }
 
 TEST_F(TensorTest, Test_Construct_Tensor_Failed_With_Device_IsNullptr)
@@ -178,6 +249,36 @@ TEST_F(TensorTest, Test_GetByteSize_Wrong_With_Correct_DataType)
     const int tmp = -1;
     EXPECT_THROW(GetByteSize(static_cast<DataType>(tmp)), std::runtime_error);
 }
+
+TEST_F(TensorTest, Test_Construct_Tensor_With_Max_Dims)
+{
+    std::int8_t* data = new std::int8_t[TOTAL_BYTES];
+    std::shared_ptr<std::int8_t> arr(data, std::default_delete<std::int8_t[]>());
+    std::vector<size_t> tensorShape(MAX_TENSOR_DIMS, 1);
+    tensorShape[0] = TOTAL_BYTES;
+    Tensor tensor(arr, tensorShape, DataType::INT8, TensorFormat::ND, CPU);
+    EXPECT_EQ(tensor.Shape(), tensorShape);
+    EXPECT_EQ(tensor.AuxInfo().logicalStrides.size(), MAX_TENSOR_DIMS);
+    EXPECT_EQ(tensor.AuxInfo().logicalStrides[0], 1);
+    EXPECT_EQ(tensor.NumBytes(), TOTAL_BYTES);
+
+    tensorShape.push_back(1);
+    EXPECT_THROW(Tensor(arr, tensorShape, DataType::INT8, TensorFormat::ND, CPU), std::runtime_error);
+}
+
+TEST_F(TensorTest, Test_Tensor_Copy_Keeps_Metadata)
+{
+    std::int8_t* data = new std::int8_t[TOTAL_BYTES];
+    std::shared_ptr<std::int8_t> arr(data, std::default_delete<std::int8_t[]>());
+    Tensor tensor(arr, {SHAPE_H, SHAPE_W}, DataType::INT8, TensorFormat::ND, CPU);
+    Tensor copied = tensor;
+    EXPECT_EQ(copied.Shape(), tensor.Shape());
+    EXPECT_EQ(copied.AuxInfo().memoryStrides, tensor.AuxInfo().memoryStrides);
+    EXPECT_EQ(copied.Ptr(), tensor.Ptr());
+    EXPECT_EQ(copied.Device(), tensor.Device());
+    std::vector<size_t> shape = copied.Shape();
+    EXPECT_EQ(shape, std::vector<size_t>({SHAPE_H, SHAPE_W}));
+}
 } // namespace
 
 int main(int argc, char* argv[])
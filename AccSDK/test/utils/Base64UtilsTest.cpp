@@ -0,0 +1,133 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: Base64 utils test file.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#include "acc/utils/Base64Utils.h"
+#include <random>
+#include <string>
+#include <gtest/gtest.h>
+#include "acc/ErrorCode.h"
+
+using namespace Acc;
+namespace {
+const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr size_t MAX_TEST_LENGTH = 300; // long enough to cover several SIMD blocks and every tail length
+
+std::string Encode(const std::vector<uint8_t>& data)
+{
+    std::string text;
+    size_t i = 0;
+    for (; i + 3 <= data.size(); i += 3) {
+        uint32_t triple = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+        text += ALPHABET[triple >> 18];
+        text += ALPHABET[(triple >> 12) & 0x3F];
+        text += ALPHABET[(triple >> 6) & 0x3F];
+        text += ALPHABET[triple & 0x3F];
+    }
+    if (i + 1 == data.size()) {
+        uint32_t triple = data[i] << 16;
+        text += ALPHABET[triple >> 18];
+        text += ALPHABET[(triple >> 12) & 0x3F];
+        text += "==";
+    } else if (i + 2 == data.size()) {
+        uint32_t triple = (data[i] << 16) | (data[i + 1] << 8);
+        text += ALPHABET[triple >> 18];
+        text += ALPHABET[(triple >> 12) & 0x3F];
+        text += ALPHABET[(triple >> 6) & 0x3F];
+        text += "=";
+    }
+    return text;
+}
+
+std::vector<uint8_t> RandomBytes(size_t length, std::mt19937& gen)
+{
+    std::vector<uint8_t> data(length);
+    for (auto& value : data) {
+        value = static_cast<uint8_t>(gen());
+    }
+    return data;
+}
+
+class Base64UtilsTest : public testing::Test {};
+
+TEST_F(Base64UtilsTest, Test_Base64Decode_Should_Return_Success_When_Round_Trip_Every_Length)
+{
+    std::mt19937 gen(0);
+    for (size_t length = 0; length < MAX_TEST_LENGTH; length++) {
+        std::vector<uint8_t> data = RandomBytes(length, gen);
+        std::string text = Encode(data);
+        std::vector<uint8_t> decoded;
+        ASSERT_EQ(Base64Decode(text.data(), text.size(), decoded), SUCCESS) << "length " << length;
+        ASSERT_EQ(decoded, data) << "length " << length;
+        while (!text.empty() && text.back() == '=') {
+            text.pop_back();
+        }
+        ASSERT_EQ(Base64Decode(text.data(), text.size(), decoded), SUCCESS) << "length " << length;
+        ASSERT_EQ(decoded, data) << "length " << length;
+    }
+}
+
+TEST_F(Base64UtilsTest, Test_Base64Decode_Should_Return_Success_When_Input_Is_Data_Url)
+{
+    std::string text = "data:image/jpeg;base64,SGVsbG8sIFdvcmxkIQ==";
+    std::vector<uint8_t> decoded;
+    ASSERT_EQ(Base64Decode(text.data(), text.size(), decoded), SUCCESS);
+    EXPECT_EQ(std::string(decoded.begin(), decoded.end()), "Hello, World!");
+}
+
+TEST_F(Base64UtilsTest, Test_Base64Decode_Should_Return_Fail_When_Data_Url_Is_Not_Base64)
+{
+    std::string text = "data:text/plain,SGVsbG8=";
+    std::vector<uint8_t> decoded;
+    EXPECT_EQ(Base64Decode(text.data(), text.size(), decoded), ERR_INVALID_PARAM);
+    text = "data:image/jpeg;base64";
+    EXPECT_EQ(Base64Decode(text.data(), text.size(), decoded), ERR_INVALID_PARAM);
+}
+
+TEST_F(Base64UtilsTest, Test_Base64Decode_Should_Return_Fail_When_Character_Is_Invalid)
+{
+    std::mt19937 gen(1);
+    std::string valid = Encode(RandomBytes(MAX_TEST_LENGTH, gen));
+    const std::string invalidChars = "-_ \n*=";
+    for (size_t pos = 0; pos + 1 < valid.size(); pos += 7) {
+        for (char c : invalidChars) {
+            std::string text = valid;
+            text[pos] = c;
+            std::vector<uint8_t> decoded;
+            EXPECT_EQ(Base64Decode(text.data(), text.size(), decoded), ERR_INVALID_PARAM) << "pos " << pos;
+        }
+    }
+}
+
+TEST_F(Base64UtilsTest, Test_Base64Decode_Should_Return_Fail_When_Length_Is_Invalid)
+{
+    std::vector<uint8_t> decoded;
+    EXPECT_EQ(Base64Decode("QUJDR", 5, decoded), ERR_INVALID_PARAM);
+    EXPECT_EQ(Base64Decode("Q===", 4, decoded), ERR_INVALID_PARAM);
+    EXPECT_EQ(Base64Decode(nullptr, 0, decoded), ERR_INVALID_POINTER);
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    return ret;
+}
@@ -0,0 +1,154 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: Buffer pool test file.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#include "acc/BufferPool.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <gtest/gtest.h>
+#include "acc/ErrorCode.h"
+#include "acc/utils/BufferPoolImpl.h"
+
+using namespace Acc;
+namespace {
+constexpr size_t POOLED_BYTES = 1024 * 1024;
+constexpr size_t SMALL_BYTES = 1000;
+constexpr size_t HUGE_BYTES = 4 * 1024 * 1024;
+constexpr size_t DEFAULT_CAPACITY = 512 * 1024 * 1024;
+constexpr uintptr_t ALIGNMENT = 64;
+
+class CountingAllocator : public BufferAllocator {
+public:
+    void* Allocate(size_t bytes) override
+    {
+        allocated++;
+        return ::operator new(bytes, std::align_val_t(ALIGNMENT), std::nothrow);
+    }
+
+    void Deallocate(void* ptr, size_t) override
+    {
+        deallocated++;
+        ::operator delete(ptr, std::align_val_t(ALIGNMENT));
+    }
+
+    std::atomic<size_t> allocated{0};
+    std::atomic<size_t> deallocated{0};
+};
+
+class BufferPoolTest : public testing::Test {
+protected:
+    void TearDown() override
+    {
+        SetBufferAllocator(BufferAllocatorType::DEFAULT);
+        SetBufferPoolCapacity(DEFAULT_CAPACITY);
+    }
+};
+
+TEST_F(BufferPoolTest, Test_AllocateBuffer_Should_Reuse_Released_Buffer)
+{
+    TrimBufferPool();
+    std::shared_ptr<void> buffer;
+    ASSERT_EQ(AllocateBuffer(POOLED_BYTES, buffer), SUCCESS);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.get()) % ALIGNMENT, 0U);
+    void* first = buffer.get();
+    buffer.reset();
+    BufferPoolStats before = GetBufferPoolStats();
+    EXPECT_GE(before.cachedBytes, POOLED_BYTES);
+
+    // a slightly smaller request falls into the same size class
+    ASSERT_EQ(AllocateBuffer(POOLED_BYTES - 100, buffer), SUCCESS);
+    EXPECT_EQ(buffer.get(), first);
+    BufferPoolStats after = GetBufferPoolStats();
+    EXPECT_EQ(after.requests, before.requests + 1);
+    EXPECT_EQ(after.hits, before.hits + 1);
+    EXPECT_EQ(after.inUseBytes, before.inUseBytes + POOLED_BYTES);
+}
+
+TEST_F(BufferPoolTest, Test_AllocateBuffer_Should_Return_Fail_When_Size_Is_Zero)
+{
+    std::shared_ptr<void> buffer;
+    EXPECT_EQ(AllocateBuffer(0, buffer), ERR_INVALID_PARAM);
+    EXPECT_EQ(buffer, nullptr);
+}
+
+TEST_F(BufferPoolTest, Test_Small_And_Uncached_Buffers_Should_Go_Back_To_Allocator)
+{
+    auto allocator = std::make_shared<CountingAllocator>();
+    ASSERT_EQ(SetBufferAllocator(allocator), SUCCESS);
+    std::shared_ptr<void> buffer;
+    ASSERT_EQ(AllocateBuffer(SMALL_BYTES, buffer), SUCCESS);
+    buffer.reset();
+    EXPECT_EQ(allocator->deallocated, 1U);
+
+    SetBufferPoolCapacity(0);
+    ASSERT_EQ(AllocateBuffer(POOLED_BYTES, buffer), SUCCESS);
+    buffer.reset();
+    EXPECT_EQ(allocator->allocated, 2U);
+    EXPECT_EQ(allocator->deallocated, 2U);
+    EXPECT_EQ(GetBufferPoolStats().cachedBytes, 0U);
+}
+
+TEST_F(BufferPoolTest, Test_SetBufferAllocator_Should_Return_Buffers_To_Their_Allocator)
+{
+    auto first = std::make_shared<CountingAllocator>();
+    ASSERT_EQ(SetBufferAllocator(first), SUCCESS);
+    std::shared_ptr<void> cached;
+    std::shared_ptr<void> inUse;
+    ASSERT_EQ(AllocateBuffer(POOLED_BYTES, cached), SUCCESS);
+    ASSERT_EQ(AllocateBuffer(POOLED_BYTES, inUse), SUCCESS);
+    cached.reset();
+    EXPECT_EQ(first->deallocated, 0U);
+
+    auto second = std::make_shared<CountingAllocator>();
+    ASSERT_EQ(SetBufferAllocator(second), SUCCESS);
+    EXPECT_EQ(first->deallocated, 1U);
+    inUse.reset();
+    EXPECT_EQ(first->deallocated, 2U);
+    EXPECT_EQ(second->deallocated, 0U);
+
+    ASSERT_EQ(AllocateBuffer(POOLED_BYTES, inUse), SUCCESS);
+    EXPECT_EQ(second->allocated, 1U);
+    inUse.reset();
+    TrimBufferPool();
+    EXPECT_EQ(second->deallocated, 1U);
+    EXPECT_EQ(SetBufferAllocator(std::shared_ptr<BufferAllocator>()), ERR_INVALID_POINTER);
+}
+
+TEST_F(BufferPoolTest, Test_HugePage_Allocator_Should_Success)
+{
+    ASSERT_EQ(SetBufferAllocator(BufferAllocatorType::HUGE_PAGE), SUCCESS);
+    std::shared_ptr<void> small;
+    std::shared_ptr<void> huge;
+    ASSERT_EQ(AllocateBuffer(SMALL_BYTES, small), SUCCESS);
+    ASSERT_EQ(AllocateBuffer(HUGE_BYTES, huge), SUCCESS);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(huge.get()) % (2 * 1024 * 1024), 0U);
+    static_cast<uint8_t*>(huge.get())[HUGE_BYTES - 1] = 1;
+    EXPECT_EQ(SetBufferAllocator(static_cast<BufferAllocatorType>(-1)), ERR_INVALID_PARAM);
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    return ret;
+}
@@ -0,0 +1,151 @@
+/*
+* -------------------------------------------------------------------------
+*  This file is part of the MultimodalSDK project.
+* Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+*
+* MultimodalSDK is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+*           http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+ * Description: File prefetcher test file.
+ * Author: ACC SDK
+ * Create: 2025
+ * History: NA
+ */
+#include "acc/utils/FilePrefetcher.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <gtest/gtest.h>
+#include "acc/ErrorCode.h"
+
+using namespace Acc;
+namespace {
+constexpr size_t FILE_NUM = 16;
+constexpr size_t FILE_BYTES = 4096;
+constexpr size_t IO_THREADS = 4;
+constexpr auto SETTLE_TIME = std::chrono::milliseconds(50);
+
+class FilePrefetcherTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        for (size_t i = 0; i < FILE_NUM; i++) {
+            std::string path = "prefetch_" + std::to_string(i) + ".bin";
+            std::ofstream out(path, std::ios::binary);
+            out << std::string(FILE_BYTES, static_cast<char>('a' + i));
+            paths_.push_back(path);
+        }
+    }
+
+    void TearDown() override
+    {
+        for (const auto& path : paths_) {
+            std::remove(path.c_str());
+        }
+    }
+
+    std::vector<std::string> paths_;
+};
+
+ErrorCode OpenPopulated(const char* path, MappedFile& file)
+{
+    return file.Open(path, DEFAULT_MAX_FILE_SIZE, true);
+}
+
+TEST_F(FilePrefetcherTest, Take_ShouldReturnEveryFile_WhenTakenInOrder)
+{
+    FilePrefetcher prefetcher(paths_, OpenPopulated, DEFAULT_PREFETCH_BYTES, IO_THREADS);
+    for (size_t i = 0; i < FILE_NUM; i++) {
+        MappedFile file;
+        ASSERT_EQ(prefetcher.Take(i, file), SUCCESS);
+        ASSERT_EQ(file.Size(), FILE_BYTES);
+        EXPECT_EQ(file.Data()[0], static_cast<uint8_t>('a' + i));
+    }
+    MappedFile file;
+    EXPECT_EQ(prefetcher.Take(0, file), ERR_INVALID_PARAM);
+    EXPECT_EQ(prefetcher.Take(FILE_NUM, file), ERR_OUT_OF_RANGE);
+}
+
+TEST_F(FilePrefetcherTest, Take_ShouldReportLoaderError_WhenFileIsMissing)
+{
+    paths_.insert(paths_.begin() + 1, "prefetch_missing.bin");
+    FilePrefetcher prefetcher(paths_, OpenPopulated, DEFAULT_PREFETCH_BYTES, IO_THREADS);
+    MappedFile file;
+    EXPECT_EQ(prefetcher.Take(0, file), SUCCESS);
+    EXPECT_EQ(prefetcher.Take(1, file), ERR_OPEN_FILE_FAILURE);
+    EXPECT_EQ(prefetcher.Take(2, file), SUCCESS);
+    paths_.erase(paths_.begin() + 1);
+}
+
+TEST_F(FilePrefetcherTest, Prefetch_ShouldStayWithinBudget_WhenFilesAreNotTaken)
+{
+    std::atomic<size_t> loaded(0);
+    auto loader = [&loaded](const char* path, MappedFile& file) {
+        loaded++;
+        return OpenPopulated(path, file);
+    };
+    // room for two files, the I/O threads must wait for Take before loading a third
+    FilePrefetcher prefetcher(paths_, loader, 2 * FILE_BYTES, IO_THREADS);
+    std::this_thread::sleep_for(SETTLE_TIME);
+    EXPECT_LE(loaded.load(), 2);
+    for (size_t i = 0; i < FILE_NUM; i++) {
+        MappedFile file;
+        ASSERT_EQ(prefetcher.Take(i, file), SUCCESS);
+        EXPECT_LE(loaded.load(), i + 3);
+    }
+    EXPECT_EQ(loaded.load(), FILE_NUM);
+}
+
+TEST_F(FilePrefetcherTest, Destructor_ShouldNotHang_WhenFilesAreNotTaken)
+{
+    FilePrefetcher prefetcher(paths_, OpenPopulated, FILE_BYTES, IO_THREADS);
+    MappedFile file;
+    EXPECT_EQ(prefetcher.Take(0, file), SUCCESS);
+}
+
+TEST_F(FilePrefetcherTest, Take_ShouldLoadOnCaller_WhenNoIoTaskPickedUpFile)
+{
+    FilePrefetcher prefetcher(paths_, OpenPopulated, DEFAULT_PREFETCH_BYTES, 0);
+    for (size_t i = FILE_NUM; i > 0; i--) {
+        MappedFile file;
+        ASSERT_EQ(prefetcher.Take(i - 1, file), SUCCESS);
+        EXPECT_EQ(file.Data()[0], static_cast<uint8_t>('a' + i - 1));
+    }
+}
+
+TEST_F(FilePrefetcherTest, Take_ShouldReturnEveryFile_WhenBatchesShareIoPool)
+{
+    // more I/O tasks in flight than the pool has threads, no batch may wait on another
+    std::vector<std::unique_ptr<FilePrefetcher>> batches;
+    for (size_t b = 0; b < IO_THREADS; b++) {
+        batches.push_back(
+            std::make_unique<FilePrefetcher>(paths_, OpenPopulated, FILE_BYTES, DEFAULT_PREFETCH_THREADS));
+    }
+    for (size_t b = IO_THREADS; b > 0; b--) {
+        for (size_t i = 0; i < FILE_NUM; i++) {
+            MappedFile file;
+            ASSERT_EQ(batches[b - 1]->Take(i, file), SUCCESS);
+            EXPECT_EQ(file.Data()[0], static_cast<uint8_t>('a' + i));
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    return ret;
+}
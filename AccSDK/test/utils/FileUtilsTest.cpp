@@ -22,6 +22,8 @@
 
 #include <pwd.h>
 #include <fstream>
+#include <cstring>
+#include <thread>
 #include <unistd.h>
 #include <fcntl.h>
 #include <dlfcn.h>
@@ -180,6 +182,67 @@ TEST_F(FileUtilsTest, ReadFile_ShouldReturnErr_WhenFileIsTooLarge)
     std::remove(testFilePath);
 }
 
+TEST_F(FileUtilsTest, MappedFile_ShouldMatchReadFile_WhenFileIsValid)
+{
+    MappedFile file;
+    ASSERT_EQ(file.Open("valid_file.bin"), SUCCESS);
+    ASSERT_EQ(file.Size(), EXPECT_FILE_CONTENT.size());
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(file.Data()), file.Size()), EXPECT_FILE_CONTENT);
+
+    // moving hands the mapping over, the source is left empty
+    MappedFile moved(std::move(file));
+    EXPECT_EQ(file.Data(), nullptr);
+    EXPECT_EQ(file.Size(), 0);
+    EXPECT_EQ(moved.Size(), EXPECT_FILE_CONTENT.size());
+}
+
+TEST_F(FileUtilsTest, MappedFile_ShouldMatchReadFile_WhenFileIsMapped)
+{
+    const char* largeFile = "large_file.bin";
+    std::vector<char> content(MMAP_MIN_FILE_SIZE + 1);
+    for (size_t i = 0; i < content.size(); i++) {
+        content[i] = static_cast<char>(i);
+    }
+    {
+        std::ofstream ofs(largeFile, std::ios::binary);
+        ofs.write(content.data(), content.size());
+    }
+    MappedFile file;
+    ASSERT_EQ(file.Open(largeFile, DEFAULT_MAX_FILE_SIZE, true), SUCCESS);
+    ASSERT_EQ(file.Size(), content.size());
+    EXPECT_EQ(std::memcmp(file.Data(), content.data(), content.size()), 0);
+    std::remove(largeFile);
+}
+
+TEST_F(FileUtilsTest, MappedFile_ShouldReadToEnd_WhenFileIsPipe)
+{
+    const char* fifo = "pipe_file";
+    std::remove(fifo);
+    ASSERT_EQ(mkfifo(fifo, 0600), 0);
+    // more than one read chunk, the size of a pipe is only known at its end
+    std::string content(256 * 1024, 'p');
+    std::thread writer([fifo, &content]() {
+        std::ofstream ofs(fifo, std::ios::binary);
+        ofs << content;
+    });
+    MappedFile file;
+    ErrorCode ret = file.Open(fifo);
+    writer.join();
+    std::remove(fifo);
+    ASSERT_EQ(ret, SUCCESS);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(file.Data()), file.Size()), content);
+}
+
+TEST_F(FileUtilsTest, MappedFile_ShouldReturnErr_WhenFileIsInvalid)
+{
+    MappedFile file;
+    EXPECT_EQ(file.Open(nullptr), ERR_OPEN_FILE_FAILURE);
+    EXPECT_EQ(file.Open("invalid_path.bin"), ERR_OPEN_FILE_FAILURE);
+    EXPECT_EQ(file.Open("empty_file.bin"), ERR_INVALID_FILE_SIZE);
+    EXPECT_EQ(file.Open("valid_file.bin", EXPECT_FILE_CONTENT.size() - 1), ERR_INVALID_FILE_SIZE);
+    EXPECT_EQ(file.Data(), nullptr);
+}
+
 TEST_F(FileUtilsTest, CheckFilePath_ShouldReturnFalse_WhenPathIsEmpty)
 {
     std::string emptyPath = "";
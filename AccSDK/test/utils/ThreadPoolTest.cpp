@@ -59,6 +59,34 @@ TEST_F(ThreadPoolTest, Test_Thread_Pool_With_Two_Func)
     ThreadPool::GetInstance().WaitAll(futures);
 }
 
+TEST_F(ThreadPoolTest, Test_Thread_Pool_Should_Mark_Worker_Threads)
+{
+    EXPECT_FALSE(ThreadPool::InWorkerThread());
+    auto future = ThreadPool::GetInstance().Submit([]() { return ThreadPool::InWorkerThread(); });
+    EXPECT_TRUE(future.get());
+}
+
+TEST_F(ThreadPoolTest, Test_Thread_Pool_Parallel_For_Should_Visit_Every_Index_Once)
+{
+    constexpr size_t count = 100;
+    constexpr size_t maxTaskNum = 8;
+    std::vector<int> visits(count, 0);
+    ASSERT_EQ(ThreadPool::GetInstance().ParallelFor(count, maxTaskNum, [&visits](size_t i) { visits[i]++; }),
+              SUCCESS);
+    EXPECT_EQ(visits, std::vector<int>(count, 1));
+
+    // nested inside a pool task the body runs inline on the worker
+    auto future = ThreadPool::GetInstance().Submit([&visits]() {
+        return ThreadPool::GetInstance().ParallelFor(count, maxTaskNum, [&visits](size_t i) { visits[i]++; });
+    });
+    EXPECT_EQ(future.get(), SUCCESS);
+    EXPECT_EQ(visits, std::vector<int>(count, TWO));
+
+    EXPECT_EQ(ThreadPool::GetInstance().ParallelFor(count, maxTaskNum,
+                                                    [](size_t) { throw std::runtime_error("body failed"); }),
+              ERR_INVALID_THREAD_POOL_STATUST);
+}
+
 TEST_F(ThreadPoolTest, Test_Thread_Pool_Submit_After_Shutdown_Should_Return_Failed)
 {
     std::vector<std::future<void>> futures;
@@ -229,6 +229,24 @@ TEST_F(VideoTest, VideoDecodeOnCpu_ShouldReturnFailed_WhenVideoSizeOutOfRange)
 }
 
 
+TEST_F(VideoTest, ProbeVideos_ShouldReturnMetadataPerPath_WithoutDecoding)
+{
+    chmod(validVideoPath_.c_str(), 0440);
+    std::vector<std::string> paths = {validVideoPath_, "invalid_path.mp4", VIDEO_PATH_WITHOUT_VIDEO_STREAM};
+    std::vector<VideoProbeInfo> infos;
+    ErrorCode ret = ProbeVideos(paths, infos);
+    EXPECT_NE(ret, SUCCESS);
+    ASSERT_EQ(infos.size(), paths.size());
+    EXPECT_EQ(infos[0].status, SUCCESS);
+    EXPECT_EQ(infos[0].width, EXPECTED_WIDTH);
+    EXPECT_EQ(infos[0].height, EXPECTED_HEIGHT);
+    EXPECT_NEAR(infos[0].fps, 30.0, 0.1);
+    EXPECT_NEAR(infos[0].duration, 60.0, 1.0);
+    EXPECT_GT(infos[0].totalFrames, 0);
+    EXPECT_EQ(infos[1].status, ERR_INVALID_PARAM);
+    EXPECT_EQ(infos[2].status, ERR_FFMPEG_COMMON_FAILURE);
+}
+
 TEST_F(VideoTest, VideoDecodeOnCpu_ShouldReturnFailed_WhenPathIsNullptr)
 {
     std::vector<Image> frames;
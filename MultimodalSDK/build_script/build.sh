@@ -93,7 +93,7 @@ else
   exit 1
 fi
 
-for _lib_component in FFmpeg libjpeg-turbo soxr; do
+for _lib_component in FFmpeg libjpeg-turbo soxr libpng libwebp; do
   _src_lib="${B_REPO_DIR}/output/opensource/${_lib_component}/lib"
   if [ -d "${_src_lib}" ]; then
     mkdir -p "${IMPL_OPENSOURCE_DIR}/${_lib_component}"
@@ -119,6 +119,8 @@ mkdir -p "${OUTPUT_DIR}/script"
 mkdir -p "${OUTPUT_DIR}/opensource/FFmpeg"
 mkdir -p "${OUTPUT_DIR}/opensource/libjpeg-turbo"
 mkdir -p "${OUTPUT_DIR}/opensource/soxr"
+mkdir -p "${OUTPUT_DIR}/opensource/libpng"
+mkdir -p "${OUTPUT_DIR}/opensource/libwebp"
 
 if compgen -G "${A_ROOT_DIR}/dist/*.whl" > /dev/null; then
   cp -v "${A_ROOT_DIR}/dist/"*.whl "${OUTPUT_DIR}/"
@@ -142,6 +144,13 @@ rm -rf "${OUTPUT_DIR}/opensource/libjpeg-turbo/lib/pkgconfig"
 cp -rf "${B_REPO_DIR}/output/opensource/soxr/lib" "${OUTPUT_DIR}/opensource/soxr"
 rm -rf "${OUTPUT_DIR}/opensource/soxr/lib/pkgconfig"
 
+cp -rf "${B_REPO_DIR}/output/opensource/libpng/lib" "${OUTPUT_DIR}/opensource/libpng"
+rm -rf "${OUTPUT_DIR}/opensource/libpng/lib/pkgconfig"
+
+cp -rf "${B_REPO_DIR}/output/opensource/libwebp/lib" "${OUTPUT_DIR}/opensource/libwebp"
+rm -rf "${OUTPUT_DIR}/opensource/libwebp/lib/cmake"
+rm -rf "${OUTPUT_DIR}/opensource/libwebp/lib/pkgconfig"
+
 cp "${A_ROOT_DIR}/script/set_env.sh" "${OUTPUT_DIR}/script/"
 cp "${A_ROOT_DIR}/script/uninstall.sh" "${OUTPUT_DIR}/script/"
 VERSION_MAJOR=$(echo "$VERSION" | sed -E 's/\.b[0-9]+$//')
@@ -173,6 +182,8 @@ if [[ "${BUILD_ARGS[*]}" == *"test"* ]]; then
     export LD_LIBRARY_PATH="${A_ROOT_DIR}/output/lib:${OUTPUT_DIR}/opensource/libjpeg-turbo/lib:$LD_LIBRARY_PATH"
     export LD_LIBRARY_PATH="${OUTPUT_DIR}/opensource/FFmpeg/lib:$LD_LIBRARY_PATH"
     export LD_LIBRARY_PATH="${OUTPUT_DIR}/opensource/soxr/lib:$LD_LIBRARY_PATH"
+    export LD_LIBRARY_PATH="${OUTPUT_DIR}/opensource/libpng/lib:$LD_LIBRARY_PATH"
+    export LD_LIBRARY_PATH="${OUTPUT_DIR}/opensource/libwebp/lib:$LD_LIBRARY_PATH"
     # clean coverage first
     coverage erase
     LD_PRELOAD=/opt/buildtools/python-3.11.4/lib/python3.11/site-packages/torch.libs/libgomp-98df74fd.so.1.0.0 \
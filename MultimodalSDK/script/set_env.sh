@@ -25,3 +25,5 @@ export LD_LIBRARY_PATH="${MULTIMODAL_SDK_HOME}/lib:${LD_LIBRARY_PATH:-}"
 export LD_LIBRARY_PATH="${MULTIMODAL_SDK_HOME}/opensource/FFmpeg/lib:${LD_LIBRARY_PATH:-}"
 export LD_LIBRARY_PATH="${MULTIMODAL_SDK_HOME}/opensource/libjpeg-turbo/lib:${LD_LIBRARY_PATH:-}"
 export LD_LIBRARY_PATH="${MULTIMODAL_SDK_HOME}/opensource/soxr/lib:${LD_LIBRARY_PATH:-}"
+export LD_LIBRARY_PATH="${MULTIMODAL_SDK_HOME}/opensource/libpng/lib:${LD_LIBRARY_PATH:-}"
+export LD_LIBRARY_PATH="${MULTIMODAL_SDK_HOME}/opensource/libwebp/lib:${LD_LIBRARY_PATH:-}"
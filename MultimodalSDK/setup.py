@@ -29,6 +29,8 @@ setup(
             'opensource/FFmpeg/lib/*.so*',
             'opensource/libjpeg-turbo/lib/*.so*',
             'opensource/soxr/lib/*.so*',
+            'opensource/libpng/lib/*.so*',
+            'opensource/libwebp/lib/*.so*',
         ],
     },
     include_package_data=True,
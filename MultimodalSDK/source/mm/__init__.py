@@ -26,6 +26,12 @@ from .acc import (
     video_decode,
     normalize,
     load_audio,
+    probe_images,
+    probe_videos,
+    estimate_qwen2_vl_tokens,
+    estimate_internvl2_tokens,
+    decode_images,
+    encode_jpegs,
 )
 from .comm import LogLevel, register_log_conf
 from .adapter import MultimodalQwen2VLImageProcessor, InternVL2PreProcessor
@@ -46,6 +52,12 @@ __all__ = [
     'MultimodalQwen2VLImageProcessor',
     'InternVL2PreProcessor',
     'load_audio',
+    'probe_images',
+    'probe_videos',
+    'estimate_qwen2_vl_tokens',
+    'estimate_internvl2_tokens',
+    'decode_images',
+    'encode_jpegs',
     'BaseFrameSelector',
     'KFrameSelector',
     'KRangFrameSelector',
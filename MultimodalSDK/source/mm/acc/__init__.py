@@ -16,8 +16,10 @@
 # See the Mulan PSL v2 for more details.
 # -------------------------------------------------------------------------
 from .wrapper import (Tensor, TensorFormat, DataType, ImageFormat, Image, DeviceMode, Interpolation, video_decode,
-                      normalize, load_audio)
+                      normalize, load_audio, probe_images, probe_videos, estimate_qwen2_vl_tokens,
+                      estimate_internvl2_tokens, decode_images, encode_jpegs)
 
 
 __all__ = ['Tensor', 'DataType', 'TensorFormat', 'ImageFormat', 'Image', 'DeviceMode', 'Interpolation', 'video_decode',
-           'normalize', 'load_audio']
+           'normalize', 'load_audio', 'probe_images', 'probe_videos', 'estimate_qwen2_vl_tokens',
+           'estimate_internvl2_tokens', 'decode_images', 'encode_jpegs']
@@ -22,6 +22,8 @@ from pathlib import Path
 def _preload_shared_libraries(base):
     opensource_lib_dirs = [
         base / "opensource" / "soxr" / "lib",
+        base / "opensource" / "libpng" / "lib",
+        base / "opensource" / "libwebp" / "lib",
         base / "opensource" / "libjpeg-turbo" / "lib",
         base / "opensource" / "FFmpeg" / "lib",
     ]
@@ -16,9 +16,11 @@
 # See the Mulan PSL v2 for more details.
 # -------------------------------------------------------------------------
 from .tensor_wrapper import Tensor, TensorFormat, DataType, normalize
-from .image_wrapper import Image, ImageFormat, DeviceMode, Interpolation
+from .image_wrapper import Image, ImageFormat, DeviceMode, Interpolation, decode_images, encode_jpegs
 from .video_wrapper import video_decode
 from .audio_wrapper import load_audio
+from .probe_wrapper import probe_images, probe_videos, estimate_qwen2_vl_tokens, estimate_internvl2_tokens
 
 __all__ = ['Tensor', 'DataType', 'TensorFormat', 'ImageFormat', 'Image', 'DeviceMode', 'Interpolation', 'video_decode',
-           'normalize', 'load_audio']
+           'normalize', 'load_audio', 'probe_images', 'probe_videos', 'estimate_qwen2_vl_tokens',
+           'estimate_internvl2_tokens', 'decode_images', 'encode_jpegs']
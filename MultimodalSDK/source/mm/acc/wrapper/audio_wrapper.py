@@ -77,29 +77,47 @@ def _normalize_audio_inputs(audio_inputs: Union[str, List[str]]) -> Tuple[List[P
     return paths, is_single_file
 
 
-def load_audio(audio_inputs: Union[str, List[str]], sr: Optional[int] = None) \
+_AUDIO_BUFFER_TYPES = (bytes, bytearray, memoryview)
+
+
+def load_audio(audio_inputs: Union[str, List[str], bytes, bytearray, memoryview], sr: Optional[int] = None) \
         -> Union[Tuple[Tensor, int], List[Tuple[Tensor, int]]]:
     """
     Unified audio loading interface.
 
     - Single file -> calls load_audio -> returns (Tensor, sr)
+    - WAV content as bytes, bytearray or memoryview -> decoded in memory -> returns (Tensor, sr)
     - List of files or directory -> calls load_audio_batch -> returns list of (Tensor, sr)
 
     Args:
-        audio_inputs: str | bytes | Path | iterable of these
+        audio_inputs: str path, list of str paths, directory, or the WAV file content itself
         sr: Optional sample rate
 
     Returns:
         Either:
-            (Tensor, int) if single file
+            (Tensor, int) if single file or WAV content
             List[(Tensor, int)] if batch
     """
-    wav_files, is_single_file = _normalize_audio_inputs(audio_inputs)
-
     if sr is not None:
         if not isinstance(sr, int) or sr <= 0:
             raise ValueError(f"sr must be positive int, got {sr}")
 
+    if isinstance(audio_inputs, _AUDIO_BUFFER_TYPES):
+        dst_acc_tensor = _acc.Tensor()
+        try:
+            if sr is None:
+                sample_rate = _acc.load_audio_from_bytes(audio_inputs, dst_acc_tensor)
+            else:
+                sample_rate = _acc.load_audio_from_bytes(audio_inputs, dst_acc_tensor, sr)
+        except Exception as e:
+            raise RuntimeError(f"load_audio failed: {e}") from e
+
+        tensor_obj = object.__new__(Tensor)
+        tensor_obj._inner = dst_acc_tensor
+        return tensor_obj, sample_rate
+
+    wav_files, is_single_file = _normalize_audio_inputs(audio_inputs)
+
     if is_single_file:
         audio_path = wav_files[0]
         path_bytes = _ensure_bytes(str(audio_path), "audio_path")
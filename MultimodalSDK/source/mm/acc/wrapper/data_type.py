@@ -22,6 +22,8 @@ class DataType(Enum):
     INT8 = 2
     UINT8 = 4
     FLOAT32 = 0
+    FLOAT16 = 1
+    BFLOAT16 = 27
 
 
 class TensorFormat(Enum):
@@ -31,10 +33,12 @@ class TensorFormat(Enum):
 
 
 class ImageFormat(Enum):
+    NV12 = 1
     RGB = 12
     BGR = 13
     RGB_PLANAR = 69
     BGR_PLANAR = 70
+    YUV420P = 1000
 
 
 class Interpolation(Enum):
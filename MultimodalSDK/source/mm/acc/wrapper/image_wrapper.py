@@ -15,7 +15,7 @@
 # MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
 # See the Mulan PSL v2 for more details.
 # -------------------------------------------------------------------------
-from typing import Tuple
+from typing import List, Optional, Tuple
 from .._impl import acc as _acc
 from .data_type import DataType, ImageFormat, DeviceMode, Interpolation, TensorFormat
 from .tensor_wrapper import Tensor
@@ -23,6 +23,7 @@ from .util import ObjectWrapper, _ensure_bytes
 
 _SUPPORT_PILLOW_MODE = "RGB"
 _RESIZED_SIZE_LEN = 2
+_DEFAULT_JPEG_QUALITY = 95
 
 
 class Image:
@@ -34,6 +35,7 @@ class Image:
     @classmethod
     def open(cls, path: str | bytes, device: str | bytes = b"cpu") -> "Image":
         """Construct Image from a given path and device. Device check will be performed in C++ code
+        jpg, jpeg, png and webp files are decoded natively to RGB, the decoder is picked from the file content.
 
 
         Args:
@@ -50,6 +52,103 @@ class Image:
         obj._inner = acc_img
         return obj
 
+    @classmethod
+    def open_resized(
+            cls,
+            path: str | bytes,
+            size: Tuple[int, int],
+            interpolation: Interpolation = Interpolation.BICUBIC,
+            device: str | bytes = b"cpu"
+    ) -> "Image":
+        """Decode a jpeg, png or webp file and resize it to the given size in one step.
+        A jpeg file is decoded at the smallest 1/2, 1/4 or 1/8 scale that still covers the size, which is much
+        cheaper than Image.open(path).resize(size, interpolation) for large photos.
+
+        Args:
+            path (str | bytes): given path
+            size (Tuple[int, int]): Resized size, which is (width, height)
+            interpolation (Interpolation): Interpolation algorithm for the remaining resize. Default is BICUBIC.
+            device (str | bytes): only support cpu now
+
+        Returns:
+            Image: dst image
+        """
+        if len(size) != _RESIZED_SIZE_LEN:
+            raise ValueError("size must be a tuple of (width, height)")
+        path_bytes = _ensure_bytes(path, "path")
+        device_bytes = _ensure_bytes(device, "device")
+        acc_img = _acc.Image.open_resized(path_bytes, size[0], size[1], interpolation.value, device_bytes)
+        obj = object.__new__(cls)
+        obj._inner = acc_img
+        return obj
+
+    @classmethod
+    def open_cropped(
+            cls,
+            path: str | bytes,
+            top: int,
+            left: int,
+            height: int,
+            width: int,
+            device: str | bytes = b"cpu"
+    ) -> "Image":
+        """Decode only a crop rectangle of a jpeg file, same result as Image.open(path).crop(top, left, height, width)
+        without decoding the pixels outside of the rectangle.
+
+        Args:
+            path (str | bytes): given path
+            top (int): Top boundary position of the crop.
+            left (int): Left boundary position of the crop.
+            height (int): Crop height.
+            width (int): Crop width.
+            device (str | bytes): only support cpu now
+
+        Returns:
+            Image: dst image
+        """
+        path_bytes = _ensure_bytes(path, "path")
+        device_bytes = _ensure_bytes(device, "device")
+        acc_img = _acc.Image.open_cropped(path_bytes, top, left, height, width, device_bytes)
+        obj = object.__new__(cls)
+        obj._inner = acc_img
+        return obj
+
+    @classmethod
+    def from_bytes(cls, data, device: str | bytes = b"cpu") -> "Image":
+        """Decode jpeg, png or webp content held in memory, e.g. an HTTP body, without writing a temporary file.
+        The buffer is read in place, it is not copied before decoding.
+
+        Args:
+            data (bytes | bytearray | memoryview): image file content, any object supporting the buffer protocol
+            device (str | bytes): only support cpu now
+
+        Returns:
+            Image: dst image
+        """
+        device_bytes = _ensure_bytes(device, "device")
+        acc_img = _acc.Image.from_bytes(data, device_bytes)
+        obj = object.__new__(cls)
+        obj._inner = acc_img
+        return obj
+
+    @classmethod
+    def from_base64(cls, text, device: str | bytes = b"cpu") -> "Image":
+        """Decode a base64 encoded jpeg, png or webp image, e.g. a field of a json request, in one native call.
+        The base64 text is decoded straight into the image decoder input, no intermediate python bytes are created.
+
+        Args:
+            text (str | bytes): base64 text, a data url prefix like "data:image/jpeg;base64," is accepted
+            device (str | bytes): only support cpu now
+
+        Returns:
+            Image: dst image
+        """
+        device_bytes = _ensure_bytes(device, "device")
+        acc_img = _acc.Image.from_base64(text, device_bytes)
+        obj = object.__new__(cls)
+        obj._inner = acc_img
+        return obj
+
     @classmethod
     def from_numpy(
             cls,
@@ -62,8 +161,9 @@ class Image:
 
 
         Args:
-            nd_array (np.ndarray): Input numpy array containing image data.
-            image_format (ImageFormat): Format of the image (e.g., RGB, BGR).
+            nd_array (np.ndarray): Input numpy array containing image data. [H, W, 3] for RGB/BGR, [3, H, W] for
+                                   RGB_PLANAR/BGR_PLANAR and [H * 3 / 2, W] for NV12/YUV420P.
+            image_format (ImageFormat): Format of the image (e.g., RGB, BGR, NV12).
             device (str | bytes, optional): only support cpu now
 
         Returns:
@@ -223,7 +323,7 @@ class Image:
         """Get format property
 
         Returns:
-            ImageFormat: range is RGB, BGR, RGB_PLANAR, BGR_PLANAR
+            ImageFormat: range is RGB, BGR, RGB_PLANAR, BGR_PLANAR, NV12, YUV420P
         """
         val = self._inner.format
         return ImageFormat(val)
@@ -286,7 +386,7 @@ class Image:
         return np.asarray(ObjectWrapper(interface_dict))
 
     def clone(self) -> "Image":
-        """Image deep copy to a new image
+        """Image copy to a new image, the pixels are shared until either side is exported to numpy
 
         Returns:
             Image: dst image
@@ -365,6 +465,47 @@ class Image:
         obj._inner = acc_img
         return obj
 
+    def yuv_to_rgb_resize(
+        self,
+        size: Tuple[int, int],
+        interpolation: Interpolation = Interpolation.BICUBIC,
+        device_mode: DeviceMode = DeviceMode.CPU,
+    ) -> "Image":
+        """Convert a NV12 or YUV420P image to RGB and resize it in one step
+
+        Chroma is upsampled straight to the target size, so the full resolution RGB image is never produced.
+        BT.601 limited range is assumed.
+
+        Args:
+            size (Tuple[int, int]): Resized size, which is (width, height)
+            interpolation (Interpolation): Interpolation algorithm, only BICUBIC is supported.
+            device_mode (DeviceMode): The mode for running operator. Default value is CPU.
+
+        Returns:
+            Image: RGB image of the target size
+        """
+        if len(size) != _RESIZED_SIZE_LEN:
+            raise ValueError("size must be a tuple of (width, height)")
+        acc_img = self._inner.yuv_to_rgb_resize(
+            size[0], size[1], interpolation.value, device_mode.value
+        )
+        obj = object.__new__(self.__class__)
+        obj._inner = acc_img
+        return obj
+
+    def encode_jpeg(self, quality: int = _DEFAULT_JPEG_QUALITY) -> bytes:
+        """Encode an RGB or BGR image to jpeg bytes in memory, chroma is subsampled 4:2:0
+
+        Args:
+            quality (int): jpeg quality, range is [1, 100]. Default value is 95.
+
+        Returns:
+            bytes: encoded jpeg
+        """
+        if isinstance(quality, bool) or not isinstance(quality, int):
+            raise TypeError("quality must be an int")
+        return self._inner.encode_jpeg(quality)
+
     def to_tensor(self, target_format: TensorFormat = TensorFormat.NCHW,
                   device_mode: DeviceMode = DeviceMode.CPU) -> "Tensor":
         """Image to tensor
@@ -389,3 +530,50 @@ class Image:
             _acc.Image: inner Image (PyAcc)
         """
         return getattr(self, "_inner")
+
+
+def decode_images(image_paths: list, size: Optional[Tuple[int, int]] = None) -> List[dict]:
+    """Decode many jpeg, png or webp images in parallel on the SDK thread pool with a single call.
+    A broken file does not raise, its error_code is set instead so the other images stay usable.
+
+    Args:
+        image_paths (list): image paths, str or bytes, formats may be mixed
+        size (Tuple[int, int], optional): (width, height) to bicubic resize every image to while decoding,
+            same result as Image.open_resized. Default is None which keeps the original size.
+
+    Returns:
+        List[dict]: one dict per path with keys image and error_code, error_code is 0 when the image is decoded
+        successfully, otherwise image is None
+    """
+    resize_w, resize_h = 0, 0
+    if size is not None:
+        if len(size) != _RESIZED_SIZE_LEN:
+            raise ValueError("size must be a tuple of (width, height)")
+        resize_w, resize_h = size
+    paths = [_ensure_bytes(path, "path") for path in image_paths]
+    results = _acc.decode_images(paths, resize_w, resize_h)
+    # copy the inner images out of the result vector, they share the decoded data
+    return [{"image": Image._from_acc(_acc.Image(result.image)) if result.status == 0 else None,
+             "error_code": result.status}
+            for result in results]
+
+
+def encode_jpegs(images: List[Image], quality: int = _DEFAULT_JPEG_QUALITY) -> List[dict]:
+    """Encode many RGB or BGR images to jpeg in parallel on the SDK thread pool with a single call.
+    An unsupported image does not raise, its error_code is set instead so the other results stay usable.
+
+    Args:
+        images (List[Image]): images to encode
+        quality (int): jpeg quality, range is [1, 100]. Default value is 95.
+
+    Returns:
+        List[dict]: one dict per image with keys data and error_code, error_code is 0 when the image is encoded
+        successfully, otherwise data is None
+    """
+    if isinstance(quality, bool) or not isinstance(quality, int):
+        raise TypeError("quality must be an int")
+    if not all(isinstance(image, Image) for image in images):
+        raise TypeError("images must be a list of Image")
+    results = _acc.encode_jpegs([image._inner for image in images], quality)
+    return [{"data": result.data if result.status == 0 else None, "error_code": result.status}
+            for result in results]
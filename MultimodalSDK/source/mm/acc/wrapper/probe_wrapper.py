@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# -------------------------------------------------------------------------
+#  This file is part of the MultimodalSDK project.
+# Copyright (c) 2025 Huawei Technologies Co.,Ltd.
+#
+# MultimodalSDK is licensed under Mulan PSL v2.
+# You can use this software according to the terms and conditions of the Mulan PSL v2.
+# You may obtain a copy of Mulan PSL v2 at:
+#
+#           http://license.coscl.org.cn/MulanPSL2
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+# EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+# MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the Mulan PSL v2 for more details.
+# -------------------------------------------------------------------------
+from typing import List, Tuple
+from .._impl import acc as _acc
+from .util import _ensure_bytes
+
+_QWEN_MIN_PIXELS = 56 * 56
+_QWEN_MAX_PIXELS = 28 * 28 * 1280
+_INTERNVL2_TOKENS_PER_TILE = 256
+
+
+def probe_images(image_paths: list) -> List[dict]:
+    """Read the size of jpeg images from their headers, no pixel is decoded.
+
+    Args:
+        image_paths (list): jpeg image paths, str or bytes
+
+    Returns:
+        List[dict]: one dict per path with keys width, height and error_code, error_code is 0 when the image
+        is probed successfully, otherwise width and height are 0
+    """
+    paths = [_ensure_bytes(path, "path") for path in image_paths]
+    return [{"width": info.width, "height": info.height, "error_code": info.status}
+            for info in _acc.probe_images(paths)]
+
+
+def probe_videos(video_paths: list) -> List[dict]:
+    """Read resolution, fps, duration and frame count of mp4 videos from their metadata, no frame is decoded.
+
+    Args:
+        video_paths (list): mp4 video paths, str or bytes
+
+    Returns:
+        List[dict]: one dict per path with keys width, height, fps, duration, total_frames and error_code,
+        error_code is 0 when the video is probed successfully
+    """
+    paths = [_ensure_bytes(path, "path") for path in video_paths]
+    return [{"width": info.width, "height": info.height, "fps": info.fps, "duration": info.duration,
+             "total_frames": info.total_frames, "error_code": info.status}
+            for info in _acc.probe_videos(paths)]
+
+
+def estimate_qwen2_vl_tokens(width: int, height: int, num_frames: int = 1, min_pixels: int = _QWEN_MIN_PIXELS,
+                             max_pixels: int = _QWEN_MAX_PIXELS, patch_size: int = 14,
+                             temporal_patch_size: int = 2, merge_size: int = 2) -> Tuple[list, int]:
+    """Estimate the Qwen2-VL grid_thw and visual token count with the same smart resize as the preprocessor.
+
+    Args:
+        width (int): image or frame width, e.g. from probe_images or probe_videos
+        height (int): image or frame height
+        num_frames (int): 1 for an image, the number of sampled frames for a video
+
+    Returns:
+        Tuple[list, int]: grid_thw and number of tokens
+    """
+    estimate = _acc.Qwen2VLProcessor.EstimateTokens(width, height, num_frames, 0, 0, patch_size,
+                                                    temporal_patch_size, merge_size, min_pixels, max_pixels)
+    return list(estimate.grid_thw), estimate.num_tokens
+
+
+def estimate_internvl2_tokens(width: int, height: int, input_size: int = 448, min_num: int = 1, max_num: int = 12,
+                              use_thumbnail: bool = True,
+                              tokens_per_tile: int = _INTERNVL2_TOKENS_PER_TILE) -> Tuple[int, int]:
+    """Estimate the InternVL2 dynamic tiling tile count and visual token count.
+
+    Args:
+        width (int): image width, e.g. from probe_images
+        height (int): image height
+
+    Returns:
+        Tuple[int, int]: number of tiles including the thumbnail and number of tokens
+    """
+    estimate = _acc.InternVL2Processor.EstimateTokens(width, height, input_size, min_num, max_num, use_thumbnail,
+                                                      tokens_per_tile)
+    return estimate.num_tiles, estimate.num_tokens
@@ -31,7 +31,7 @@ class Tensor:
         """Support converting NumPy ndarray array to Tensor instances
 
         Args:
-            nd_array (numpy.ndarray): numpy's ndarray, support datatype [int8/uint8/float32]
+            nd_array (numpy.ndarray): numpy's ndarray, support datatype [int8/uint8/float32/float16]
 
         Returns:
             Tensor: dst tensor
@@ -48,8 +48,9 @@ class Tensor:
             raise ValueError("The input param 'nd_array' must be c_contiguous. Please use np.ascontiguousarray() "
                              "to convert the array to C-contiguous format before passing it to this function.")
 
-        if nd_array.dtype not in (np.int8, np.uint8, np.float32):
-            raise ValueError("The input numpy's ndarray data type must be in [np.int8/np.uint8/np.float32]")
+        if nd_array.dtype not in (np.int8, np.uint8, np.float32, np.float16):
+            raise ValueError("The input numpy's ndarray data type must be in "
+                             "[np.int8/np.uint8/np.float32/np.float16]")
 
         # If an error occurs, an exception will be raised.
         acc_tensor = _acc.Tensor.from_numpy(nd_array)
@@ -64,7 +65,7 @@ class Tensor:
         """Support converting torch.Tensor to Tensor instances
 
         Args:
-            torch_tensor (torch.Tensor): torch's Tensor, support datatype [int8/uint8/float32]
+            torch_tensor (torch.Tensor): torch's Tensor, support datatype [int8/uint8/float32/float16]
 
         Returns:
             Tensor: dst tensor
@@ -82,8 +83,9 @@ class Tensor:
                              "use torch_tensor.contiguous() to convert the tensor to "
                              "contiguous format before passing it to this function.")
 
-        if torch_tensor.dtype not in (torch.int8, torch.uint8, torch.float32):
-            raise ValueError("The input torch_tensor's data type must be in [torch.int8/torch.uint8/torch.float32]")
+        if torch_tensor.dtype not in (torch.int8, torch.uint8, torch.float32, torch.float16):
+            raise ValueError("The input torch_tensor's data type must be in "
+                             "[torch.int8/torch.uint8/torch.float32/torch.float16]")
 
         if torch_tensor.device.type != 'cpu':
             raise ValueError("The parameter 'torch_tensor' must be on CPU device, "
@@ -146,7 +148,7 @@ class Tensor:
         return self._inner.nbytes
 
     def clone(self) -> "Tensor":
-        """Tensor deep copy to a new tensor
+        """Tensor copy to a new tensor, the buffer is shared until either side is exported to numpy
 
         Returns:
             Tensor: dst tensor
@@ -167,6 +169,8 @@ class Tensor:
     def numpy(self):
         """Support converting Tensor instances to NumPy ndarray array
 
+        NumPy has no bfloat16, a BFLOAT16 tensor is returned as its raw bits in an uint16 array.
+
         Returns:
             nd_array: dst numpy.ndarray instance
         """
@@ -193,26 +197,32 @@ class Tensor:
 
         # Convert tensor to CPU, then to numpy array, and finally back to torch tensor
         # This ensures the tensor is processed on CPU (CPU process solution)
+        if self.dtype == DataType.BFLOAT16:
+            # numpy carries the bfloat16 bits as uint16, reinterpret them without copying
+            return torch.from_numpy(self.numpy().view('<i2')).view(torch.bfloat16)
         return torch.from_numpy(self.numpy())
 
-    def normalize(self, mean: list[float], std: list[float], device_mode: DeviceMode = DeviceMode.CPU):
+    def normalize(self, mean: list[float], std: list[float], device_mode: DeviceMode = DeviceMode.CPU,
+                  dtype: DataType = DataType.FLOAT32):
         """Normalize the input tensor with given mean and standard deviation.
 
         Args:
             mean (list[float]): List of mean values for normalization, one value per channel.
             std (list[float]): List of standard deviation values for normalization, one value per channel.
             device_mode (DeviceMode): Specifies the device mode for computation (CPU, NPU, DVPP, etc). Default is CPU.
+            dtype (DataType): Data type of the result, range is FLOAT32, FLOAT16, BFLOAT16. Default is FLOAT32.
         Returns:
             Tensor: dst tensor
         """
-        acc_tensor = self._inner.normalize(mean, std, device_mode.value)
+        acc_tensor = self._inner.normalize(mean, std, device_mode.value, dtype.value)
         obj = object.__new__(self.__class__)
         obj._inner = acc_tensor
 
         return obj
 
 
-def normalize(src: Tensor, mean: list[float], std: list[float], device_mode: DeviceMode = DeviceMode.CPU):
+def normalize(src: Tensor, mean: list[float], std: list[float], device_mode: DeviceMode = DeviceMode.CPU,
+              dtype: DataType = DataType.FLOAT32):
     """Normalize the input tensor with given mean and standard deviation.
 
     Args:
@@ -220,13 +230,14 @@ def normalize(src: Tensor, mean: list[float], std: list[float], device_mode: Dev
         mean (list[float]): List of mean values for normalization, one value per channel.
         std (list[float]): List of standard deviation values for normalization, one value per channel.
         device_mode (DeviceMode): Specifies the device mode for computation (CPU, NPU, DVPP, etc). Default is CPU.
+        dtype (DataType): Data type of the result, range is FLOAT32, FLOAT16, BFLOAT16. Default is FLOAT32.
     """
     if not isinstance(src, Tensor):
         raise ValueError("The parameter 'src' must be mm.Tensor instance.")
 
     src_acc_tensor = src._inner
     dst_acc_tensor = _acc.Tensor()
-    _acc.normalize(src_acc_tensor, dst_acc_tensor, mean, std, device_mode.value)
+    _acc.normalize(src_acc_tensor, dst_acc_tensor, mean, std, device_mode.value, dtype.value)
     obj = object.__new__(Tensor)
     obj._inner = dst_acc_tensor
     return obj
\ No newline at end of file
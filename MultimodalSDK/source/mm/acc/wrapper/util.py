@@ -41,8 +41,11 @@ class ObjectWrapper:
 
     Args:
         __array_interface__ (dict): __array_interface__ protocol dictionary
+        owner (object, optional): object owning the memory, kept alive as long as the ndarray refers to it
     """
 
-    def __init__(self, interface_dict):
+    def __init__(self, interface_dict, owner=None):
         # Set the NumPy array interface containing data pointer, shape, dtype, etc.
-        self.__array_interface__ = interface_dict.get('__array_interface__')
\ No newline at end of file
+        self.__array_interface__ = interface_dict.get('__array_interface__')
+        # numpy keeps this wrapper as ndarray.base, so holding the owner here ties its lifetime to the array
+        self._owner = owner
\ No newline at end of file
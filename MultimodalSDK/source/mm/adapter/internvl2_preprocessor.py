@@ -17,9 +17,12 @@
 # -------------------------------------------------------------------------
 import torch
 from typing import Union, List, Dict, Tuple, Optional
+import numpy as np
 import PIL.Image as PILImage
 
-from ..acc.wrapper import Image, DeviceMode, Interpolation, TensorFormat
+from ..acc.wrapper import Image
+from ..acc._impl import acc as _acc
+from ..acc.wrapper.util import ObjectWrapper
 
 IMAGENET_MEAN = (0.485, 0.456, 0.406)
 IMAGENET_STD = (0.229, 0.224, 0.225)
@@ -27,72 +30,6 @@ MAX_IMAGE_SIZE = 8192
 MIN_IMAGE_SIZE = 10
 
 
-def _get_target_ratios(
-        min_num: int,
-        max_num: int,
-) -> list[tuple[int, int]]:
-    target_ratios = []
-    for i in range(1, max_num + 1):
-        for j in range(1, max_num + 1):
-            product = i * j
-            if min_num <= product <= max_num:
-                target_ratios.append((i, j))
-    target_ratios = sorted(set(target_ratios), key=lambda x: x[0] * x[1])
-    return target_ratios
-
-
-def _find_closest_aspect_ratio(
-        aspect_ratio: float,
-        target_ratios: list[tuple[int, int]],
-        *,
-        width: int,
-        height: int,
-        image_size: int,
-) -> tuple[int, int]:
-    best_ratio_diff = float('inf')
-    best_ratio = (1, 1)
-    area = width * height
-    for ratio in target_ratios:
-        target_aspect_ratio = ratio[0] / ratio[1]
-        ratio_diff = abs(aspect_ratio - target_aspect_ratio)
-        if ratio_diff < best_ratio_diff:
-            best_ratio_diff = ratio_diff
-            best_ratio = ratio
-        elif ratio_diff == best_ratio_diff:
-            if area > 0.5 * image_size * image_size * ratio[0] * ratio[1]:
-                best_ratio = ratio
-    return best_ratio
-
-
-def _calculate_target_dimensions(
-        *,
-        orig_width: int,
-        orig_height: int,
-        target_ratios: list[tuple[int, int]],
-        image_size: int,
-        use_thumbnail: bool,
-) -> tuple[int, int, int]:
-    aspect_ratio = orig_width / orig_height
-    # find the closest aspect ratio to the target
-    target_aspect_ratio = _find_closest_aspect_ratio(
-        aspect_ratio,
-        target_ratios,
-        width=orig_width,
-        height=orig_height,
-        image_size=image_size,
-    )
-    # calculate the target width and height
-    target_width = image_size * target_aspect_ratio[0]
-    target_height = image_size * target_aspect_ratio[1]
-    blocks = target_aspect_ratio[0] * target_aspect_ratio[1]
-
-    # add thumbnail image if num_blocks != 1
-    if use_thumbnail and blocks != 1:
-        blocks += 1
-
-    return blocks, target_width, target_height
-
-
 class InternVL2PreProcessor:
 
     @staticmethod
@@ -138,40 +75,9 @@ class InternVL2PreProcessor:
             raise ValueError("The input param 'input_size' must be in range [10, 8192], please check.")
 
 
-        target_ratios = _get_target_ratios(min_num, max_num)
-
-        blocks, target_width, target_height = _calculate_target_dimensions(
-            orig_width=orig_width,
-            orig_height=orig_height,
-            target_ratios=target_ratios,
-            image_size=input_size,
-            use_thumbnail=False,
-        )
-
-        resized_img = image.resize(
-            (target_width, target_height), Interpolation.BICUBIC, DeviceMode.CPU
-        )
-        processed_tensors = []
-        for i in range(blocks):
-            left = (i % (target_width // input_size)) * input_size
-            top = (i // (target_width // input_size)) * input_size
-            right = ((i % (target_width // input_size)) + 1) * input_size
-            bottom = ((i // (target_width // input_size)) + 1) * input_size
-            width = right - left
-            height = bottom - top
-            # split the image
-            split_img = resized_img.crop(top, left, height, width, DeviceMode.CPU)
-            tensor = split_img.to_tensor(TensorFormat.NCHW)
-            tensor = tensor.normalize(IMAGENET_MEAN, IMAGENET_STD)
-            processed_tensors.append(tensor)
-
-        if use_thumbnail and len(processed_tensors) != 1:
-            thumbnail_img = image.resize(
-                (input_size, input_size), Interpolation.BICUBIC, DeviceMode.CPU
-            )
-            thumbnail_tensor = thumbnail_img.to_tensor(TensorFormat.NCHW)
-            thumbnail_tensor = thumbnail_tensor.normalize(IMAGENET_MEAN, IMAGENET_STD)
-            processed_tensors.append(thumbnail_tensor)
-
-        pixel_values = torch.stack([tensor.torch().squeeze(0) for tensor in processed_tensors])
+        # grid search, resize, tiling and normalize are fused into a single native call which writes all
+        # tiles (and the thumbnail) into one contiguous (N, 3, input_size, input_size) buffer
+        acc_tensor = _acc.InternVL2Processor.Preprocess(image.get_inner(), list(IMAGENET_MEAN), list(IMAGENET_STD),
+                                                        input_size, min_num, max_num, use_thumbnail)
+        pixel_values = torch.from_numpy(np.asarray(ObjectWrapper(acc_tensor.numpy(), owner=acc_tensor)))
         return pixel_values
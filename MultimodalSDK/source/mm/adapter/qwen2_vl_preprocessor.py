@@ -604,39 +604,45 @@ class MultimodalQwen2VLImageProcessor(Qwen2VLImageProcessor):
         """
         h, w = _smart_resize(images[0].height, images[0].width,
                              cons.patch_size * cons.merge_size, cons.min_pixels, cons.max_pixels)
-        tensor_acc_list = _acc.Qwen2VLProcessor.Preprocess(images, image_mean, image_std, w, h)
-        patches = np.stack([
-            np.asarray(ObjectWrapper(t.numpy()))[0]
-            for t in tensor_acc_list
-        ])
-        # NOTE: The following patch partitioning and reshaping strictly follows
-        # the Qwen2-VL paper design. Do not modify!
-        patches = patches.transpose(0, 3, 1, 2)
-        if patches.shape[0] % cons.temporal_patch_size != 0:
-            repeats = np.repeat(patches[-1][np.newaxis],
-                                cons.temporal_patch_size - (patches.shape[0] % cons.temporal_patch_size), axis=0)
-            patches = np.concatenate([patches, repeats], axis=0)
-
-        channel = patches.shape[1]
-        grid_t = patches.shape[0] // cons.temporal_patch_size
-        grid_h, grid_w = h // cons.patch_size, w // cons.patch_size
-        patches = patches.reshape(
-            grid_t,
-            cons.temporal_patch_size,
-            channel,
-            grid_h // cons.merge_size,
-            cons.merge_size,
-            cons.patch_size,
-            grid_w // cons.merge_size,
-            cons.merge_size,
-            cons.patch_size,
-        )
-        patches = patches.transpose(0, 3, 6, 4, 7, 2, 1, 5, 8)
-        flatten_patches = patches.reshape(
-            grid_t * grid_h * grid_w,
-            channel * cons.temporal_patch_size * cons.patch_size * cons.patch_size,
-        )
-        return flatten_patches, (grid_t, grid_h, grid_w)
+        if len(images) == 1:
+            # A single frame forms one temporal group, the native op emits the flattened patches directly.
+            result = _acc.Qwen2VLProcessor.PreprocessPatches(images, image_mean, image_std, w, h, cons.patch_size,
+                                                             cons.temporal_patch_size, cons.merge_size)
+        else:
+            # All frames of a video are merged into temporal groups in a single native run.
+            result = _acc.Qwen2VLProcessor.PreprocessVideoPatches(images, image_mean, image_std, w, h,
+                                                                  cons.patch_size, cons.temporal_patch_size,
+                                                                  cons.merge_size)
+        pixel_values = result.pixel_values
+        flatten_patches = np.asarray(ObjectWrapper(pixel_values.numpy(), owner=pixel_values))
+        return flatten_patches, tuple(result.grid_thw)
+
+    def _preprocess_images_with_accelerate(self, images: List[Image], image_mean: List[float],
+                                           image_std: List[float], cons: ImageConstraints
+                                           ) -> [np.ndarray, List[tuple[int, int, int]]]:
+        """Internal preprocessing for a batch of images of any sizes.
+
+        Every image is smart resized natively from min_pixels and max_pixels, and all images are
+        preprocessed concurrently in a single native call.
+
+        Args:
+            images (list[Image]): List of input images.
+            image_mean (list[float]): Mean for normalization.
+            image_std (list[float]): Std for normalization.
+            cons (ImageConstraints): Constraint object.
+
+        Returns:
+            tuple[np.ndarray, list[tuple[int,int,int]]]:
+                - Flattened patches of all images.
+                - Grid dimensions (T,H,W) of every image.
+        """
+        result = _acc.Qwen2VLProcessor.PreprocessPatches(images, image_mean, image_std, 0, 0, cons.patch_size,
+                                                         cons.temporal_patch_size, cons.merge_size,
+                                                         cons.min_pixels, cons.max_pixels)
+        pixel_values = result.pixel_values
+        flatten_patches = np.asarray(ObjectWrapper(pixel_values.numpy(), owner=pixel_values))
+        grid_thw = list(result.grid_thw)
+        return flatten_patches, [tuple(grid_thw[i:i + 3]) for i in range(0, len(grid_thw), 3)]
 
     def _prepare_and_validate_images_and_videos(
             self,
@@ -687,7 +693,7 @@ class MultimodalQwen2VLImageProcessor(Qwen2VLImageProcessor):
         """Preprocess images and videos into patch tensors.
 
         This function performs accelerated preprocessing for both images and videos:
-            - Images are preprocessed individually and converted into patch tensors.
+            - Images are preprocessed together in one call and converted into patch tensors.
             - Videos are preprocessed frame-by-frame, then aggregated into patch tensors.
 
         Args:
@@ -711,29 +717,23 @@ class MultimodalQwen2VLImageProcessor(Qwen2VLImageProcessor):
                     }
         """
         data = {}
-
-        def process_inputs(inputs, is_video=False):
-            pixel_values, vision_grid_thws = [], []
-            for inp in inputs:
-                patches, grid_thw = self._preprocess_with_accelerate(inp, image_mean, image_std, cons)
-                pixel_values.extend(patches)
-                vision_grid_thws.append(grid_thw)
-
-            if is_video:
-                return {
-                    "pixel_values_videos": np.array(pixel_values),
-                    "video_grid_thw": np.array(vision_grid_thws)
-                }
-            else:
-                return {
-                    "pixel_values": np.array(pixel_values),
-                    "image_grid_thw": np.array(vision_grid_thws)
-                }
-
         if images is not None and videos is None:
-            data = process_inputs([[img] for img in images], is_video=False)
+            pixel_values, image_grid_thw = self._preprocess_images_with_accelerate(images, image_mean, image_std,
+                                                                                    cons)
+            data = {
+                "pixel_values": np.array(pixel_values),
+                "image_grid_thw": np.array(image_grid_thw)
+            }
         elif videos is not None:
-            data = process_inputs(videos, is_video=True)
+            pixel_values, video_grid_thw = [], []
+            for video in videos:
+                patches, grid_thw = self._preprocess_with_accelerate(video, image_mean, image_std, cons)
+                pixel_values.extend(patches)
+                video_grid_thw.append(grid_thw)
+            data = {
+                "pixel_values_videos": np.array(pixel_values),
+                "video_grid_thw": np.array(video_grid_thw)
+            }
         return data
 
     def preprocess(self,
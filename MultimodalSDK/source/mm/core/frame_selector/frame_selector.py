@@ -32,6 +32,10 @@ from transformers import (
     CLIPModel,
 )
 
+from ...acc.wrapper import Image, ImageFormat
+from ...acc._impl import acc as _acc
+from ...acc.wrapper.util import ObjectWrapper
+
 DECAY_STEP = 0.01
 INITIAL_STAGE_DIFF = 0.03
 STAGE_DECAY_STEP = 0.0015
@@ -247,27 +251,88 @@ class BaseFrameSelector(ABC):
         query_feature = text_features / text_features.norm(p=2, dim=-1, keepdim=True)
         return query_feature
 
+    def _native_preprocess_params(self) -> Optional[dict]:
+        """Reads the resize, crop and normalization settings of the image processor for the native op.
+
+        Returns:
+            Keyword arguments of the native CLIP preprocess, or None when the processor produces
+            images of varying size (no center crop) and has to be used as is.
+        """
+        image_processor = self.processor.image_processor
+        size = dict(image_processor.size)
+        resize_w, resize_h = self.image_size if self.image_size else (0, 0)
+        if "shortest_edge" in size:
+            if not image_processor.do_center_crop:
+                return None
+            shortest_edge = int(size["shortest_edge"])
+            crop_w, crop_h = int(image_processor.crop_size["width"]), int(image_processor.crop_size["height"])
+        else:
+            # A fixed (height, width) resize is a stretch followed by a crop of the whole image.
+            resize_w, resize_h = int(size["width"]), int(size["height"])
+            shortest_edge = min(resize_w, resize_h)
+            crop_w, crop_h = resize_w, resize_h
+        return {
+            "mean": [float(v) for v in image_processor.image_mean],
+            "std": [float(v) for v in image_processor.image_std],
+            "shortest_edge": shortest_edge,
+            "crop_w": crop_w,
+            "crop_h": crop_h,
+            "resize_w": resize_w,
+            "resize_h": resize_h,
+        }
+
+    @staticmethod
+    def _preprocess_frames(frames, params: dict) -> torch.Tensor:
+        """Preprocesses all frames of a video in one native call.
+
+        Shortest side resize, center crop and normalization run natively over the whole list. When
+        image_size is set, every frame is resized once straight to the model input instead of twice.
+
+        Args:
+            frames: List of numpy arrays (H, W, 3) or Image objects.
+            params: Native preprocess settings from _native_preprocess_params.
+
+        Returns:
+            Pixel values of shape (N, 3, crop_h, crop_w).
+        """
+        images = [
+            frame if isinstance(frame, Image) else Image.from_numpy(
+                np.ascontiguousarray(frame, dtype=np.uint8), ImageFormat.RGB)
+            for frame in frames
+        ]
+        acc_tensor = _acc.ClipProcessor.Preprocess([img.get_inner() for img in images], params["mean"],
+                                                   params["std"], params["shortest_edge"], params["crop_w"],
+                                                   params["crop_h"], params["resize_w"], params["resize_h"])
+        return torch.from_numpy(np.asarray(ObjectWrapper(acc_tensor.numpy(), owner=acc_tensor)))
+
     def _extract_image_features(self, frames):
         """Extracts and L2-normalizes CLIP image features in batches.
 
         Steps:
-            1. Process frames in batches of self.batch_size to avoid OOM.
-            2. Resize each frame to self.image_size.
+            1. Preprocess all frames natively in one call, when the processor settings allow it.
+            2. Run the model on batches of self.batch_size to avoid OOM.
             3. Concatenate features from all batches.
             4. L2-normalize the full feature matrix.
 
         Args:
-            frames: List of BGR numpy arrays.
+            frames: List of numpy arrays or Image objects.
 
         Returns:
             Normalized image feature matrix of shape (N, D).
         """
         all_features = []
+        pixel_values = None
+        params = self._native_preprocess_params()
+        if params is not None:
+            pixel_values = self._preprocess_frames(frames, params)
         for i in range(0, len(frames), self.batch_size):
-            batch_images = frames[i : i + self.batch_size]
-            if self.image_size:
-                batch_images = [cv2.resize(frame, self.image_size) for frame in batch_images]
-            inputs_image = self.processor(images=batch_images, return_tensors="pt", padding=True).to(self.device)
+            if pixel_values is not None:
+                inputs_image = {"pixel_values": pixel_values[i : i + self.batch_size].to(self.device)}
+            else:
+                batch_images = frames[i : i + self.batch_size]
+                if self.image_size:
+                    batch_images = [cv2.resize(frame, self.image_size) for frame in batch_images]
+                inputs_image = self.processor(images=batch_images, return_tensors="pt", padding=True).to(self.device)
             with torch.no_grad():
                 image_features = self.model.get_image_features(**inputs_image)
             all_features.append(image_features)
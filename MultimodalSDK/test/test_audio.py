@@ -117,6 +117,21 @@ class TestAudio(unittest.TestCase):
         with self.assertRaises(ValueError):
             load_audio(INVALID_AUDIO_PATH, self.sample_rate)
 
+    def test_load_audio_from_bytes_should_equal_file(self):
+        os.chmod(VALID_AUDIO_PATH, 0o440)
+        with open(VALID_AUDIO_PATH, "rb") as f:
+            content = f.read()
+        tensor, sample_rate = load_audio(content, self.sample_rate)
+        expect, expect_sr = load_audio(VALID_AUDIO_PATH, self.sample_rate)
+        self.assertEqual(sample_rate, expect_sr)
+        self.assertTrue(np.array_equal(tensor.numpy(), expect.numpy()))
+        tensor, _ = load_audio(memoryview(content))
+        self.assertGreater(tensor.shape[0], 0)
+
+    def test_load_audio_from_invalid_bytes_should_fail(self):
+        with self.assertRaises(RuntimeError):
+            load_audio(b"RIFF not a wav file", self.sample_rate)
+
     def test_load_audio_from_empty_list_should_fail(self):
         with self.assertRaises(ValueError):
             load_audio([], self.sample_rate)
@@ -40,6 +40,11 @@ VALID_DEVICE_ID = 0
 def _make_processor_mock():
     mock = MagicMock()
     mock.return_value.to.return_value = mock
+    mock.image_processor.size = {"shortest_edge": 224}
+    mock.image_processor.crop_size = {"height": 224, "width": 224}
+    mock.image_processor.do_center_crop = True
+    mock.image_processor.image_mean = [0.48145466, 0.4578275, 0.40821073]
+    mock.image_processor.image_std = [0.26862954, 0.26130258, 0.27577711]
     return mock
 
 
@@ -405,6 +410,25 @@ class TestExtractFeatures:
         norms = result.norm(p=2, dim=-1)
         assert torch.allclose(norms, torch.ones_like(norms), atol=1e-5)
 
+    def test_preprocess_frames_natively(self, clip_selector, mock_transformers):
+        clip_selector.processor = mock_transformers["clip_processor"]
+        params = clip_selector._native_preprocess_params()
+        assert params["shortest_edge"] == 224
+        assert (params["resize_w"], params["resize_h"]) == clip_selector.image_size
+
+        pixel_values = clip_selector._preprocess_frames(_make_frames(3, height=480, width=640), params)
+        assert tuple(pixel_values.shape) == (3, 3, 224, 224)
+        assert pixel_values.dtype == torch.float32
+
+    def test_native_preprocess_params_without_center_crop(self, clip_selector, mock_transformers):
+        clip_selector.processor = mock_transformers["clip_processor"]
+        clip_selector.processor.image_processor.do_center_crop = False
+        assert clip_selector._native_preprocess_params() is None
+
+        clip_selector.processor.image_processor.size = {"height": 224, "width": 336}
+        params = clip_selector._native_preprocess_params()
+        assert (params["crop_w"], params["crop_h"], params["shortest_edge"]) == (336, 224, 224)
+
     def test_extract_image_features_batching(self, clip_selector, mock_transformers):
         clip_selector.processor = mock_transformers["clip_processor"]
         clip_selector.model = mock_transformers["clip_model"]
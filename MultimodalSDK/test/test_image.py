@@ -15,6 +15,7 @@
 # MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
 # See the Mulan PSL v2 for more details.
 # -------------------------------------------------------------------------
+import base64
 import os
 import sys
 from PIL import Image as PImage
@@ -93,12 +94,14 @@ def tensor_full_equal(a: torch.Tensor, b: torch.Tensor) -> bool:
 
 class TestImage(unittest.TestCase):
     valid_path = None
+    png_path = None
     invalid_path = None
 
     @classmethod
     def setUpClass(cls):
         cls.valid_path = "./test/assets/dog_1920_1080.jpg"
-        cls.invalid_path = "./test/assets/dog_1920_1080.png"
+        cls.png_path = "./test/assets/dog_1920_1080.png"
+        cls.invalid_path = "./test/assets/test_aac.mp4"
 
     def setUp(self):
         self.arr = np.random.randint(0, 255, (IM_HEIGHT, IM_WIDTH, THREE_CHANNEL), dtype=np.uint8)
@@ -426,6 +429,135 @@ class TestImage(unittest.TestCase):
         img2 = np.array(p_image.resize((RESIZE_WIDTH, RESIZE_HEIGHT), PImage.BICUBIC))
         self.assertTrue(np.array_equal(img1, img2))
 
+    def test_image_open_resized_close_to_full_decode(self):
+        os.chmod(self.valid_path, 0o640)
+        dst_image = mm.Image.open_resized(self.valid_path, (RESIZE_WIDTH, RESIZE_HEIGHT))
+        self.assertEqual(dst_image.format, ImageFormat.RGB)
+        self.assertEqual(dst_image.size, [RESIZE_WIDTH, RESIZE_HEIGHT])
+        expect = mm.Image.open(self.valid_path, DEVICE_CPU).resize(
+            (RESIZE_WIDTH, RESIZE_HEIGHT), mm.Interpolation.BICUBIC
+        ).numpy().astype(np.float64)
+        mse = np.mean((dst_image.numpy().astype(np.float64) - expect) ** 2)
+        self.assertGreater(10 * np.log10(255.0 ** 2 / max(mse, 1e-10)), 30)
+
+    def test_image_from_bytes_equal_to_open(self):
+        os.chmod(self.valid_path, 0o640)
+        with open(self.valid_path, "rb") as f:
+            content = f.read()
+        dst_image = mm.Image.from_bytes(content)
+        self.assertEqual(dst_image.size, [1920, 1080])
+        expect = mm.Image.open(self.valid_path, DEVICE_CPU)
+        self.assertTrue(np.array_equal(dst_image.numpy(), expect.numpy()))
+        self.assertTrue(np.array_equal(mm.Image.from_bytes(bytearray(content)).numpy(), expect.numpy()))
+        with self.assertRaises(RuntimeError):
+            mm.Image.from_bytes(content[:100])
+        with self.assertRaises(RuntimeError):
+            mm.Image.from_bytes(12345)
+
+    def test_image_from_base64_equal_to_open(self):
+        os.chmod(self.valid_path, 0o640)
+        with open(self.valid_path, "rb") as f:
+            content = base64.b64encode(f.read())
+        expect = mm.Image.open(self.valid_path, DEVICE_CPU).numpy()
+        self.assertTrue(np.array_equal(mm.Image.from_base64(content.decode()).numpy(), expect))
+        self.assertTrue(np.array_equal(mm.Image.from_base64(content).numpy(), expect))
+        data_url = "data:image/jpeg;base64," + content.decode()
+        self.assertTrue(np.array_equal(mm.Image.from_base64(data_url).numpy(), expect))
+        with self.assertRaises(RuntimeError):
+            mm.Image.from_base64(content.decode()[:1000])
+        with self.assertRaises(RuntimeError):
+            mm.Image.from_base64("not base64 !")
+
+    def test_open_png_equal_to_pillow(self):
+        os.chmod(self.png_path, 0o640)
+        dst_image = mm.Image.open(self.png_path, DEVICE_CPU)
+        self.assertEqual(dst_image.size, [1920, 1080])
+        expect = np.array(PImage.open(self.png_path).convert("RGB"))
+        self.assertTrue(np.array_equal(dst_image.numpy().reshape(expect.shape), expect))
+        with open(self.png_path, "rb") as f:
+            content = f.read()
+        self.assertTrue(np.array_equal(mm.Image.from_bytes(content).numpy(), dst_image.numpy()))
+        results = mm.decode_images([self.valid_path, self.png_path])
+        self.assertEqual([result["error_code"] for result in results], [0, 0])
+        self.assertTrue(np.array_equal(results[1]["image"].numpy(), dst_image.numpy()))
+
+    def test_yuv_to_rgb_resize_close_to_rgb_resize(self):
+        rgb = np.array(PImage.open(self.png_path).convert("RGB")).astype(np.float64)
+        height, width = rgb.shape[:2]
+        luma = 16 + (66 * rgb[..., 0] + 129 * rgb[..., 1] + 25 * rgb[..., 2] + 128) // 256
+        block = rgb.reshape(height // 2, 2, width // 2, 2, 3).mean(axis=(1, 3))
+        u = np.rint(128 - 0.148 * block[..., 0] - 0.291 * block[..., 1] + 0.439 * block[..., 2])
+        v = np.rint(128 + 0.439 * block[..., 0] - 0.368 * block[..., 1] - 0.071 * block[..., 2])
+        planar = np.concatenate([luma.ravel(), u.ravel(), v.ravel()]).astype(np.uint8).reshape(height * 3 // 2, width)
+        uv = np.stack([u, v], axis=-1).reshape(height // 2, width)
+        nv12 = np.concatenate([luma, uv]).astype(np.uint8)
+
+        yuv_image = mm.Image.from_numpy(planar, ImageFormat.YUV420P)
+        self.assertEqual(yuv_image.size, [width, height])
+        self.assertTrue(np.array_equal(yuv_image.numpy(), planar))
+        result = yuv_image.yuv_to_rgb_resize((RESIZE_WIDTH, RESIZE_HEIGHT))
+        self.assertEqual(result.format, ImageFormat.RGB)
+        nv12_result = mm.Image.from_numpy(nv12, ImageFormat.NV12).yuv_to_rgb_resize((RESIZE_WIDTH, RESIZE_HEIGHT))
+        self.assertTrue(np.array_equal(result.numpy(), nv12_result.numpy()))
+        expect = mm.Image.open(self.png_path, DEVICE_CPU).resize((RESIZE_WIDTH, RESIZE_HEIGHT), mm.Interpolation.BICUBIC)
+        diff = np.abs(result.numpy().astype(np.int32) - expect.numpy().astype(np.int32))
+        self.assertLess(diff.mean(), 2.0)
+        with self.assertRaises(RuntimeError):
+            mm.Image.open(self.png_path, DEVICE_CPU).yuv_to_rgb_resize((RESIZE_WIDTH, RESIZE_HEIGHT))
+        with self.assertRaises(RuntimeError):
+            mm.Image.from_numpy(planar[:-1], ImageFormat.YUV420P)
+
+    def test_encode_jpeg_decode_back_close_to_source(self):
+        os.chmod(self.valid_path, 0o640)
+        src = mm.Image.open(self.valid_path, DEVICE_CPU)
+        data = src.encode_jpeg()
+        self.assertIsInstance(data, bytes)
+        decoded = mm.Image.from_bytes(data)
+        self.assertEqual(decoded.size, src.size)
+        diff = np.abs(decoded.numpy().astype(np.int32) - src.numpy().astype(np.int32))
+        self.assertLess(diff.mean(), 3.0)
+        self.assertLess(len(src.encode_jpeg(30)), len(data))
+        with self.assertRaises(RuntimeError):
+            src.encode_jpeg(0)
+        with self.assertRaises(TypeError):
+            src.encode_jpeg(95.0)
+
+        planar = mm.Image.from_numpy(np.ascontiguousarray(src.numpy().transpose(2, 0, 1)), ImageFormat.RGB_PLANAR)
+        results = mm.encode_jpegs([src, planar, src])
+        self.assertEqual(len(results), 3)
+        self.assertNotEqual(results[1]["error_code"], 0)
+        self.assertIsNone(results[1]["data"])
+        for i in (0, 2):
+            self.assertEqual(results[i]["error_code"], 0)
+            self.assertEqual(results[i]["data"], data)
+
+    def test_decode_images_report_error_per_item(self):
+        os.chmod(self.valid_path, 0o640)
+        results = mm.decode_images([self.valid_path, self.invalid_path, self.valid_path])
+        self.assertEqual(len(results), 3)
+        self.assertNotEqual(results[1]["error_code"], 0)
+        self.assertIsNone(results[1]["image"])
+        expect = mm.Image.open(self.valid_path, DEVICE_CPU).numpy()
+        for i in (0, 2):
+            self.assertEqual(results[i]["error_code"], 0)
+            self.assertTrue(np.array_equal(results[i]["image"].numpy(), expect))
+        resized = mm.decode_images([self.valid_path], (RESIZE_WIDTH, RESIZE_HEIGHT))
+        self.assertEqual(resized[0]["image"].size, [RESIZE_WIDTH, RESIZE_HEIGHT])
+        with self.assertRaises(ValueError):
+            mm.decode_images([self.valid_path], (RESIZE_WIDTH,))
+
+    def test_image_open_cropped_equal_to_crop_after_decode(self):
+        os.chmod(self.valid_path, 0o640)
+        dst_image = mm.Image.open_cropped(self.valid_path, 517, 301, CROP_HEIGHT, CROP_WIDTH)
+        self.assertEqual(dst_image.size, [CROP_WIDTH, CROP_HEIGHT])
+        expect = mm.Image.open(self.valid_path, DEVICE_CPU).crop(517, 301, CROP_HEIGHT, CROP_WIDTH)
+        self.assertTrue(np.array_equal(dst_image.numpy(), expect.numpy()))
+
+    def test_image_open_cropped_out_of_range_should_fail(self):
+        os.chmod(self.valid_path, 0o640)
+        with self.assertRaises(RuntimeError):
+            mm.Image.open_cropped(self.valid_path, 1000, 0, 100, CROP_WIDTH)
+
     def test_image_resize_failed_with_invalid_params(self):
         np_arr = np.random.randint(
             0, 256, (HEIGHT_840, WIDTH_960, THREE_CHANNEL), dtype=np.uint8
@@ -488,6 +620,19 @@ class TestImage(unittest.TestCase):
         expected_message = "Failed to execute 'to tensor' operator, please ensure your inputs are valid."
         self.assertEqual(str(context.exception), expected_message)
 
+    def test_probe_images_and_estimate_tokens_should_success(self):
+        os.chmod(self.valid_path, 0o640)
+        infos = mm.probe_images([self.valid_path, self.invalid_path])
+        self.assertEqual(len(infos), 2)
+        self.assertEqual((infos[0]["width"], infos[0]["height"], infos[0]["error_code"]), (1920, 1080, 0))
+        self.assertNotEqual(infos[1]["error_code"], 0)
+
+        grid_thw, num_tokens = mm.estimate_qwen2_vl_tokens(infos[0]["width"], infos[0]["height"])
+        self.assertEqual(grid_thw, [1, 52, 94])
+        self.assertEqual(num_tokens, 52 * 94 // 4)
+        num_tiles, num_tokens = mm.estimate_internvl2_tokens(infos[0]["width"], infos[0]["height"])
+        self.assertEqual((num_tiles, num_tokens), (9, 9 * 256))
+
 
 if __name__ == "__main__":
     unittest.main()
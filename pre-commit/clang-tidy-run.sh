@@ -96,6 +96,8 @@ add_include "${ACC_DATA_CPP}/interface"
 add_system_include "${ACC_SDK}/opensource/libjpeg-turbo/include"
 add_system_include "${ACC_SDK}/opensource/FFmpeg/include"
 add_system_include "${ACC_SDK}/opensource/soxr/include"
+add_system_include "${ACC_SDK}/opensource/libpng/include"
+add_system_include "${ACC_SDK}/opensource/libwebp/include"
 add_system_include "${ACC_SDK}/acc_data/3rdparty/pybind/pybind11/include"
 
 ASCEND_HOME="${ASCEND_TOOLKIT_HOME:-/usr/local/Ascend/ascend-toolkit/latest}"